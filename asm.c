@@ -1,38 +1,254 @@
 #include "asm.h"
 #include "debug.h"
 #include "codegen.h"
+#include "darray.h"
 
+#include <ctype.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #define GLOBAL_REG_COUNT 4
-#define MAX_SYMBOLS 1000
+#define STR_POOL_BUCKETS 1024
+#define STR_POOL_INIT_SIZE 64
+#define DATA_VALUES_PER_LINE 16
+#define FUNCTION_BUCKETS 1024
+#define ARG_REG_COUNT 6
+#define FLOAT_REG_COUNT 8
+#define FLOAT_ARG_REG_COUNT 8
+#define MAX_CALL_DEPTH 64
+
+// Everything that differs between the assembler syntaxes, the instructions
+// themselves are written the same way for both
+typedef struct
+{
+    char *header;
+    char *section;   /**< Format switching to a section. */
+    char *global;    /**< Format exporting a symbol. */
+    char *extern_fn; /**< Format declaring an external symbol. */
+    char *align;     /**< Format aligning initialized data. */
+    char *alignb;    /**< Format aligning uninitialized data. */
+    char *reserve;   /**< Format reserving a number of zeroed bytes after a label. */
+    char *zero_fill; /**< Format emitting a number of zero bytes. */
+    char *data[4];   /**< Data directives for 8, 16, 32 and 64 bit values. */
+    char *mem[4];    /**< Memory operand sizes for 8, 16, 32 and 64 bit accesses. */
+    char *note_gnu_stack;
+} ASMDialect;
 
 typedef struct
 {
     char *symbol_name;
+    char *label; /**< Name of the symbol in the generated code. */
     RegSize_e size;
-    int number_of_items;
+    size_t number_of_items;
     ASMSymbolType symbol_type;
-    ASMSymbolValue value;
+    ASMSymbolValue *values;
+    size_t value_count;
+    bool read_only;
 } ASMSymbol;
 
+// Function defined or called by the generated code, the ones that are only
+// called are external
+typedef struct ASMFunction ASMFunction;
+struct ASMFunction
+{
+    char *name;
+    char *label; /**< Name in the assembly, set when first written. */
+    bool defined;
+    bool called;
+    ASMFunction *bucket_next;
+    ASMFunction *next; /**< Next function in the order they were first seen. */
+};
+
+typedef struct ASMStrLit ASMStrLit;
+struct ASMStrLit
+{
+    char *str;
+    size_t len;
+    char *label;
+    LabelId id;
+    __uint32_t hash;
+    ASMStrLit *bucket_next; /**< Next literal in the same hash bucket. */
+    ASMStrLit *parent;      /**< Literal this one is a suffix of, if any. */
+};
+
+static ASMDialect asm_dialects[] = {
+    [ASM_SYNTAX_NASM] = {
+        .header = "",
+        .section = "section %s\n",
+        .global = "global\t%s\n",
+        .extern_fn = "extern %s\n",
+        .align = "\talign %zu, db 0\n",
+        .alignb = "\talignb %zu\n",
+        .reserve = "\t%s: resb %zu\n",
+        .zero_fill = "\ttimes %zu db 0\n",
+        .data = {"db", "dw", "dd", "dq"},
+        .mem = {"byte", "word", "dword", "qword"},
+        .note_gnu_stack = "section .note.GNU-stack noalloc noexec nowrite progbits\n",
+    },
+    [ASM_SYNTAX_GAS] = {
+        .header = "\t.intel_syntax noprefix\n",
+        .section = "\t.section %s\n",
+        .global = "\t.globl\t%s\n",
+        .extern_fn = "\t.extern %s\n",
+        .align = "\t.balign %zu, 0\n",
+        .alignb = "\t.balign %zu\n",
+        .reserve = "\t%s: .zero %zu\n",
+        .zero_fill = "\t.zero %zu\n",
+        .data = {".byte", ".short", ".long", ".quad"},
+        .mem = {"byte ptr", "word ptr", "dword ptr", "qword ptr"},
+        .note_gnu_stack = "\t.section .note.GNU-stack,\"\",@progbits\n",
+    },
+};
+
+// GNU as reads these as registers even where a symbol is expected, data
+// symbols and functions with one of these names get a suffix that C names
+// can't have
+static char *gas_reserved_names[] = {
+    "al", "ah", "ax", "eax", "rax", "bl", "bh", "bx", "ebx", "rbx",
+    "cl", "ch", "cx", "ecx", "rcx", "dl", "dh", "dx", "edx", "rdx",
+    "sil", "si", "esi", "rsi", "dil", "di", "edi", "rdi", "bpl", "bp",
+    "ebp", "rbp", "spl", "sp", "esp", "rsp", "cs", "ds", "es", "fs",
+    "gs", "ss", "st", "ip", "eip", "rip", "eiz", "riz"};
+
 static int free_reg[GLOBAL_REG_COUNT] = {1, 1, 1, 1};
 static char *reg_list[] = {"r12", "r13", "r14", "r15", "rax"};
 static char *dreg_list[] = {"r12d", "r13d", "r14d", "r15d", "eax"};
 static char *wreg_list[] = {"r12w", "r13w", "r14w", "r15w", "ax"};
 static char *breg_list[] = {"r12b", "r13b", "r14b", "r15b", "al"};
+static char *arg_reg_list[ARG_REG_COUNT] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+
+// Floating point values have their own pool. xmm0-xmm7 pass the arguments,
+// the pool uses the registers above them
+static int free_xmm_reg[FLOAT_REG_COUNT] = {1, 1, 1, 1, 1, 1, 1, 1};
+static char *xmm_list[] = {"xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15"};
+static char *float_arg_reg_list[FLOAT_ARG_REG_COUNT] = {"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"};
+
+// Call whose arguments are being evaluated, calls in the arguments nest.
+// Every xmm register is clobbered by a call, the ones holding a value are
+// spilled above the argument slots until the call returns
+typedef struct
+{
+    size_t arg_count;
+    bool *float_args; /**< Arguments passed in xmm registers. */
+    int spilled[FLOAT_REG_COUNT];
+    size_t spill_space;
+} ASMCallFrame;
 
-static ASMSymbol asm_symbols[MAX_SYMBOLS];
+// Locals are global symbols too, the table grows with the program
+static ASMSymbol *asm_symbols = NULL;
 static int asm_symbol_count = 0;
+static int asm_symbol_capacity = 0;
+
+static ASMStrLit *str_pool[STR_POOL_BUCKETS];
+static DArray_t str_pool_list;
+static size_t str_pool_count = 0;
+
+static ASMFunction *functions[FUNCTION_BUCKETS];
+static ASMFunction *function_list = NULL;
+static ASMFunction *last_function = NULL;
 
-static bool print_used = false;
 static LabelId label_count = 0;
 
+// Bytes below the saved registers holding the local arrays and the register
+// parameters
+static size_t frame_size = 0;
+
+// Arrays of the current function, placed in its frame right below the saved
+// registers. rbp is 16 byte aligned, the ones aligned further are given room
+// to be aligned at run time
+typedef struct
+{
+    char *name;
+    size_t offset;    /**< rbp relative offset, the array starts at [rbp - offset]. */
+    size_t alignment; /**< Alignment above 16 bytes, 0 otherwise. */
+} ASMLocalArray;
+
+static ASMLocalArray *local_arrays = NULL;
+static size_t local_array_count = 0;
+static size_t local_array_capacity = 0;
+static size_t local_arrays_size = 0;
+
+// rbp relative offset of every parameter of the current function
+static long *param_locations = NULL;
+static size_t param_location_capacity = 0;
+
+static ASMCallFrame call_frames[MAX_CALL_DEPTH];
+static size_t call_depth = 0;
+
+// Function being recorded, see asm_record_begin()
+static ASMRecord *recording = NULL;
+static FILE *recording_file;
+static int recording_first_symbol;
+
 Register asm_RAX = (Register)4;
 Register asm_NoReg = (Register)-1;
 
+static ASMDialect *dialect(CodeGenerator_t *gen)
+{
+    return &asm_dialects[gen->syntax];
+}
+
+static int size_index(RegSize_e size)
+{
+    switch (size)
+    {
+    case SIZE_8bit:
+        return 0;
+    case SIZE_16bit:
+        return 1;
+    case SIZE_32bit:
+        return 2;
+    default:
+        return 3;
+    }
+}
+
+static char *mem_size(CodeGenerator_t *gen, RegSize_e size)
+{
+    return dialect(gen)->mem[size_index(size)];
+}
+
+static char *symbol_label(CodeGenerator_t *gen, char *name)
+{
+    if (gen->syntax != ASM_SYNTAX_GAS)
+        return strdup(name);
+    for (size_t i = 0; i < sizeof(gas_reserved_names) / sizeof(gas_reserved_names[0]); i++)
+    {
+        if (strcmp(name, gas_reserved_names[i]) == 0)
+        {
+            char *label = malloc(strlen(name) + 2);
+            sprintf(label, "%s.", name);
+            return label;
+        }
+    }
+    return strdup(name);
+}
+
+static char *sized_reg(Register r, RegSize_e size)
+{
+    switch (size)
+    {
+    case SIZE_8bit:
+        return breg_list[r];
+    case SIZE_16bit:
+        return wreg_list[r];
+    case SIZE_32bit:
+        return dreg_list[r];
+    default:
+        return reg_list[r];
+    }
+}
+
+// Arithmetic on int and narrower types is done on the 32-bit registers.
+// Writing a 32-bit register clears the upper half, so values narrower than
+// 64 bits are always kept zero-extended to 64 bits in their registers.
+static char *op_reg(Register r, RegSize_e size)
+{
+    return sized_reg(r, size == SIZE_64bit ? SIZE_64bit : SIZE_32bit);
+}
+
 static ASMSymbol *get_bss_symbol(char *name)
 {
     for (int i = 0; i < asm_symbol_count; i++)
@@ -43,60 +259,333 @@ static ASMSymbol *get_bss_symbol(char *name)
     return NULL;
 }
 
+#define StrPoolList(index) (*(ASMStrLit **)darray_get(&str_pool_list, index))
+
+static __uint32_t str_hash(char *str, size_t len)
+{
+    // FNV-1a
+    __uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= (unsigned char)str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static ASMFunction *find_function(char *name)
+{
+    ASMFunction *function = functions[str_hash(name, strlen(name)) % FUNCTION_BUCKETS];
+
+    while (function != NULL && strcmp(function->name, name) != 0)
+        function = function->bucket_next;
+    return function;
+}
+
+static ASMFunction *get_function(char *name)
+{
+    ASMFunction **bucket = &functions[str_hash(name, strlen(name)) % FUNCTION_BUCKETS];
+    ASMFunction *function = find_function(name);
+
+    if (function != NULL)
+        return function;
+
+    function = calloc(1, sizeof(ASMFunction));
+    function->name = strdup(name);
+    function->bucket_next = *bucket;
+    *bucket = function;
+    if (last_function == NULL)
+        function_list = function;
+    else
+        last_function->next = function;
+    last_function = function;
+    return function;
+}
+
+// Functions are renamed like data symbols, `call rbx` would be an indirect call
+static char *function_label(CodeGenerator_t *gen, char *name)
+{
+    ASMFunction *function = get_function(name);
+
+    if (function->label == NULL)
+        function->label = symbol_label(gen, name);
+    return function->label;
+}
+
+static void record_call(char *name)
+{
+    if (recording == NULL)
+        return;
+    for (size_t i = 0; i < recording->call_count; i++)
+    {
+        if (strcmp(recording->calls[i], name) == 0)
+            return;
+    }
+    recording->calls = realloc(recording->calls, (recording->call_count + 1) * sizeof(char *));
+    recording->calls[recording->call_count++] = get_function(name)->name;
+}
+
+// Orders literals by their reversed bytes, so that every literal is directly
+// followed by the literals it is a suffix of
+static int str_lit_rev_cmp(const void *a, const void *b)
+{
+    ASMStrLit *l1 = *(ASMStrLit **)a;
+    ASMStrLit *l2 = *(ASMStrLit **)b;
+    size_t i = l1->len, j = l2->len;
+
+    while (i > 0 && j > 0)
+    {
+        unsigned char c1 = l1->str[--i];
+        unsigned char c2 = l2->str[--j];
+        if (c1 != c2)
+            return c1 < c2 ? -1 : 1;
+    }
+    if (l1->len == l2->len)
+        return 0;
+    return l1->len < l2->len ? -1 : 1;
+}
+
+static bool str_lit_is_suffix(ASMStrLit *suffix, ASMStrLit *lit)
+{
+    return suffix->len <= lit->len &&
+           memcmp(lit->str + lit->len - suffix->len, suffix->str, suffix->len) == 0;
+}
+
+static void emit_gas_bytes(CodeGenerator_t *gen, char *str, size_t len, bool terminate)
+{
+    fputs(terminate ? ".asciz \"" : ".ascii \"", gen->file);
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char c = str[i];
+        if (isprint(c) && c != '"' && c != '\\')
+            fputc(c, gen->file);
+        else
+            fprintf(gen->file, "\\%03o", c);
+    }
+    fputc('"', gen->file);
+}
+
+static void emit_bytes(CodeGenerator_t *gen, char *str, size_t len, bool terminate)
+{
+    bool in_quote = false;
+
+    if (gen->syntax == ASM_SYNTAX_GAS)
+        return emit_gas_bytes(gen, str, len, terminate);
+
+    fputs("db ", gen->file);
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char c = str[i];
+        if (isprint(c) && c != '\'')
+        {
+            if (!in_quote)
+                fputs(i ? ", \'" : "\'", gen->file);
+            fputc(c, gen->file);
+            in_quote = true;
+        }
+        else
+        {
+            if (in_quote)
+                fputc('\'', gen->file);
+            fprintf(gen->file, i ? ", %d" : "%d", c);
+            in_quote = false;
+        }
+    }
+    if (in_quote)
+        fputc('\'', gen->file);
+    if (terminate)
+        fputs(len ? ", 0" : "0", gen->file);
+}
+
+static void emit_str_pool(CodeGenerator_t *gen)
+{
+    ASMStrLit **lits = malloc(str_pool_count * sizeof(ASMStrLit *));
+
+    for (size_t i = 0; i < str_pool_count; i++)
+        lits[i] = StrPoolList(i);
+    qsort(lits, str_pool_count, sizeof(ASMStrLit *), str_lit_rev_cmp);
+
+    // Merge every literal into the longest literal ending with it
+    for (size_t i = str_pool_count - 1; i-- > 0;)
+    {
+        if (str_lit_is_suffix(lits[i], lits[i + 1]))
+            lits[i]->parent = lits[i + 1]->parent ? lits[i + 1]->parent : lits[i + 1];
+    }
+
+    // The suffixes of a literal are sorted right before it, shortest
+    // first, so they are walked backwards to label them in memory order
+    for (size_t i = 0; i < str_pool_count; i++)
+    {
+        ASMStrLit *root = lits[i];
+        size_t offset = 0;
+
+        if (root->parent != NULL)
+            continue;
+
+        for (size_t j = i; j-- > 0 && lits[j]->parent == root;)
+        {
+            size_t suffix_offset = root->len - lits[j]->len;
+            if (suffix_offset > offset)
+            {
+                fputc('\t', gen->file);
+                if (offset == 0)
+                    fprintf(gen->file, "%s: ", root->label);
+                emit_bytes(gen, root->str + offset, suffix_offset - offset, false);
+                fputc('\n', gen->file);
+                offset = suffix_offset;
+            }
+            fprintf(gen->file, "\t%s:\n", lits[j]->label);
+        }
+
+        fputc('\t', gen->file);
+        if (offset == 0)
+            fprintf(gen->file, "%s: ", root->label);
+        emit_bytes(gen, root->str + offset, root->len - offset, true);
+        fputc('\n', gen->file);
+    }
+    fputs("\n", gen->file);
+    free(lits);
+}
+
+// Labels of data symbols and functions are translated, string literal
+// labels are kept
+static char *value_label(CodeGenerator_t *gen, char *label)
+{
+    ASMSymbol *symbol = get_bss_symbol(label);
+
+    if (symbol != NULL)
+        return symbol->label;
+    return find_function(label) != NULL ? function_label(gen, label) : label;
+}
+
+static void emit_initialized_symbol(CodeGenerator_t *gen, ASMSymbol *symbol)
+{
+    char *directive = dialect(gen)->data[size_index(symbol->size)];
+
+    if (symbol->value_count == 0)
+        fprintf(gen->file, "\t%s:", symbol->label);
+    else
+        fprintf(gen->file, "\t%s: %s ", symbol->label, directive);
+    for (size_t i = 0; i < symbol->value_count; i++)
+    {
+        ASMSymbolValue *value = &symbol->values[i];
+        if (i && i % DATA_VALUES_PER_LINE == 0)
+            fprintf(gen->file, "\n\t%s ", directive);
+        else if (i)
+            fputs(", ", gen->file);
+        if (value->type == ASM_SYMBOL_ADDR && value->num)
+            fprintf(gen->file, "%s %c %ld", value_label(gen, value->label), value->num < 0 ? '-' : '+', labs(value->num));
+        else if (value->type == ASM_SYMBOL_ADDR)
+            fprintf(gen->file, "%s", value_label(gen, value->label));
+        else
+            fprintf(gen->file, "%ld", value->num);
+    }
+    fputs("\n", gen->file);
+
+    // Elements without an initializer are zero filled
+    if (symbol->number_of_items > symbol->value_count)
+        fprintf(gen->file, dialect(gen)->zero_fill, (symbol->number_of_items - symbol->value_count) * (symbol->size / 8));
+}
+
+static size_t data_alignment(CodeGenerator_t *gen, RegSize_e size, size_t number_of_items)
+{
+    size_t alignment = size / 8;
+    size_t total_size = alignment * number_of_items;
+
+    if (number_of_items > 1)
+    {
+        // The SysV ABI aligns arrays of 16 bytes or more to 16 bytes, large
+        // arrays can also be aligned further (e.g. to a cache line)
+        if (total_size >= 16 && alignment < 16)
+            alignment = 16;
+        if (total_size >= gen->array_alignment && alignment < gen->array_alignment)
+            alignment = gen->array_alignment;
+    }
+    return alignment;
+}
+
+static size_t symbol_alignment(CodeGenerator_t *gen, ASMSymbol *symbol)
+{
+    return data_alignment(gen, symbol->size, symbol->number_of_items);
+}
+
+static void emit_data_symbols(CodeGenerator_t *gen, bool read_only)
+{
+    size_t alignment;
+
+    for (int i = 0; i < asm_symbol_count; i++)
+    {
+        if (
+            asm_symbols[i].symbol_type == ASM_SYMBOL_UNINTIALIZED ||
+            asm_symbols[i].read_only != read_only)
+            continue;
+        alignment = symbol_alignment(gen, &asm_symbols[i]);
+        if (alignment > 1)
+            fprintf(gen->file, dialect(gen)->align, alignment);
+        emit_initialized_symbol(gen, &asm_symbols[i]);
+    }
+}
+
+void asm_start(CodeGenerator_t *gen)
+{
+    fputs(dialect(gen)->header, gen->file);
+}
+
 void asm_wrapup(CodeGenerator_t *gen)
 {
+    size_t alignment;
+
     fputs("\n", gen->file);
 
-    // Only add extern for the needed functions
-    fprintf(gen->file, "extern print\n");
-    fprintf(gen->file, "extern print_char\n");
-    fprintf(gen->file, "extern print_str\n");
-    fprintf(gen->file, "extern print_ln\n");
+    // Only the functions called without being defined are external
+    for (ASMFunction *function = function_list; function != NULL; function = function->next)
+    {
+        if (function->called && !function->defined)
+            fprintf(gen->file, dialect(gen)->extern_fn, function_label(gen, function->name));
+    }
     fprintf(gen->file, "\n");
     fprintf(gen->file, "\n");
 
     // Generate the `.bss` section for uninitialized variables
     if (asm_symbol_count)
     {
-        fprintf(gen->file, "section .bss\n");
+        fprintf(gen->file, dialect(gen)->section, ".bss");
         for (int i = 0; i < asm_symbol_count; i++)
         {
             if (asm_symbols[i].symbol_type != ASM_SYMBOL_UNINTIALIZED)
                 continue;
-            if (asm_symbols[i].size == SIZE_8bit)
-                fprintf(gen->file, "\t%s resb %d\n", asm_symbols[i].symbol_name, asm_symbols[i].number_of_items);
-            else if (asm_symbols[i].size == SIZE_16bit)
-                fprintf(gen->file, "\t%s resw %d\n", asm_symbols[i].symbol_name, asm_symbols[i].number_of_items);
-            else if (asm_symbols[i].size == SIZE_32bit)
-                fprintf(gen->file, "\t%s resd %d\n", asm_symbols[i].symbol_name, asm_symbols[i].number_of_items);
-            else if (asm_symbols[i].size == SIZE_64bit)
-                fprintf(gen->file, "\t%s resq %d\n", asm_symbols[i].symbol_name, asm_symbols[i].number_of_items);
-        }
-        fprintf(gen->file, "\n\nsection .data\n");
-        for (int i = 0; i < asm_symbol_count; i++)
-        {
-            if (asm_symbols[i].symbol_type == ASM_SYMBOL_UNINTIALIZED)
-                continue;
-            if (asm_symbols[i].symbol_type == ASM_SYMBOL_INT)
-            {
-                if (asm_symbols[i].size == SIZE_8bit)
-                    fprintf(gen->file, "\t%s db %d\n", asm_symbols[i].symbol_name, asm_symbols[i].value.num);
-                else if (asm_symbols[i].size == SIZE_16bit)
-                    fprintf(gen->file, "\t%s dw %d\n", asm_symbols[i].symbol_name, asm_symbols[i].value.num);
-                else if (asm_symbols[i].size == SIZE_32bit)
-                    fprintf(gen->file, "\t%s dd %d\n", asm_symbols[i].symbol_name, asm_symbols[i].value.num);
-                else if (asm_symbols[i].size == SIZE_64bit)
-                    fprintf(gen->file, "\t%s dq %d\n", asm_symbols[i].symbol_name, asm_symbols[i].value.num);
-            }
-            else if (asm_symbols[i].symbol_type == ASM_SYMBOL_STR)
-            {
-                fprintf(gen->file, "\t%s db \'%s\', 0\n", asm_symbols[i].symbol_name, asm_symbols[i].value.str);
-            }
+            alignment = symbol_alignment(gen, &asm_symbols[i]);
+            if (alignment > 1)
+                fprintf(gen->file, dialect(gen)->alignb, alignment);
+            fprintf(
+                gen->file, dialect(gen)->reserve, asm_symbols[i].label,
+                asm_symbols[i].number_of_items * (asm_symbols[i].size / 8));
         }
+        fprintf(gen->file, "\n\n");
+        fprintf(gen->file, dialect(gen)->section, ".data");
+        emit_data_symbols(gen, false);
     }
 
-    // Generate the `.data` section for uninitialized variables
-    fprintf(gen->file, "section .note.GNU-stack noalloc noexec nowrite progbits");
+    // const data and string literals can be shared between processes
+    fprintf(gen->file, "\n\n");
+    fprintf(gen->file, dialect(gen)->section, ".rodata");
+    emit_data_symbols(gen, true);
+    if (str_pool_count)
+        emit_str_pool(gen);
+
+    // Mark the stack as non executable
+    fputs(dialect(gen)->note_gnu_stack, gen->file);
+}
+
+static char *float_mov(RegSize_e size)
+{
+    return size == SIZE_32bit ? "movss" : "movsd";
+}
+
+// Scalar SSE2 instructions end with ss for float and sd for double
+static char *float_suffix(RegSize_e size)
+{
+    return size == SIZE_32bit ? "ss" : "sd";
 }
 
 static Register allocate_register(void)
@@ -130,10 +619,82 @@ static void free_register(Register r)
     free_reg[r] = 1;
 }
 
-Register asm_init_register(CodeGenerator_t *gen, int value)
+static Register allocate_xmm_register(void)
+{
+    for (Register i = 0; i < FLOAT_REG_COUNT; i++)
+    {
+        if (free_xmm_reg[i])
+        {
+            debug_print(SEV_DEBUG, "[ASM] Allocating register %s", xmm_list[i]);
+            free_xmm_reg[i] = 0;
+            return i;
+        }
+    }
+    debug_print(SEV_ERROR, "[ASM] Out of xmm registers!\n");
+    exit(1);
+}
+
+static void free_xmm_register(Register r)
+{
+    if (free_xmm_reg[r] != 0)
+    {
+        debug_print(SEV_ERROR, "[ASM] Error trying to free register %s\n", xmm_list[r]);
+        exit(1);
+    }
+    free_xmm_reg[r] = 1;
+}
+
+// Saves the xmm registers holding a value on the stack, in register order
+static void spill_float_registers(CodeGenerator_t *gen, int *spilled, size_t *space)
+{
+    size_t count = 0;
+
+    for (Register i = 0; i < FLOAT_REG_COUNT; i++)
+    {
+        spilled[i] = !free_xmm_reg[i];
+        count += spilled[i];
+    }
+    *space = (count * 8 + 15) / 16 * 16;
+    if (*space == 0)
+        return;
+    fprintf(gen->file, "\tsub rsp, %zu\n", *space);
+    count = 0;
+    for (Register i = 0; i < FLOAT_REG_COUNT; i++)
+    {
+        if (spilled[i])
+            fprintf(gen->file, "\tmovq %s [rsp + %zu], %s\n", mem_size(gen, SIZE_64bit), count++ * 8, xmm_list[i]);
+    }
+}
+
+static void restore_float_registers(CodeGenerator_t *gen, int *spilled, size_t space)
+{
+    size_t count = 0;
+
+    if (space == 0)
+        return;
+    for (Register i = 0; i < FLOAT_REG_COUNT; i++)
+    {
+        if (spilled[i])
+            fprintf(gen->file, "\tmovq %s, %s [rsp + %zu]\n", xmm_list[i], mem_size(gen, SIZE_64bit), count++ * 8);
+    }
+    fprintf(gen->file, "\tadd rsp, %zu\n", space);
+}
+
+Register asm_init_register(CodeGenerator_t *gen, long value)
 {
     Register r = allocate_register();
-    fprintf(gen->file, "\tmov %s, %d\n", reg_list[r], value);
+    if (value >= 0 && value <= 0xFFFFFFFFL)
+        fprintf(gen->file, "\tmov %s, %ld\n", dreg_list[r], value);
+    else
+        fprintf(gen->file, "\tmov %s, %ld\n", reg_list[r], value);
+    return r;
+}
+
+Register asm_sign_extend(CodeGenerator_t *gen, Register r, RegSize_e from, RegSize_e to)
+{
+    if (from == to || to != SIZE_64bit)
+        return r;
+    fprintf(gen->file, "\tmovsxd %s, %s\n", reg_list[r], dreg_list[r]);
     return r;
 }
 
@@ -152,79 +713,143 @@ void asm_set_register(CodeGenerator_t *gen, Register dest, Register src, RegSize
         free_register(src);
 }
 
-Register asm_add(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_add(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    fprintf(gen->file, "\tadd %s, %s\n", reg_list[r1], reg_list[r2]);
+    fprintf(gen->file, "\tadd %s, %s\n", op_reg(r1, size), op_reg(r2, size));
     free_register(r2);
     return r1;
 }
 
-Register asm_sub(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_sub(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    fprintf(gen->file, "\tsub %s, %s\n", reg_list[r1], reg_list[r2]);
+    fprintf(gen->file, "\tsub %s, %s\n", op_reg(r1, size), op_reg(r2, size));
     free_register(r2);
     return r1;
 }
 
-Register asm_mul(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_mul(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    fprintf(gen->file, "\timul %s, %s\n", reg_list[r1], reg_list[r2]);
+    fprintf(gen->file, "\timul %s, %s\n", op_reg(r1, size), op_reg(r2, size));
     free_register(r2);
     return r1;
 }
 
-Register asm_div(CodeGenerator_t *gen, Register r1, Register r2)
+// idiv and div leave the quotient in rax and the remainder in rdx, neither
+// of them is allocated to values
+static Register asm_divide(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size, bool is_unsigned, bool remainder)
 {
-    fprintf(gen->file, "\tmov rax, %s\n", reg_list[r1]);
-    fprintf(gen->file, "\tcqo\n");
-    fprintf(gen->file, "\tidiv %s\n", reg_list[r2]);
-    fprintf(gen->file, "\tmov %s, rax\n", reg_list[r1]);
+    char *result = size == SIZE_64bit ? (remainder ? "rdx" : "rax") : (remainder ? "edx" : "eax");
+
+    fprintf(gen->file, "\tmov %s, %s\n", op_reg(asm_RAX, size), op_reg(r1, size));
+    if (is_unsigned)
+        fprintf(gen->file, "\txor edx, edx\n");
+    else
+        fprintf(gen->file, "\t%s\n", size == SIZE_64bit ? "cqo" : "cdq");
+    fprintf(gen->file, "\t%s %s\n", is_unsigned ? "div" : "idiv", op_reg(r2, size));
+    fprintf(gen->file, "\tmov %s, %s\n", op_reg(r1, size), result);
     free_register(r2);
     return r1;
 }
 
+Register asm_div(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_divide(gen, r1, r2, size, false, false);
+}
+
+Register asm_udiv(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_divide(gen, r1, r2, size, true, false);
+}
+
+Register asm_mod(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_divide(gen, r1, r2, size, false, true);
+}
+
+Register asm_umod(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_divide(gen, r1, r2, size, true, true);
+}
+
 void asm_sll(CodeGenerator_t *gen, Register r1, __uint8_t val)
 {
     fprintf(gen->file, "\tshl %s, %d\n", reg_list[r1], val);
 }
 
-static Register asm_comp(CodeGenerator_t *gen, Register r1, Register r2, char *func)
+void asm_srl(CodeGenerator_t *gen, Register r1, __uint8_t val, RegSize_e size)
+{
+    fprintf(gen->file, "\tshr %s, %d\n", op_reg(r1, size), val);
+}
+
+// and sign extends its 32-bit immediate, wider masks go through rax
+void asm_and(CodeGenerator_t *gen, Register r1, long mask, RegSize_e size)
+{
+    if (mask >= 0 && mask <= INT32_MAX)
+    {
+        fprintf(gen->file, "\tand %s, %ld\n", op_reg(r1, size), mask);
+        return;
+    }
+    fprintf(gen->file, "\tmov rax, %ld\n", mask);
+    fprintf(gen->file, "\tand %s, rax\n", reg_list[r1]);
+}
+
+static Register asm_comp(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size, char *func)
 {
-    fprintf(gen->file, "\tcmp %s, %s\n", reg_list[r1], reg_list[r2]);
+    fprintf(gen->file, "\tcmp %s, %s\n", op_reg(r1, size), op_reg(r2, size));
     fprintf(gen->file, "\t%s %s\n", func, breg_list[r1]);
-    fprintf(gen->file, "\tmovzx %s, %s \n", reg_list[r1], breg_list[r1]);
+    fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[r1], breg_list[r1]);
     free_register(r2);
     return r1;
 }
 
-Register asm_comp_eq(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_comp_eq(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_comp(gen, r1, r2, size, "sete");
+}
+
+Register asm_comp_ne(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_comp(gen, r1, r2, size, "setne");
+}
+
+Register asm_comp_gt(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_comp(gen, r1, r2, size, "setg");
+}
+
+Register asm_comp_ge(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    return asm_comp(gen, r1, r2, "sete");
+    return asm_comp(gen, r1, r2, size, "setge");
 }
 
-Register asm_comp_ne(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_comp_lt(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    return asm_comp(gen, r1, r2, "setne");
+    return asm_comp(gen, r1, r2, size, "setl");
 }
 
-Register asm_comp_gt(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_comp_le(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    return asm_comp(gen, r1, r2, "setg");
+    return asm_comp(gen, r1, r2, size, "setle");
 }
 
-Register asm_comp_ge(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_comp_ugt(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    return asm_comp(gen, r1, r2, "setge");
+    return asm_comp(gen, r1, r2, size, "seta");
 }
 
-Register asm_comp_lt(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_comp_uge(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    return asm_comp(gen, r1, r2, "setl");
+    return asm_comp(gen, r1, r2, size, "setae");
 }
 
-Register asm_comp_le(CodeGenerator_t *gen, Register r1, Register r2)
+Register asm_comp_ult(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
 {
-    return asm_comp(gen, r1, r2, "setle");
+    return asm_comp(gen, r1, r2, size, "setb");
+}
+
+Register asm_comp_ule(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size)
+{
+    return asm_comp(gen, r1, r2, size, "setbe");
 }
 
 static void asm_jmp_with_cond(CodeGenerator_t *gen, Register r1, int comp_val, char *func, unsigned int label_number)
@@ -259,7 +884,14 @@ void asm_add_global_var(CodeGenerator_t *gen, char *var_name, RegSize_e size, si
         exit(0);
     }
     debug_print(SEV_DEBUG, "Adding symbol %s in bss section", var_name);
+    if (asm_symbol_count == asm_symbol_capacity)
+    {
+        asm_symbol_capacity = asm_symbol_capacity ? asm_symbol_capacity * 2 : 256;
+        asm_symbols = realloc(asm_symbols, asm_symbol_capacity * sizeof(ASMSymbol));
+    }
+    memset(&asm_symbols[asm_symbol_count], 0, sizeof(ASMSymbol));
     asm_symbols[asm_symbol_count].symbol_name = strdup(var_name);
+    asm_symbols[asm_symbol_count].label = symbol_label(gen, var_name);
     asm_symbols[asm_symbol_count].size = size;
     asm_symbols[asm_symbol_count].number_of_items = number_of_elements;
     asm_symbol_count++;
@@ -274,45 +906,114 @@ void asm_set_global_var(CodeGenerator_t *gen, char *var_name, Register r)
         exit(1);
     }
     if (symbol->size == SIZE_64bit)
-        fprintf(gen->file, "\tmov [%s], %s\n", var_name, reg_list[r]);
+        fprintf(gen->file, "\tmov [%s], %s\n", symbol->label, reg_list[r]);
     else if (symbol->size == SIZE_32bit)
-        fprintf(gen->file, "\tmov [%s], %s\n", var_name, dreg_list[r]);
+        fprintf(gen->file, "\tmov [%s], %s\n", symbol->label, dreg_list[r]);
     else if (symbol->size == SIZE_16bit)
-        fprintf(gen->file, "\tmov [%s], %s\n", var_name, wreg_list[r]);
+        fprintf(gen->file, "\tmov [%s], %s\n", symbol->label, wreg_list[r]);
     else if (symbol->size == SIZE_8bit)
-        fprintf(gen->file, "\tmov [%s], %s\n", var_name, breg_list[r]);
+        fprintf(gen->file, "\tmov [%s], %s\n", symbol->label, breg_list[r]);
     free_register(r);
 }
 
-void asm_set_global_var_initial_val(CodeGenerator_t *gen, char *var_name, ASMSymbolValue value, ASMSymbolType type)
+void asm_set_global_var_initial_val(char *var_name, ASMSymbolValue *values, size_t count)
 {
     ASMSymbol *symbol = get_bss_symbol(var_name);
-    if (type == ASM_SYMBOL_INT)
+    if (symbol == NULL)
+    {
+        debug_print(SEV_ERROR, "[ASM] Symbol is not defined before!!");
+        exit(1);
+    }
+    if (count > symbol->number_of_items)
     {
-        symbol->value = value;
-        symbol->symbol_type = type;
+        debug_print(SEV_ERROR, "[ASM] Too many initial values for %s", var_name);
+        exit(1);
     }
-    else if (type == ASM_SYMBOL_STR)
+    for (size_t i = 0; i < count; i++)
     {
-        char *new_str_lbl = asm_generate_string_lit(gen, value.str);
-        asm_set_global_var(gen, var_name, asm_address_of(gen, new_str_lbl));
-        free(new_str_lbl);
+        if (values[i].type == ASM_SYMBOL_ADDR && symbol->size != SIZE_64bit)
+        {
+            debug_print(SEV_ERROR, "[ASM] Can't initialize %s with an address", var_name);
+            exit(1);
+        }
     }
-}
 
-char *asm_generate_string_lit(CodeGenerator_t *gen, char *str)
-{
-    LabelId lbl = asm_generate_label();
-    char *new_str_lbl = malloc(100 * sizeof(char));
-    snprintf(new_str_lbl, 99, "__%d__STR_CONST__", lbl);
-    asm_add_global_var(gen, new_str_lbl, SIZE_8bit, 1);
-    ASMSymbol *val_symbol = get_bss_symbol(new_str_lbl);
-    val_symbol->value = (ASMSymbolValue)str;
-    val_symbol->symbol_type = ASM_SYMBOL_STR;
-    return new_str_lbl;
+    symbol->values = count ? malloc(count * sizeof(ASMSymbolValue)) : NULL;
+    memcpy(symbol->values, values, count * sizeof(ASMSymbolValue));
+    symbol->value_count = count;
+    symbol->symbol_type = ASM_SYMBOL_INT;
 }
 
-Register asm_get_global_var(CodeGenerator_t *gen, char *var_name)
+void asm_set_global_var_readonly(char *var_name)
+{
+    ASMSymbol *symbol = get_bss_symbol(var_name);
+    if (symbol == NULL)
+    {
+        debug_print(SEV_ERROR, "[ASM] Symbol is not defined before!!");
+        exit(1);
+    }
+
+    // Read only symbols are always emitted with their initial value
+    symbol->symbol_type = ASM_SYMBOL_INT;
+    symbol->read_only = true;
+}
+
+static void record_str_lit(ASMStrLit *lit)
+{
+    if (recording == NULL)
+        return;
+    for (size_t i = 0; i < recording->str_count; i++)
+    {
+        if (recording->strs[i].id == lit->id)
+            return;
+    }
+    recording->strs = realloc(recording->strs, (recording->str_count + 1) * sizeof(ASMRecordStr));
+    recording->strs[recording->str_count].id = lit->id;
+    recording->strs[recording->str_count].str = lit->str;
+    recording->str_count++;
+}
+
+// Returns the label of `str` in the literal pool, a literal seen for the
+// first time is labelled `id`, or a new label when `id` is NULL
+static char *pool_string_lit(char *str, const LabelId *id)
+{
+    size_t len = strlen(str);
+    __uint32_t hash = str_hash(str, len);
+    ASMStrLit **bucket = &str_pool[hash % STR_POOL_BUCKETS];
+
+    for (ASMStrLit *lit = *bucket; lit != NULL; lit = lit->bucket_next)
+    {
+        if (lit->hash == hash && lit->len == len && memcmp(lit->str, str, len) == 0)
+        {
+            record_str_lit(lit);
+            return lit->label;
+        }
+    }
+
+    if (str_pool_count == 0)
+        darray_init(&str_pool_list, STR_POOL_INIT_SIZE, sizeof(ASMStrLit *));
+
+    ASMStrLit *lit = (ASMStrLit *)calloc(1, sizeof(ASMStrLit));
+    lit->str = str;
+    lit->len = len;
+    lit->hash = hash;
+    lit->id = id != NULL ? *id : asm_generate_label();
+    lit->label = malloc(32 * sizeof(char));
+    snprintf(lit->label, 32, "__%d__STR_CONST__", lit->id);
+    lit->bucket_next = *bucket;
+    *bucket = lit;
+    StrPoolList(str_pool_count++) = lit;
+    debug_print(SEV_DEBUG, "Adding string literal %s in the literal pool", lit->label);
+    record_str_lit(lit);
+    return lit->label;
+}
+
+char *asm_generate_string_lit(char *str)
+{
+    return pool_string_lit(str, NULL);
+}
+
+Register asm_get_global_var(CodeGenerator_t *gen, char *var_name)
 {
     Register r = allocate_register();
     ASMSymbol *symbol = get_bss_symbol(var_name);
@@ -321,34 +1022,115 @@ Register asm_get_global_var(CodeGenerator_t *gen, char *var_name)
         debug_print(SEV_ERROR, "[ASM] Symbol is not defined before!!");
         exit(1);
     }
-    // TODO: Check we need this xor command ??!!
-    fprintf(gen->file, "\txor %s, %s\n", reg_list[r], reg_list[r]);
 
     switch (symbol->symbol_type)
     {
     case ASM_SYMBOL_INT:
+    case ASM_SYMBOL_ADDR:
     case ASM_SYMBOL_UNINTIALIZED:
         if (symbol->size == SIZE_64bit)
-            fprintf(gen->file, "\tmov %s, [%s]\n", reg_list[r], var_name);
+            fprintf(gen->file, "\tmov %s, [%s]\n", reg_list[r], symbol->label);
         else if (symbol->size == SIZE_32bit)
-            fprintf(gen->file, "\tmov %s, [%s]\n", dreg_list[r], var_name);
+            fprintf(gen->file, "\tmov %s, [%s]\n", dreg_list[r], symbol->label);
         else if (symbol->size == SIZE_16bit)
-            fprintf(gen->file, "\tmov %s, [%s]\n", wreg_list[r], var_name);
+            fprintf(gen->file, "\tmovzx %s, %s [%s]\n", dreg_list[r], mem_size(gen, SIZE_16bit), symbol->label);
         else if (symbol->size == SIZE_8bit)
-            fprintf(gen->file, "\tmov %s, [%s]\n", breg_list[r], var_name);
-        break;
-    case ASM_SYMBOL_STR:
-        fprintf(gen->file, "\tlea %s, [%s]\n", reg_list[r], var_name);
+            fprintf(gen->file, "\tmovzx %s, %s [%s]\n", dreg_list[r], mem_size(gen, SIZE_8bit), symbol->label);
         break;
     }
 
     return r;
 }
 
+void asm_add_local_array(CodeGenerator_t *gen, char *var_name, RegSize_e size, size_t number_of_elements)
+{
+    size_t alignment = data_alignment(gen, size, number_of_elements);
+    size_t bytes = (size / 8) * number_of_elements;
+    ASMLocalArray *array;
+
+    if (local_array_count == local_array_capacity)
+    {
+        local_array_capacity = local_array_capacity ? local_array_capacity * 2 : 8;
+        local_arrays = realloc(local_arrays, local_array_capacity * sizeof(ASMLocalArray));
+    }
+    array = &local_arrays[local_array_count++];
+    array->name = var_name;
+    array->alignment = alignment > 16 ? alignment : 0;
+    if (alignment > 16)
+        bytes += alignment - 16;
+
+    // Every array takes a multiple of 16 bytes, so each one starts 16 byte
+    // aligned right below the previous one
+    local_arrays_size += (bytes + 15) / 16 * 16;
+    array->offset = GLOBAL_REG_COUNT * 8 + local_arrays_size;
+}
+
+static ASMLocalArray *get_local_array(char *var_name)
+{
+    for (size_t i = 0; i < local_array_count; i++)
+    {
+        if (strcmp(local_arrays[i].name, var_name) == 0)
+            return &local_arrays[i];
+    }
+    return NULL;
+}
+
+bool asm_is_local_array(char *var_name)
+{
+    return get_local_array(var_name) != NULL;
+}
+
+// Over-aligned arrays are found by rounding up the start of their room
+static void local_array_address(CodeGenerator_t *gen, ASMLocalArray *array, char *out)
+{
+    if (array->alignment == 0)
+    {
+        fprintf(gen->file, "\tlea %s, [rbp - %zu]\n", out, array->offset);
+        return;
+    }
+    fprintf(gen->file, "\tlea %s, [rbp - %zu]\n", out, array->offset - (array->alignment - 16));
+    fprintf(gen->file, "\tand %s, %ld\n", out, -(long)array->alignment);
+}
+
+Register asm_local_array_index(CodeGenerator_t *gen, char *var_name, Register index, size_t scale)
+{
+    ASMLocalArray *array = get_local_array(var_name);
+
+    if (array->alignment == 0)
+    {
+        fprintf(gen->file, "\tlea %s, [rbp + %s * %zu - %zu]\n", reg_list[index], reg_list[index], scale, array->offset);
+        return index;
+    }
+    local_array_address(gen, array, "rax");
+    fprintf(gen->file, "\tlea %s, [rax + %s * %zu]\n", reg_list[index], reg_list[index], scale);
+    return index;
+}
+
+void asm_zero_local_array(CodeGenerator_t *gen, char *var_name, size_t bytes)
+{
+    local_array_address(gen, get_local_array(var_name), "rdi");
+    fputs("\txor eax, eax\n", gen->file);
+    fprintf(gen->file, "\tmov ecx, %zu\n", bytes);
+    fputs("\trep stosb\n", gen->file);
+}
+
+void asm_reference_function(char *func_name)
+{
+    get_function(func_name)->called = true;
+    record_call(func_name);
+}
+
 Register asm_address_of(CodeGenerator_t *gen, char *var_name)
 {
     Register out = allocate_register();
-    fprintf(gen->file, "\tlea %s, [%s]\n", reg_list[out], var_name);
+    ASMLocalArray *array = get_local_array(var_name);
+
+    if (array != NULL)
+    {
+        local_array_address(gen, array, reg_list[out]);
+        return out;
+    }
+    fprintf(gen->file, "\tlea %s, [%s]\n", reg_list[out], value_label(gen, var_name));
     return out;
 }
 
@@ -358,16 +1140,12 @@ Register asm_load_mem(CodeGenerator_t *gen, Register addr, RegSize_e size)
     switch (size)
     {
     case SIZE_8bit:
-        fprintf(gen->file, "\tmov %s, byte [%s]\n", breg_list[out], reg_list[addr]);
-        break;
     case SIZE_16bit:
-        fprintf(gen->file, "\tmov %s, word [%s]\n", wreg_list[out], reg_list[addr]);
+        fprintf(gen->file, "\tmovzx %s, %s [%s]\n", dreg_list[out], mem_size(gen, size), reg_list[addr]);
         break;
     case SIZE_32bit:
-        fprintf(gen->file, "\tmov %s, dword [%s]\n", dreg_list[out], reg_list[addr]);
-        break;
     case SIZE_64bit:
-        fprintf(gen->file, "\tmov %s, qword [%s]\n", reg_list[out], reg_list[addr]);
+        fprintf(gen->file, "\tmov %s, %s [%s]\n", sized_reg(out, size), mem_size(gen, size), reg_list[addr]);
         break;
     }
     free_register(addr);
@@ -376,23 +1154,246 @@ Register asm_load_mem(CodeGenerator_t *gen, Register addr, RegSize_e size)
 
 void asm_store_mem(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size)
 {
-    switch (size)
+    fprintf(gen->file, "\tmov %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(val, size));
+    free_register(val);
+    free_register(addr);
+}
+
+// The bits are moved through rax, zero is the only constant an SSE register
+// can be set to directly
+Register asm_init_float(CodeGenerator_t *gen, long bits)
+{
+    Register x = allocate_xmm_register();
+    if (bits == 0)
     {
-    case SIZE_8bit:
-        fprintf(gen->file, "\tmov byte [%s], %s\n", reg_list[addr], breg_list[val]);
-        break;
-    case SIZE_16bit:
-        fprintf(gen->file, "\tmov word [%s], %s\n", reg_list[addr], wreg_list[val]);
-        break;
-    case SIZE_32bit:
-        fprintf(gen->file, "\tmov dword [%s], %s\n", reg_list[addr], dreg_list[val]);
-        break;
-    case SIZE_64bit:
-        fprintf(gen->file, "\tmov qword [%s], %s\n", reg_list[addr], reg_list[val]);
-        break;
+        fprintf(gen->file, "\tpxor %s, %s\n", xmm_list[x], xmm_list[x]);
+        return x;
     }
-    free_register(val);
+    fprintf(gen->file, "\tmov rax, %ld\n", bits);
+    fprintf(gen->file, "\tmovq %s, rax\n", xmm_list[x]);
+    return x;
+}
+
+Register asm_get_float_var(CodeGenerator_t *gen, char *var_name)
+{
+    ASMSymbol *symbol = get_bss_symbol(var_name);
+    Register x;
+
+    if (symbol == NULL)
+    {
+        debug_print(SEV_ERROR, "[ASM] Symbol is not defined before!!");
+        exit(1);
+    }
+    x = allocate_xmm_register();
+    fprintf(gen->file, "\t%s %s, %s [%s]\n", float_mov(symbol->size), xmm_list[x], mem_size(gen, symbol->size), symbol->label);
+    return x;
+}
+
+void asm_set_float_var(CodeGenerator_t *gen, char *var_name, Register x)
+{
+    ASMSymbol *symbol = get_bss_symbol(var_name);
+    if (symbol == NULL)
+    {
+        debug_print(SEV_ERROR, "[ASM] Symbol is not defined before!!");
+        exit(1);
+    }
+    fprintf(gen->file, "\t%s %s [%s], %s\n", float_mov(symbol->size), mem_size(gen, symbol->size), symbol->label, xmm_list[x]);
+    free_xmm_register(x);
+}
+
+Register asm_load_float(CodeGenerator_t *gen, Register addr, RegSize_e size)
+{
+    Register x = allocate_xmm_register();
+    fprintf(gen->file, "\t%s %s, %s [%s]\n", float_mov(size), xmm_list[x], mem_size(gen, size), reg_list[addr]);
     free_register(addr);
+    return x;
+}
+
+void asm_store_float(CodeGenerator_t *gen, Register addr, Register x, RegSize_e size)
+{
+    fprintf(gen->file, "\t%s %s [%s], %s\n", float_mov(size), mem_size(gen, size), reg_list[addr], xmm_list[x]);
+    free_xmm_register(x);
+    free_register(addr);
+}
+
+static Register asm_float_op(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size, char *op)
+{
+    fprintf(gen->file, "\t%s%s %s, %s\n", op, float_suffix(size), xmm_list[x1], xmm_list[x2]);
+    free_xmm_register(x2);
+    return x1;
+}
+
+Register asm_float_add(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_op(gen, x1, x2, size, "add");
+}
+
+Register asm_float_sub(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_op(gen, x1, x2, size, "sub");
+}
+
+Register asm_float_mul(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_op(gen, x1, x2, size, "mul");
+}
+
+Register asm_float_div(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_op(gen, x1, x2, size, "div");
+}
+
+// ucomis sets the flags like an unsigned comparison, and ZF, PF and CF when
+// the operands are unordered. Only `above` conditions are false for NaN, so
+// less-than comparisons swap their operands
+static Register asm_float_comp(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size, char *func)
+{
+    Register r = allocate_register();
+    fprintf(gen->file, "\tucomi%s %s, %s\n", float_suffix(size), xmm_list[x1], xmm_list[x2]);
+    fprintf(gen->file, "\t%s %s\n", func, breg_list[r]);
+    fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[r], breg_list[r]);
+    free_xmm_register(x1);
+    free_xmm_register(x2);
+    return r;
+}
+
+// Equality also checks the parity flag, NaN is different from everything
+static Register asm_float_comp_parity(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size, char *func, char *parity, char *merge)
+{
+    Register r = allocate_register();
+    fprintf(gen->file, "\tucomi%s %s, %s\n", float_suffix(size), xmm_list[x1], xmm_list[x2]);
+    fprintf(gen->file, "\t%s %s\n", func, breg_list[r]);
+    fprintf(gen->file, "\t%s al\n", parity);
+    fprintf(gen->file, "\t%s %s, al\n", merge, breg_list[r]);
+    fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[r], breg_list[r]);
+    free_xmm_register(x1);
+    free_xmm_register(x2);
+    return r;
+}
+
+Register asm_float_comp_eq(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_comp_parity(gen, x1, x2, size, "sete", "setnp", "and");
+}
+
+Register asm_float_comp_ne(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_comp_parity(gen, x1, x2, size, "setne", "setp", "or");
+}
+
+Register asm_float_comp_gt(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_comp(gen, x1, x2, size, "seta");
+}
+
+Register asm_float_comp_ge(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_comp(gen, x1, x2, size, "setae");
+}
+
+Register asm_float_comp_lt(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_comp(gen, x2, x1, size, "seta");
+}
+
+Register asm_float_comp_le(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size)
+{
+    return asm_float_comp(gen, x2, x1, size, "setae");
+}
+
+// cvtsi2s* only writes the low part of its destination, clearing it first
+// breaks the dependency on the previous value of the register
+Register asm_int_to_float(CodeGenerator_t *gen, Register r, RegSize_e from, RegSize_e to)
+{
+    Register x = allocate_xmm_register();
+    fprintf(gen->file, "\tpxor %s, %s\n", xmm_list[x], xmm_list[x]);
+    fprintf(gen->file, "\tcvtsi2%s %s, %s\n", float_suffix(to), xmm_list[x], op_reg(r, from));
+    free_register(r);
+    return x;
+}
+
+// Converts with truncation, narrow results are kept zero-extended
+Register asm_float_to_int(CodeGenerator_t *gen, Register x, RegSize_e from, RegSize_e to)
+{
+    Register r = allocate_register();
+    fprintf(gen->file, "\tcvtt%s2si %s, %s\n", float_suffix(from), op_reg(r, to), xmm_list[x]);
+    if (to == SIZE_8bit || to == SIZE_16bit)
+        fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[r], sized_reg(r, to));
+    free_xmm_register(x);
+    return r;
+}
+
+// Narrower unsigned values are zero-extended so the 64-bit conversion is
+// exact. An unsigned long with the sign bit set is halved first, keeping
+// the low bit for the rounding, then doubled back
+Register asm_uint_to_float(CodeGenerator_t *gen, Register r, RegSize_e from, RegSize_e to)
+{
+    LabelId big, done;
+    Register x;
+
+    if (from != SIZE_64bit)
+        return asm_int_to_float(gen, r, SIZE_64bit, to);
+
+    x = allocate_xmm_register();
+    big = asm_generate_label();
+    done = asm_generate_label();
+    fprintf(gen->file, "\tpxor %s, %s\n", xmm_list[x], xmm_list[x]);
+    fprintf(gen->file, "\ttest %s, %s\n", reg_list[r], reg_list[r]);
+    fprintf(gen->file, "\tjs __label__%d\n", big);
+    fprintf(gen->file, "\tcvtsi2%s %s, %s\n", float_suffix(to), xmm_list[x], reg_list[r]);
+    asm_jmp(gen, done);
+    asm_lbl(gen, big);
+    fprintf(gen->file, "\tmov rax, %s\n", reg_list[r]);
+    fprintf(gen->file, "\tshr rax, 1\n");
+    fprintf(gen->file, "\tand %s, 1\n", dreg_list[r]);
+    fprintf(gen->file, "\tor rax, %s\n", reg_list[r]);
+    fprintf(gen->file, "\tcvtsi2%s %s, rax\n", float_suffix(to), xmm_list[x]);
+    fprintf(gen->file, "\tadd%s %s, %s\n", float_suffix(to), xmm_list[x], xmm_list[x]);
+    asm_lbl(gen, done);
+    free_register(r);
+    return x;
+}
+
+// Narrower unsigned results come from the 64-bit conversion. Values of at
+// least 2^63 are converted to unsigned longs after subtracting 2^63
+Register asm_float_to_uint(CodeGenerator_t *gen, Register x, RegSize_e from, RegSize_e to)
+{
+    LabelId big, done;
+    Register r, limit;
+
+    if (to != SIZE_64bit)
+    {
+        r = asm_float_to_int(gen, x, from, SIZE_64bit);
+        if (to == SIZE_32bit)
+            fprintf(gen->file, "\tmov %s, %s\n", dreg_list[r], dreg_list[r]);
+        else
+            fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[r], sized_reg(r, to));
+        return r;
+    }
+
+    r = allocate_register();
+    limit = asm_init_float(gen, from == SIZE_64bit ? 0x43e0000000000000L : 0x5f000000L);
+    big = asm_generate_label();
+    done = asm_generate_label();
+    fprintf(gen->file, "\tucomi%s %s, %s\n", float_suffix(from), xmm_list[x], xmm_list[limit]);
+    fprintf(gen->file, "\tjae __label__%d\n", big);
+    fprintf(gen->file, "\tcvtt%s2si %s, %s\n", float_suffix(from), reg_list[r], xmm_list[x]);
+    asm_jmp(gen, done);
+    asm_lbl(gen, big);
+    fprintf(gen->file, "\tsub%s %s, %s\n", float_suffix(from), xmm_list[x], xmm_list[limit]);
+    fprintf(gen->file, "\tcvtt%s2si %s, %s\n", float_suffix(from), reg_list[r], xmm_list[x]);
+    fprintf(gen->file, "\tbtc %s, 63\n", reg_list[r]);
+    asm_lbl(gen, done);
+    free_xmm_register(limit);
+    free_xmm_register(x);
+    return r;
+}
+
+Register asm_float_convert(CodeGenerator_t *gen, Register x, RegSize_e from, RegSize_e to)
+{
+    if (from != to)
+        fprintf(gen->file, "\tcvt%s2%s %s, %s\n", float_suffix(from), float_suffix(to), xmm_list[x], xmm_list[x]);
+    return x;
 }
 
 LabelId asm_generate_label()
@@ -405,54 +1406,609 @@ void asm_lbl(CodeGenerator_t *gen, LabelId lbl_id)
     fprintf(gen->file, "__label__%d:\n", lbl_id);
 }
 
-void asm_generate_function_prologue(CodeGenerator_t *gen, char *func_name)
+// Integer parameters come in the general purpose argument registers and
+// floating point ones in xmm0-xmm7, in order. The ones that don't fit were
+// pushed by the caller above the return address, in order too
+static size_t place_params(size_t param_count, bool *float_params)
+{
+    size_t int_count = 0, float_count = 0, stack_count = 0, reg_count = 0;
+
+    if (param_count > param_location_capacity)
+    {
+        param_location_capacity = param_count;
+        param_locations = realloc(param_locations, param_count * sizeof(long));
+    }
+    for (size_t i = 0; i < param_count; i++)
+    {
+        bool is_float = float_params != NULL && float_params[i];
+        if ((is_float && float_count < FLOAT_ARG_REG_COUNT) || (!is_float && int_count < ARG_REG_COUNT))
+        {
+            *(is_float ? &float_count : &int_count) += 1;
+            param_locations[i] = -(long)(GLOBAL_REG_COUNT * 8 + local_arrays_size + 8 + reg_count * 8);
+            reg_count++;
+        }
+        else
+            param_locations[i] = 16 + stack_count++ * 8;
+    }
+    return reg_count;
+}
+
+void asm_generate_function_prologue(CodeGenerator_t *gen, char *func_name, size_t param_count, bool *float_params)
 {
-    fputs("section\t.text\n", gen->file);
-    fprintf(gen->file, "global\t%s\n", func_name);
-    fprintf(gen->file, "%s:\n", func_name);
+    size_t reg_params = place_params(param_count, float_params);
+    size_t int_count = 0, float_count = 0;
+
+    get_function(func_name)->defined = true;
+    fprintf(gen->file, dialect(gen)->section, ".text");
+    fprintf(gen->file, dialect(gen)->global, function_label(gen, func_name));
+    fprintf(gen->file, "%s:\n", function_label(gen, func_name));
     fputs("\tpush rbp\n", gen->file);
     fputs("\tmov rbp, rsp\n", gen->file);
+
+    // r12-r15 are callee saved, the caller may be holding values in them
+    // across the call. Four pushes keep the stack 16 byte aligned
+    for (Register i = 0; i < GLOBAL_REG_COUNT; i++)
+        fprintf(gen->file, "\tpush %s\n", reg_list[i]);
+
+    // The argument registers are clobbered by every call, the parameters
+    // passed in them are spilled below the local arrays
+    frame_size = local_arrays_size + (reg_params * 8 + 15) / 16 * 16;
+    if (frame_size)
+        fprintf(gen->file, "\tsub rsp, %zu\n", frame_size);
+    for (size_t i = 0; i < param_count; i++)
+    {
+        if (param_locations[i] > 0)
+            continue;
+        if (float_params != NULL && float_params[i])
+            fprintf(gen->file, "\tmovq %s [rbp - %ld], %s\n", mem_size(gen, SIZE_64bit), -param_locations[i], float_arg_reg_list[float_count++]);
+        else
+            fprintf(gen->file, "\tmov %s [rbp - %ld], %s\n", mem_size(gen, SIZE_64bit), -param_locations[i], arg_reg_list[int_count++]);
+    }
 }
 
 void asm_generate_function_epilogue(CodeGenerator_t *gen)
 {
+    if (frame_size)
+        fprintf(gen->file, "\tlea rsp, [rbp - %d]\n", GLOBAL_REG_COUNT * 8);
+    for (Register i = GLOBAL_REG_COUNT; i > 0; i--)
+        fprintf(gen->file, "\tpop %s\n", reg_list[i - 1]);
     fputs("\tpop rbp\n", gen->file);
     fputs("\tret\n\n", gen->file);
+
+    // No value outlives the function, returned values are never freed so
+    // release everything here or every function would leak a register
+    for (Register i = 0; i < GLOBAL_REG_COUNT; i++)
+        free_reg[i] = 1;
+    for (Register i = 0; i < FLOAT_REG_COUNT; i++)
+        free_xmm_reg[i] = 1;
+    local_array_count = 0;
+    local_arrays_size = 0;
+}
+
+static char *param_operand(size_t index)
+{
+    static char operand[32];
+    long offset = param_locations[index];
+    snprintf(operand, sizeof(operand), "[rbp %c %ld]", offset < 0 ? '-' : '+', labs(offset));
+    return operand;
+}
+
+Register asm_get_param(CodeGenerator_t *gen, size_t index, RegSize_e size)
+{
+    Register r = allocate_register();
+    if (size == SIZE_8bit || size == SIZE_16bit)
+        fprintf(gen->file, "\tmovzx %s, %s %s\n", dreg_list[r], mem_size(gen, size), param_operand(index));
+    else
+        fprintf(gen->file, "\tmov %s, %s %s\n", sized_reg(r, size), mem_size(gen, size), param_operand(index));
+    return r;
+}
+
+void asm_set_param(CodeGenerator_t *gen, size_t index, Register r)
+{
+    // The whole slot is written, values are kept extended to 64 bits
+    fprintf(gen->file, "\tmov %s %s, %s\n", mem_size(gen, SIZE_64bit), param_operand(index), reg_list[r]);
+    free_register(r);
+}
+
+Register asm_get_float_param(CodeGenerator_t *gen, size_t index, RegSize_e size)
+{
+    Register x = allocate_xmm_register();
+    fprintf(gen->file, "\t%s %s, %s %s\n", float_mov(size), xmm_list[x], mem_size(gen, size), param_operand(index));
+    return x;
+}
+
+void asm_set_float_param(CodeGenerator_t *gen, size_t index, Register x, RegSize_e size)
+{
+    fprintf(gen->file, "\t%s %s %s, %s\n", float_mov(size), mem_size(gen, size), param_operand(index), xmm_list[x]);
+    free_xmm_register(x);
+}
+
+void asm_generate_func_return_float(CodeGenerator_t *gen, Register x)
+{
+    fprintf(gen->file, "\tmovaps xmm0, %s\n", xmm_list[x]);
 }
 
 void asm_generate_func_return(CodeGenerator_t *gen, Register r, RegSize_e size)
 {
-    if (size == SIZE_64bit)
-        fprintf(gen->file, "\tmov %s, %s\n", reg_list[asm_RAX], reg_list[r]);
-    else if (size == SIZE_32bit)
-        fprintf(gen->file, "\tmov %s, %s\n", dreg_list[asm_RAX], dreg_list[r]);
-    else if (size == SIZE_16bit)
-        fprintf(gen->file, "\tmov %s, %s\n", wreg_list[asm_RAX], wreg_list[r]);
-    else if (size == SIZE_8bit)
-        fprintf(gen->file, "\tmov %s, %s\n", breg_list[asm_RAX], breg_list[r]);
+    // Narrow values are kept zero-extended, so moving the 32-bit register
+    // also leaves the upper bits of rax clean for the caller
+    fprintf(gen->file, "\tmov %s, %s\n", op_reg(asm_RAX, size), op_reg(r, size));
 
     // TODO: uncomment this when handling register saving when doing function calls
     // free_register(r);
 }
 
-Register asm_generate_func_call(CodeGenerator_t *gen, char *func_name, Register arg1, bool need_return)
+// Bumps the next pointer of the arena, at offset 0, up to its end, at offset
+// 8, like lib/arena.c does. Only a full block calls the runtime, the
+// registers holding integers are callee saved and survive the call
+Register asm_arena_alloc(CodeGenerator_t *gen, Register arena, Register size, long align)
 {
-    // TODO: Check the size of the argument and use the correct reg for it
     Register out = allocate_register();
-    if (arg1 != asm_NoReg)
-        fprintf(gen->file, "\tmov rdi, %s\n", reg_list[arg1]);
+    int spilled[FLOAT_REG_COUNT];
+    size_t spill_space;
+    LabelId slow_label = asm_generate_label();
+    LabelId done_label = asm_generate_label();
+
+    fprintf(gen->file, "\tmov %s, %s [%s]\n", reg_list[out], mem_size(gen, SIZE_64bit), reg_list[arena]);
+    if (align > 1)
+    {
+        fprintf(gen->file, "\tadd %s, %ld\n", reg_list[out], align - 1);
+        fprintf(gen->file, "\tand %s, %ld\n", reg_list[out], -align);
+    }
+    fprintf(gen->file, "\tadd %s, %s\n", reg_list[out], reg_list[size]);
+    fprintf(gen->file, "\tjc __label__%d\n", slow_label);
+    fprintf(gen->file, "\tcmp %s, %s [%s + 8]\n", reg_list[out], mem_size(gen, SIZE_64bit), reg_list[arena]);
+    fprintf(gen->file, "\tja __label__%d\n", slow_label);
+    fprintf(gen->file, "\tmov %s [%s], %s\n", mem_size(gen, SIZE_64bit), reg_list[arena], reg_list[out]);
+    fprintf(gen->file, "\tsub %s, %s\n", reg_list[out], reg_list[size]);
+    asm_jmp(gen, done_label);
 
-    fprintf(gen->file, "\tcall %s\n", func_name);
-    fprintf(gen->file, "\tmov %s,  rax\n", reg_list[out]);
+    asm_lbl(gen, slow_label);
+    spill_float_registers(gen, spilled, &spill_space);
+    fprintf(gen->file, "\tmov %s, %s\n", arg_reg_list[0], reg_list[arena]);
+    fprintf(gen->file, "\tmov %s, %s\n", arg_reg_list[1], reg_list[size]);
+    fprintf(gen->file, "\tmov %s, %ld\n", arg_reg_list[2], align);
+    fputs("\tcall arena_alloc\n", gen->file);
+    fprintf(gen->file, "\tmov %s, rax\n", reg_list[out]);
+    restore_float_registers(gen, spilled, spill_space);
+    asm_lbl(gen, done_label);
 
-    if (arg1 != asm_NoReg)
-        free_register(arg1);
+    get_function("arena_alloc")->called = true;
+    record_call("arena_alloc");
+    free_register(arena);
+    free_register(size);
+    return out;
+}
+
+// Under x86-TSO loads aren't reordered with other loads and stores aren't
+// reordered with other stores, plain moves already have acquire and release
+// semantics. Only a store followed by a load can be reordered, so sequentially
+// consistent stores use xchg, which is a full barrier. Locked instructions
+// are full barriers whatever the order asked for.
+
+static Register atomic_result(Register r, bool need_result)
+{
+    if (need_result)
+        return r;
+    free_register(r);
+    return asm_NoReg;
+}
+
+Register asm_atomic_load(CodeGenerator_t *gen, Register addr, RegSize_e size, bool need_result)
+{
+    return atomic_result(asm_load_mem(gen, addr, size), need_result);
+}
+
+void asm_atomic_store(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, MemoryOrder_e order)
+{
+    if (order != MEMORY_ORDER_SEQ_CST)
+    {
+        asm_store_mem(gen, addr, val, size);
+        return;
+    }
+    fprintf(gen->file, "\txchg %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(val, size));
+    free_register(val);
+    free_register(addr);
+}
+
+Register asm_atomic_exchange(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, bool need_result)
+{
+    // xchg with memory is locked implicitly. The bits of val above `size`
+    // are already zero, so it holds the old value zero extended afterwards
+    fprintf(gen->file, "\txchg %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(val, size));
+    free_register(addr);
+    return atomic_result(val, need_result);
+}
+
+Register asm_atomic_compare_exchange(CodeGenerator_t *gen, Register addr, Register expected, Register desired, RegSize_e size, bool need_result)
+{
+    LabelId done = asm_generate_label();
 
-    if (need_return)
-        return (out);
+    // The value found is only written back to `expected` on failure
+    fprintf(gen->file, "\tmov %s, %s [%s]\n", sized_reg(asm_RAX, size), mem_size(gen, size), reg_list[expected]);
+    fprintf(gen->file, "\tlock cmpxchg %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(desired, size));
+    fprintf(gen->file, "\tsete %s\n", breg_list[desired]);
+    fprintf(gen->file, "\tje __label__%d\n", done);
+    fprintf(gen->file, "\tmov %s [%s], %s\n", mem_size(gen, size), reg_list[expected], sized_reg(asm_RAX, size));
+    asm_lbl(gen, done);
+    fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[desired], breg_list[desired]);
+    free_register(expected);
+    free_register(addr);
+    return atomic_result(desired, need_result);
+}
+
+Register asm_atomic_fetch_add(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, bool need_result)
+{
+    // Like xchg, xadd leaves the old value zero extended in val
+    if (need_result)
+        fprintf(gen->file, "\tlock xadd %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(val, size));
     else
+        fprintf(gen->file, "\tlock add %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(val, size));
+    free_register(addr);
+    return atomic_result(val, need_result);
+}
+
+Register asm_atomic_fetch_or(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, bool need_result)
+{
+    Register tmp;
+    LabelId retry;
+
+    if (!need_result)
     {
-        free_register(out);
+        fprintf(gen->file, "\tlock or %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(val, size));
+        free_register(val);
+        free_register(addr);
         return asm_NoReg;
     }
+
+    // There is no instruction returning the old value, retry a
+    // compare-exchange until no other thread wrote in between
+    tmp = allocate_register();
+    retry = asm_generate_label();
+    fprintf(gen->file, "\tmov %s, %s [%s]\n", sized_reg(asm_RAX, size), mem_size(gen, size), reg_list[addr]);
+    asm_lbl(gen, retry);
+    fprintf(gen->file, "\tmov %s, %s\n", reg_list[tmp], reg_list[asm_RAX]);
+    fprintf(gen->file, "\tor %s, %s\n", reg_list[tmp], reg_list[val]);
+    fprintf(gen->file, "\tlock cmpxchg %s [%s], %s\n", mem_size(gen, size), reg_list[addr], sized_reg(tmp, size));
+    fprintf(gen->file, "\tjne __label__%d\n", retry);
+    if (size < SIZE_32bit)
+        fprintf(gen->file, "\tmovzx %s, %s\n", dreg_list[val], sized_reg(asm_RAX, size));
+    else
+        fprintf(gen->file, "\tmov %s, %s\n", op_reg(val, size), op_reg(asm_RAX, size));
+    free_register(tmp);
+    free_register(addr);
+    return val;
+}
+
+void asm_atomic_fence(CodeGenerator_t *gen, MemoryOrder_e order)
+{
+    // Weaker fences only keep the compiler from moving accesses across them,
+    // which it never does
+    if (order == MEMORY_ORDER_SEQ_CST)
+        fputs("\tmfence\n", gen->file);
+}
+
+// Arguments are evaluated one after the other, the code of any of them can
+// call a function and clobber the argument registers. With more than one
+// argument they are stored in stack slots first, the slots past the sixth
+// are left in place as the stack arguments of the call
+static size_t call_args_space(size_t arg_count)
+{
+    return arg_count > 1 ? (arg_count * 8 + 15) / 16 * 16 : 0;
+}
+
+void asm_reserve_call_args(CodeGenerator_t *gen, size_t arg_count)
+{
+    ASMCallFrame *frame;
+
+    if (call_depth == MAX_CALL_DEPTH)
+    {
+        debug_print(SEV_ERROR, "[ASM] Calls are nested too deeply");
+        exit(1);
+    }
+    frame = &call_frames[call_depth++];
+    frame->arg_count = arg_count;
+    frame->float_args = calloc(arg_count ? arg_count : 1, sizeof(bool));
+    spill_float_registers(gen, frame->spilled, &frame->spill_space);
+
+    if (call_args_space(arg_count))
+        fprintf(gen->file, "\tsub rsp, %zu\n", call_args_space(arg_count));
+}
+
+void asm_set_call_arg(CodeGenerator_t *gen, size_t index, size_t arg_count, Register r)
+{
+    // Values are kept extended to 64 bits, so the whole register is passed
+    if (arg_count == 1)
+        fprintf(gen->file, "\tmov %s, %s\n", arg_reg_list[0], reg_list[r]);
+    else
+        fprintf(gen->file, "\tmov %s [rsp + %zu], %s\n", mem_size(gen, SIZE_64bit), index * 8, reg_list[r]);
+    free_register(r);
+}
+
+void asm_set_call_float_arg(CodeGenerator_t *gen, size_t index, size_t arg_count, Register x)
+{
+    call_frames[call_depth - 1].float_args[index] = true;
+    if (arg_count == 1)
+        fprintf(gen->file, "\tmovaps %s, %s\n", float_arg_reg_list[0], xmm_list[x]);
+    else
+        fprintf(gen->file, "\tmovq %s [rsp + %zu], %s\n", mem_size(gen, SIZE_64bit), index * 8, xmm_list[x]);
+    free_xmm_register(x);
+}
+
+// Loads the argument slots in their registers and leaves the stack arguments
+// on top of the stack, returns the bytes left to pop after the call
+static size_t load_call_args(CodeGenerator_t *gen, ASMCallFrame *frame, size_t *float_count)
+{
+    size_t space = call_args_space(frame->arg_count);
+    size_t int_count = 0, stack_count = 0, stack_space;
+    size_t first_stack_arg = frame->arg_count;
+
+    *float_count = 0;
+    for (size_t i = 0; i < frame->arg_count; i++)
+    {
+        bool is_float = frame->float_args[i];
+        if (is_float && *float_count < FLOAT_ARG_REG_COUNT)
+        {
+            if (space)
+                fprintf(gen->file, "\tmovq %s, %s [rsp + %zu]\n", float_arg_reg_list[*float_count], mem_size(gen, SIZE_64bit), i * 8);
+            (*float_count)++;
+        }
+        else if (!is_float && int_count < ARG_REG_COUNT)
+        {
+            if (space)
+                fprintf(gen->file, "\tmov %s, %s [rsp + %zu]\n", arg_reg_list[int_count], mem_size(gen, SIZE_64bit), i * 8);
+            int_count++;
+        }
+        else
+        {
+            if (first_stack_arg == frame->arg_count)
+                first_stack_arg = i;
+            stack_count++;
+        }
+    }
+    if (space == 0)
+        return 0;
+
+    // Without floating point arguments the stack arguments are the slots
+    // past the sixth, popping the six others leaves them in place. Both
+    // sizes are multiples of 16, the stack stays aligned for the call
+    if (stack_count == 0 || (first_stack_arg == ARG_REG_COUNT && stack_count == frame->arg_count - ARG_REG_COUNT))
+    {
+        size_t reg_space = stack_count ? ARG_REG_COUNT * 8 : space;
+        fprintf(gen->file, "\tadd rsp, %zu\n", reg_space);
+        return space - reg_space;
+    }
+
+    // Otherwise they are copied in order below the slots
+    stack_space = (stack_count * 8 + 15) / 16 * 16;
+    fprintf(gen->file, "\tsub rsp, %zu\n", stack_space);
+    stack_count = 0;
+    int_count = 0;
+    *float_count = 0;
+    for (size_t i = 0; i < frame->arg_count; i++)
+    {
+        if (frame->float_args[i] && (*float_count)++ < FLOAT_ARG_REG_COUNT)
+            continue;
+        if (!frame->float_args[i] && int_count++ < ARG_REG_COUNT)
+            continue;
+        fprintf(gen->file, "\tmov rax, %s [rsp + %zu]\n", mem_size(gen, SIZE_64bit), stack_space + i * 8);
+        fprintf(gen->file, "\tmov %s [rsp + %zu], rax\n", mem_size(gen, SIZE_64bit), stack_count++ * 8);
+    }
+    if (*float_count > FLOAT_ARG_REG_COUNT)
+        *float_count = FLOAT_ARG_REG_COUNT;
+    return stack_space + space;
+}
+
+Register asm_generate_func_call(CodeGenerator_t *gen, char *func_name, Register callee, RegSize_e ret_size, bool ret_float, bool need_return)
+{
+    ASMCallFrame *frame = &call_frames[--call_depth];
+    size_t float_count;
+    size_t pop_space = load_call_args(gen, frame, &float_count);
+    Register out;
+
+    // External functions may be variadic, al holds the number of vector
+    // registers used by the arguments. The target of an indirect call isn't
+    // known, al is always set for it
+    if (callee == asm_NoReg || func_name == NULL)
+    {
+        if (callee != asm_NoReg || !get_function(func_name)->defined)
+            fprintf(gen->file, float_count ? "\tmov eax, %zu\n" : "\txor eax, eax\n", float_count);
+        fprintf(gen->file, "\tcall %s\n", callee == asm_NoReg ? function_label(gen, func_name) : reg_list[callee]);
+    }
+    else
+    {
+        // The guessed target is called directly when the pointer holds it,
+        // the direct call is predicted and lets the callee's return be too.
+        // mov leaves the flags of the comparison alone, xor doesn't
+        LabelId other_label = asm_generate_label();
+        LabelId done_label = asm_generate_label();
+
+        fprintf(gen->file, "\tlea rax, [%s]\n", function_label(gen, func_name));
+        fprintf(gen->file, "\tcmp %s, rax\n", reg_list[callee]);
+        fprintf(gen->file, "\tmov eax, %zu\n", float_count);
+        fprintf(gen->file, "\tjne __label__%d\n", other_label);
+        fprintf(gen->file, "\tcall %s\n", function_label(gen, func_name));
+        asm_jmp(gen, done_label);
+        asm_lbl(gen, other_label);
+        fprintf(gen->file, "\tcall %s\n", reg_list[callee]);
+        asm_lbl(gen, done_label);
+    }
+    if (pop_space)
+        fprintf(gen->file, "\tadd rsp, %zu\n", pop_space);
+
+    if (func_name != NULL)
+        asm_reference_function(func_name);
+    if (callee != asm_NoReg)
+        free_register(callee);
+
+    // The result is taken before the spilled registers are restored, the
+    // restored ones are still allocated so they can't be picked for it
+    out = asm_NoReg;
+    if (need_return && ret_float)
+    {
+        out = allocate_xmm_register();
+        fprintf(gen->file, "\tmovaps %s, xmm0\n", xmm_list[out]);
+    }
+    else if (need_return)
+    {
+        // Only the bits of the returned type are set by the callee
+        out = allocate_register();
+        switch (ret_size)
+        {
+        case SIZE_8bit:
+            fprintf(gen->file, "\tmovzx %s, al\n", dreg_list[out]);
+            break;
+        case SIZE_16bit:
+            fprintf(gen->file, "\tmovzx %s, ax\n", dreg_list[out]);
+            break;
+        case SIZE_32bit:
+            fprintf(gen->file, "\tmov %s, eax\n", dreg_list[out]);
+            break;
+        default:
+            fprintf(gen->file, "\tmov %s, rax\n", reg_list[out]);
+            break;
+        }
+    }
+    restore_float_registers(gen, frame->spilled, frame->spill_space);
+    free(frame->float_args);
+    return out;
+}
+
+void asm_record_begin(CodeGenerator_t *gen, ASMRecord *record, char *func_name)
+{
+    memset(record, 0, sizeof(ASMRecord));
+    record->name = func_name;
+    record->first_label = label_count;
+    recording = record;
+    recording_first_symbol = asm_symbol_count;
+
+    // The code is collected in memory and copied to the output at the end
+    recording_file = gen->file;
+    gen->file = open_memstream(&record->code, &record->code_len);
+    if (gen->file == NULL)
+    {
+        debug_print(SEV_ERROR, "[ASM] Couldn't record the generated code");
+        exit(1);
+    }
+}
+
+void asm_record_end(CodeGenerator_t *gen, ASMRecord *record)
+{
+    fclose(gen->file);
+    gen->file = recording_file;
+    fwrite(record->code, 1, record->code_len, gen->file);
+
+    record->label_count = label_count - record->first_label;
+    record->symbol_count = asm_symbol_count - recording_first_symbol;
+    record->symbols = malloc(record->symbol_count * sizeof(ASMRecordSymbol));
+    for (size_t i = 0; i < record->symbol_count; i++)
+    {
+        ASMSymbol *symbol = &asm_symbols[recording_first_symbol + i];
+        record->symbols[i].name = symbol->symbol_name;
+        record->symbols[i].size = symbol->size;
+        record->symbols[i].number_of_items = symbol->number_of_items;
+        record->symbols[i].values = symbol->values;
+        record->symbols[i].value_count = symbol->value_count;
+        record->symbols[i].read_only = symbol->read_only;
+    }
+    recording = NULL;
+}
+
+// Parses the number of a label generated by asm_generate_label(), e.g.
+// `__label__12` or `__12__STR_CONST__`, returns the length of the label
+static size_t parse_label(char *code, size_t len, bool *is_str, LabelId *id)
+{
+    size_t i = 0;
+    size_t prefix = strlen("__label__");
+
+    *is_str = !(len >= prefix && strncmp(code, "__label__", prefix) == 0);
+    i = *is_str ? 2 : prefix;
+    if (len < i + 1 || strncmp(code, "__", 2) != 0 || !isdigit(code[i]))
+        return 0;
+
+    *id = 0;
+    for (; i < len && isdigit(code[i]); i++)
+        *id = *id * 10 + (code[i] - '0');
+    if (!*is_str)
+        return i;
+    if (len - i < strlen("__STR_CONST__") || strncmp(code + i, "__STR_CONST__", strlen("__STR_CONST__")) != 0)
+        return 0;
+    return i + strlen("__STR_CONST__");
+}
+
+// A literal first pooled by the recorded function keeps its place among
+// the labels of the function, so the replayed code is the generated one
+static char *replayed_str_label(ASMRecord *record, LabelId first_label, LabelId id)
+{
+    LabelId replayed = id - record->first_label + first_label;
+
+    for (size_t i = 0; i < record->str_count; i++)
+    {
+        if (record->strs[i].id != id)
+            continue;
+        if (id >= record->first_label && id - record->first_label < record->label_count)
+            return pool_string_lit(record->strs[i].str, &replayed);
+        return pool_string_lit(record->strs[i].str, NULL);
+    }
+    debug_print(SEV_ERROR, "[ASM] Recorded code uses an unknown string literal %u", id);
+    exit(1);
+}
+
+void asm_replay(CodeGenerator_t *gen, ASMRecord *record)
+{
+    LabelId first_label = label_count;
+    ASMSymbolValue *values;
+    bool is_str;
+    LabelId id;
+    size_t len;
+
+    label_count += record->label_count;
+
+    get_function(record->name)->defined = true;
+    for (size_t i = 0; i < record->call_count; i++)
+        get_function(record->calls[i])->called = true;
+
+    for (size_t i = 0; i < record->symbol_count; i++)
+    {
+        ASMRecordSymbol *symbol = &record->symbols[i];
+        asm_add_global_var(gen, symbol->name, symbol->size, symbol->number_of_items);
+        if (symbol->read_only)
+            asm_set_global_var_readonly(symbol->name);
+        if (symbol->value_count == 0)
+            continue;
+
+        values = malloc(symbol->value_count * sizeof(ASMSymbolValue));
+        memcpy(values, symbol->values, symbol->value_count * sizeof(ASMSymbolValue));
+        for (size_t j = 0; j < symbol->value_count; j++)
+        {
+            if (values[j].type == ASM_SYMBOL_ADDR &&
+                parse_label(values[j].label, strlen(values[j].label), &is_str, &id) &&
+                is_str)
+                values[j].label = replayed_str_label(record, first_label, id);
+        }
+        asm_set_global_var_initial_val(symbol->name, values, symbol->value_count);
+        free(values);
+    }
+
+    // Copy the code, renumbering the labels it defines and the literals it uses
+    char *code = record->code, *end = record->code + record->code_len;
+    while (code < end)
+    {
+        char *next = memchr(code, '_', end - code);
+        if (next == NULL)
+            next = end;
+        fwrite(code, 1, next - code, gen->file);
+        code = next;
+        if (code == end)
+            break;
+
+        len = parse_label(code, end - code, &is_str, &id);
+        if (len == 0)
+            fputc(*code++, gen->file);
+        else if (is_str)
+            fputs(replayed_str_label(record, first_label, id), gen->file);
+        else
+            fprintf(gen->file, "__label__%u", id - record->first_label + first_label);
+        code += len;
+    }
 }
@@ -20,35 +20,132 @@ typedef enum ASMSymbolType
 {
     ASM_SYMBOL_UNINTIALIZED,
     ASM_SYMBOL_INT,
-    ASM_SYMBOL_STR
+    ASM_SYMBOL_ADDR
 } ASMSymbolType;
 
-typedef union ASMSymbolValue
+typedef struct ASMSymbolValue
 {
-    int num;
-    char *str;
+    ASMSymbolType type;
+    long num;    /**< Integer value, or the offset added to `label`. */
+    char *label; /**< Label the value is the address of, for ASM_SYMBOL_ADDR. */
 } ASMSymbolValue;
 
+/**
+ * @brief Data symbol added while generating a recorded function.
+ */
+typedef struct ASMRecordSymbol
+{
+    char *name;
+    RegSize_e size;
+    size_t number_of_items;
+    ASMSymbolValue *values;
+    size_t value_count;
+    bool read_only;
+} ASMRecordSymbol;
+
+/**
+ * @brief String literal used by a recorded function.
+ */
+typedef struct ASMRecordStr
+{
+    LabelId id; /**< Label number of the literal when the code was generated. */
+    char *str;
+} ASMRecordStr;
+
+/**
+ * @brief Code generated for a function, with everything needed to emit it
+ * again in another compilation.
+ *
+ * Labels of the function are numbered from `first_label`, they are given new
+ * numbers when the record is replayed so they can't collide with the labels
+ * of the code around it.
+ */
+typedef struct ASMRecord
+{
+    char *name; /**< Name of the recorded function. */
+    char *code;
+    size_t code_len;
+    LabelId first_label;
+    LabelId label_count;
+    ASMRecordStr *strs;
+    size_t str_count;
+    ASMRecordSymbol *symbols;
+    size_t symbol_count;
+    char **calls; /**< Functions called by the recorded function. */
+    size_t call_count;
+} ASMRecord;
+
 extern Register asm_NoReg;
 extern Register asm_RAX;
 
+void asm_start(CodeGenerator_t *gen);
 void asm_wrapup(CodeGenerator_t *gen);
 
-Register asm_init_register(CodeGenerator_t *gen, int value);
+Register asm_init_register(CodeGenerator_t *gen, long value);
 void asm_set_register(CodeGenerator_t *gen, Register dest, Register src, RegSize_e size, bool free_src);
 
-Register asm_add(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_sub(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_mul(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_div(CodeGenerator_t *gen, Register r1, Register r2);
-void asm_sll(CodeGenerator_t *gen, Register r1, __uint8_t val);
+Register asm_sign_extend(CodeGenerator_t *gen, Register r, RegSize_e from, RegSize_e to);
 
-Register asm_comp_eq(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_comp_ne(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_comp_gt(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_comp_ge(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_comp_lt(CodeGenerator_t *gen, Register r1, Register r2);
-Register asm_comp_le(CodeGenerator_t *gen, Register r1, Register r2);
+Register asm_add(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_sub(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_mul(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_div(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_udiv(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_mod(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_umod(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+void asm_sll(CodeGenerator_t *gen, Register r1, __uint8_t val);
+void asm_srl(CodeGenerator_t *gen, Register r1, __uint8_t val, RegSize_e size);
+void asm_and(CodeGenerator_t *gen, Register r1, long mask, RegSize_e size);
+
+Register asm_comp_eq(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_ne(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_gt(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_ge(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_lt(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_le(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+/**
+ * @brief Comparisons of unsigned integers, with the `above` and `below`
+ * conditions. Equality is the same for both signs.
+ */
+Register asm_comp_ugt(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_uge(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_ult(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+Register asm_comp_ule(CodeGenerator_t *gen, Register r1, Register r2, RegSize_e size);
+
+/**
+ * @brief Floating point values live in a separate pool of xmm registers.
+ *
+ * A Register returned by these functions names an xmm register, it is only
+ * passed to other floating point functions. `size` is 32 for a float and 64
+ * for a double, the instructions are the scalar SSE2 ones.
+ */
+Register asm_init_float(CodeGenerator_t *gen, long bits);
+Register asm_get_float_var(CodeGenerator_t *gen, char *var_name);
+void asm_set_float_var(CodeGenerator_t *gen, char *var_name, Register x);
+Register asm_load_float(CodeGenerator_t *gen, Register addr, RegSize_e size);
+void asm_store_float(CodeGenerator_t *gen, Register addr, Register x, RegSize_e size);
+
+Register asm_float_add(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_sub(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_mul(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_div(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+
+/**
+ * @brief Comparisons of floating point values, the result is an integer
+ * register holding 0 or 1. Comparisons with NaN are false except `!=`.
+ */
+Register asm_float_comp_eq(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_comp_ne(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_comp_gt(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_comp_ge(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_comp_lt(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+Register asm_float_comp_le(CodeGenerator_t *gen, Register x1, Register x2, RegSize_e size);
+
+Register asm_int_to_float(CodeGenerator_t *gen, Register r, RegSize_e from, RegSize_e to);
+Register asm_float_to_int(CodeGenerator_t *gen, Register x, RegSize_e from, RegSize_e to);
+Register asm_uint_to_float(CodeGenerator_t *gen, Register r, RegSize_e from, RegSize_e to);
+Register asm_float_to_uint(CodeGenerator_t *gen, Register x, RegSize_e from, RegSize_e to);
+Register asm_float_convert(CodeGenerator_t *gen, Register x, RegSize_e from, RegSize_e to);
 
 LabelId asm_generate_label();
 void asm_lbl(CodeGenerator_t *gen, LabelId lbl);
@@ -62,18 +159,75 @@ void asm_jmp_ne(CodeGenerator_t *gen, Register r, int val, LabelId lbl);
 // void asm_jmp_le(CodeGenerator_t *gen, Register r1, Register r2, LabelId lbl);
 
 void asm_add_global_var(CodeGenerator_t *gen, char *var_name, RegSize_e size, size_t number_of_elements);
+
+/**
+ * @brief Places an array of the next function in its stack frame.
+ *
+ * Called for every local array before asm_generate_function_prologue(), the
+ * arrays are dropped by asm_generate_function_epilogue(). asm_address_of()
+ * then gives their address in the frame.
+ */
+void asm_add_local_array(CodeGenerator_t *gen, char *var_name, RegSize_e size, size_t number_of_elements);
+bool asm_is_local_array(char *var_name);
+
+/**
+ * @brief Address of an element of a local array, `[rbp + index * scale - offset]`.
+ *
+ * @param index Register holding the index, reused for the address.
+ * @param scale Size of an element in bytes, 1, 2, 4 or 8.
+ */
+Register asm_local_array_index(CodeGenerator_t *gen, char *var_name, Register index, size_t scale);
+
+/**
+ * @brief Zero fills the first `bytes` bytes of a local array.
+ */
+void asm_zero_local_array(CodeGenerator_t *gen, char *var_name, size_t bytes);
 void asm_set_global_var(CodeGenerator_t *gen, char *var_name, Register r);
-void asm_set_global_var_initial_val(CodeGenerator_t *gen, char *var_name, ASMSymbolValue value, ASMSymbolType type);
-char *asm_generate_string_lit(CodeGenerator_t *gen, char *str);
+void asm_set_global_var_initial_val(char *var_name, ASMSymbolValue *values, size_t count);
+void asm_set_global_var_readonly(char *var_name);
+char *asm_generate_string_lit(char *str);
 Register asm_get_global_var(CodeGenerator_t *gen, char *var_name);
+/**
+ * @brief Marks a function as used, external ones are declared.
+ */
+void asm_reference_function(char *func_name);
 Register asm_address_of(CodeGenerator_t *gen, char *var_name);
 
 Register asm_load_mem(CodeGenerator_t *gen, Register addr, RegSize_e size);
 void asm_store_mem(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size);
 
-void asm_generate_function_prologue(CodeGenerator_t *gen, char *func_name);
+void asm_generate_function_prologue(CodeGenerator_t *gen, char *func_name, size_t param_count, bool *float_params);
 void asm_generate_function_epilogue(CodeGenerator_t *gen);
-Register asm_generate_func_call(CodeGenerator_t *gen, char *func_name, Register arg1, bool need_return);
+Register asm_get_param(CodeGenerator_t *gen, size_t index, RegSize_e size);
+void asm_set_param(CodeGenerator_t *gen, size_t index, Register r);
+Register asm_get_float_param(CodeGenerator_t *gen, size_t index, RegSize_e size);
+void asm_set_float_param(CodeGenerator_t *gen, size_t index, Register x, RegSize_e size);
+void asm_reserve_call_args(CodeGenerator_t *gen, size_t arg_count);
+void asm_set_call_arg(CodeGenerator_t *gen, size_t index, size_t arg_count, Register r);
+void asm_set_call_float_arg(CodeGenerator_t *gen, size_t index, size_t arg_count, Register x);
+/**
+ * @brief Calls a function once its arguments are set.
+ *
+ * @param func_name Called function, or the function guessed to be the target
+ *                  of an indirect call, NULL when there is no guess.
+ * @param callee Register holding the address of the called function for an
+ *               indirect call, asm_NoReg for a direct call.
+ */
+Register asm_generate_func_call(CodeGenerator_t *gen, char *func_name, Register callee, RegSize_e ret_size, bool ret_float, bool need_return);
 void asm_generate_func_return(CodeGenerator_t *gen, Register r, RegSize_e size);
+void asm_generate_func_return_float(CodeGenerator_t *gen, Register x);
+Register asm_arena_alloc(CodeGenerator_t *gen, Register arena, Register size, long align);
+
+Register asm_atomic_load(CodeGenerator_t *gen, Register addr, RegSize_e size, bool need_result);
+void asm_atomic_store(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, MemoryOrder_e order);
+Register asm_atomic_exchange(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, bool need_result);
+Register asm_atomic_compare_exchange(CodeGenerator_t *gen, Register addr, Register expected, Register desired, RegSize_e size, bool need_result);
+Register asm_atomic_fetch_add(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, bool need_result);
+Register asm_atomic_fetch_or(CodeGenerator_t *gen, Register addr, Register val, RegSize_e size, bool need_result);
+void asm_atomic_fence(CodeGenerator_t *gen, MemoryOrder_e order);
+
+void asm_record_begin(CodeGenerator_t *gen, ASMRecord *record, char *func_name);
+void asm_record_end(CodeGenerator_t *gen, ASMRecord *record);
+void asm_replay(CodeGenerator_t *gen, ASMRecord *record);
 
 #endif
\ No newline at end of file
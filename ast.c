@@ -14,6 +14,7 @@ ASTNode_t *ast_create_node(ASTNode_type_e type, ASTNode_t *left, ASTNode_t *righ
     }
 
     node->type = type;
+    node->not_const = false;
     node->left = left;
     node->right = right;
     node->value = value;
@@ -77,7 +78,9 @@ void ast_free(ASTNode_t *node)
 
     while (node_list.size != 0)
     {
-        ASTNode_t *current = LList_ASTNode_tail(&node_list);
+        // Pop before pushing the children, otherwise the last child pushed
+        // would be popped instead of the current node
+        ASTNode_t *current = LList_ASTNode_pop(&node_list);
 
         if (current->right != NULL)
             LList_ASTNode_append(&node_list, current->right);
@@ -88,7 +91,6 @@ void ast_free(ASTNode_t *node)
         if (current->next != NULL)
             LList_ASTNode_append(&node_list, current->next);
 
-        LList_ASTNode_pop(&node_list);
         free(current);
     }
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ typedef enum
     AST_SUBTRACT,
     AST_MULT,
     AST_DIV,
+    AST_MOD,
 
     AST_COMP_GT,
     AST_COMP_GE,
@@ -33,6 +34,7 @@ typedef enum
     AST_PTRDREF,
     AST_OFFSET_SCALE,
     AST_ARRAY_INDEX,
+    AST_INIT_LIST,
 
     AST_VAR_DECL,
     AST_FUNC_DECL,
@@ -45,14 +47,58 @@ typedef enum
     AST_WHILE,
     AST_DO_WHILE,
     AST_FOR,
-    AST_BREAK
+    AST_BREAK,
+
+    AST_FUNC_PROTO,
+    AST_ATOMIC,
+    AST_PARAM,    /**< Parameter of the current function, by position. */
+    AST_FUNC_ADDR, /**< Address of a function, by symbol. */
+    AST_FLOAT_LIT, /**< Floating point literal, value.str spells it in hexadecimal. */
+    AST_INDIRECT_CALL /**< Call through a function pointer, `left` holds the arguments and `right` the pointer. */
 } ASTNode_type_e;
 
+/**
+ * @brief Atomic builtins, the operation of an AST_ATOMIC node.
+ *
+ * The operands are the `left` list: the pointer to the atomic object, then
+ * the value, or the pointer to the expected value and the desired value of
+ * a compare-exchange. A fence has no operand.
+ */
+typedef enum
+{
+    ATOMIC_LOAD,
+    ATOMIC_STORE,
+    ATOMIC_EXCHANGE,
+    ATOMIC_COMPARE_EXCHANGE,
+    ATOMIC_FETCH_ADD,
+    ATOMIC_FETCH_OR,
+    ATOMIC_FENCE
+} AtomicOp_e;
+
+/**
+ * @brief C11 memory orders, numbered like the `__ATOMIC_*` constants of GCC.
+ */
+typedef enum
+{
+    MEMORY_ORDER_RELAXED,
+    MEMORY_ORDER_CONSUME,
+    MEMORY_ORDER_ACQUIRE,
+    MEMORY_ORDER_RELEASE,
+    MEMORY_ORDER_ACQ_REL,
+    MEMORY_ORDER_SEQ_CST
+} MemoryOrder_e;
+
+// The value of an AST_ATOMIC node packs the operation and the memory order
+#define ASTAtomicValue(op, order) ((int)((op) << 4 | (order)))
+#define ASTAtomicOp(value) ((AtomicOp_e)((value) >> 4))
+#define ASTAtomicOrder(value) ((MemoryOrder_e)((value) & 0xf))
+
 #define ASTCheckLoopContext(t) t >= AST_WHILE &&t <= AST_FOR
 
 typedef union ASTNodeValue
 {
     int num;
+    long lit; /**< Value of an AST_INT_LIT, unsigned literals keep their bits. */
     char *str;
 } ASTNodeValue;
 
@@ -60,6 +106,7 @@ typedef struct ASTNode_t ASTNode_t;
 struct ASTNode_t
 {
     ASTNode_type_e type;
+    bool not_const; /**< consteval_expr() already failed on the node. */
     ASTNode_t *next;
     ASTNode_t *left;
     ASTNode_t *right;
@@ -75,6 +122,7 @@ static char *__ast_type_names[] = {
     "AST_SUBTRACT",
     "AST_MULT",
     "AST_DIV",
+    "AST_MOD",
     "AST_COMP_GT",
     "AST_COMP_GE",
     "AST_COMP_LT",
@@ -91,6 +139,7 @@ static char *__ast_type_names[] = {
     "AST_PTRDREF",
     "AST_OFFSET_SCALE",
     "AST_ARRAY_INDEX",
+    "AST_INIT_LIST",
     "AST_VAR_DECL",
     "AST_FUNC_DECL",
     "AST_FUNC_CALL",
@@ -99,7 +148,13 @@ static char *__ast_type_names[] = {
     "AST_WHILE",
     "AST_DO_WHILE",
     "AST_FOR",
-    "AST_BREAK"};
+    "AST_BREAK",
+    "AST_FUNC_PROTO",
+    "AST_ATOMIC",
+    "AST_PARAM",
+    "AST_FUNC_ADDR",
+    "AST_FLOAT_LIT",
+    "AST_INDIRECT_CALL"};
 #define NodeToString(node) __ast_type_names[(node).type]
 
 ASTNode_t *ast_create_node(ASTNode_type_e type, ASTNode_t *left, ASTNode_t *right, ASTNodeValue value);
@@ -0,0 +1,676 @@
+/**
+ * @file astfile.c
+ * @brief Binary format for the parsed tree and the symbol table.
+ *
+ * A parsed file can be written once and loaded again without lexing or
+ * parsing it. The format only uses indices and offsets, it can be mapped
+ * and read in place by tools inspecting the tree.
+ *
+ * @project ToyCComp
+ */
+
+#include "astfile.h"
+#include "debug.h"
+#include "symtab.h"
+#include "writer.h"
+#include "llist_definitions.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define ASTFILE_MAP_INIT_SIZE 1024
+#define ASTFILE_SECTION_ALIGNMENT 8
+
+typedef struct
+{
+    char *data;
+    size_t len;
+    size_t capacity;
+} Section_t;
+
+// Open addressing table from a pointer, or the hash of a string, to an index
+typedef struct
+{
+    const void **keys;
+    __uint32_t *values;
+    size_t capacity;
+    size_t count;
+} PtrMap_t;
+
+typedef struct
+{
+    Section_t nodes;
+    Section_t types;
+    Section_t symbols;
+    Section_t args;
+    Section_t votes;
+    Section_t strings;
+    PtrMap_t node_map;
+    PtrMap_t type_map;
+    PtrMap_t string_map; /**< Keyed by the hash of the string. */
+} AstFileWriter_t;
+
+static __uint64_t checksum(const void *data, size_t len)
+{
+    // FNV-1a style, a word at a time as it runs over the whole file on load
+    __uint64_t hash = 14695981039346656037ull;
+    __uint64_t word;
+    size_t i = 0;
+
+    for (; i + sizeof(word) <= len; i += sizeof(word))
+    {
+        memcpy(&word, (char *)data + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ull;
+        hash ^= hash >> 32;
+    }
+    for (; i < len; i++)
+    {
+        hash ^= ((unsigned char *)data)[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static void *section_append(Section_t *section, const void *data, size_t len)
+{
+    if (section->len + len > section->capacity)
+    {
+        section->capacity = section->capacity ? section->capacity * 2 : ASTFILE_MAP_INIT_SIZE;
+        if (section->capacity < section->len + len)
+            section->capacity = section->len + len;
+        section->data = realloc(section->data, section->capacity);
+    }
+    if (data != NULL)
+        memcpy(section->data + section->len, data, len);
+    else
+        memset(section->data + section->len, 0, len);
+    section->len += len;
+    return section->data + section->len - len;
+}
+
+#define SectionCount(section, type) ((__uint32_t)((section)->len / sizeof(type)))
+#define SectionGet(section, type, index) (&((type *)(section)->data)[index])
+
+static size_t ptr_slot(PtrMap_t *map, const void *key)
+{
+    size_t slot = ((size_t)key >> 3) * 11400714819323198485ull;
+    for (slot &= map->capacity - 1; map->keys[slot] != NULL && map->keys[slot] != key;)
+        slot = (slot + 1) & (map->capacity - 1);
+    return slot;
+}
+
+static void ptr_map_put(PtrMap_t *map, const void *key, __uint32_t value)
+{
+    if ((map->count + 1) * 2 > map->capacity)
+    {
+        PtrMap_t grown = {0};
+        grown.capacity = map->capacity ? map->capacity * 2 : ASTFILE_MAP_INIT_SIZE;
+        grown.keys = calloc(grown.capacity, sizeof(void *));
+        grown.values = malloc(grown.capacity * sizeof(__uint32_t));
+        for (size_t i = 0; i < map->capacity; i++)
+        {
+            if (map->keys[i] != NULL)
+                ptr_map_put(&grown, map->keys[i], map->values[i]);
+        }
+        free(map->keys);
+        free(map->values);
+        *map = grown;
+    }
+    size_t slot = ptr_slot(map, key);
+    if (map->keys[slot] == NULL)
+        map->count++;
+    map->keys[slot] = key;
+    map->values[slot] = value;
+}
+
+static bool ptr_map_get(PtrMap_t *map, const void *key, __uint32_t *value)
+{
+    if (map->capacity == 0)
+        return false;
+    size_t slot = ptr_slot(map, key);
+    if (map->keys[slot] == NULL)
+        return false;
+    *value = map->values[slot];
+    return true;
+}
+
+static __uint32_t write_string(AstFileWriter_t *writer, const char *str)
+{
+    // The map is keyed by the hash, entries with the same hash are chained
+    // through consecutive hash values
+    size_t len = strlen(str);
+    __uint64_t hash = checksum(str, len) | 1;
+    __uint32_t offset;
+
+    for (;; hash += 2)
+    {
+        if (!ptr_map_get(&writer->string_map, (void *)hash, &offset))
+            break;
+        if (strcmp(writer->strings.data + offset, str) == 0)
+            return offset;
+    }
+    offset = writer->strings.len;
+    section_append(&writer->strings, str, len + 1);
+    ptr_map_put(&writer->string_map, (void *)hash, offset);
+    return offset;
+}
+
+static __int32_t write_type(AstFileWriter_t *writer, Datatype_t *type)
+{
+    AstFileType_t record = {0};
+    __int32_t params[UINT8_MAX];
+    __uint32_t index;
+
+    if (type == NULL)
+        return ASTFILE_NONE;
+    if (ptr_map_get(&writer->type_map, type, &index))
+        return index;
+
+    // Base types are written first, a type only refers to earlier types.
+    // The parameters of a function type are kept with the arguments
+    record.base_type = write_type(writer, type->base_type);
+    record.return_type = write_type(writer, type->return_type);
+    for (size_t i = 0; i < type->param_count; i++)
+        params[i] = write_type(writer, type->param_types[i]);
+    record.first_param = SectionCount(&writer->args, AstFileArg_t);
+    record.param_count = type->param_count;
+    for (size_t i = 0; i < type->param_count; i++)
+    {
+        AstFileArg_t param_record = {0};
+        param_record.name = write_string(writer, "");
+        param_record.type = params[i];
+        section_append(&writer->args, &param_record, sizeof(param_record));
+    }
+    record.primative = ASTFILE_NONE;
+    for (int i = DT_VOID; i <= DT_ULONG; i++)
+    {
+        if (type == datatype_get_primative_type(i))
+            record.primative = i;
+    }
+    record.name = write_string(writer, type->name);
+    record.array_size = type->array_size;
+    record.size = type->size;
+    record.pointer_level = type->pointer_level;
+    record.is_const = type->is_const;
+    record.is_float = type->is_float;
+    record.is_unsigned = type->is_unsigned;
+
+    index = SectionCount(&writer->types, AstFileType_t);
+    section_append(&writer->types, &record, sizeof(record));
+    ptr_map_put(&writer->type_map, type, index);
+    return index;
+}
+
+static __int32_t write_nodes(AstFileWriter_t *writer, ASTNode_t *node)
+{
+    __int32_t first = SectionCount(&writer->nodes, AstFileNode_t);
+    __int32_t count = 0;
+
+    if (node == NULL)
+        return ASTFILE_NONE;
+
+    // Nodes of a list are stored next to each other, only the children
+    // recurse so long statement lists don't use a deep stack
+    for (ASTNode_t *item = node; item != NULL; item = item->next)
+    {
+        ptr_map_put(&writer->node_map, item, first + count);
+        section_append(&writer->nodes, NULL, sizeof(AstFileNode_t));
+        count++;
+    }
+
+    count = 0;
+    for (ASTNode_t *item = node; item != NULL; item = item->next, count++)
+    {
+        __int32_t index = first + count;
+        __int32_t left = write_nodes(writer, item->left);
+        __int32_t right = write_nodes(writer, item->right);
+        __int32_t expr_type = write_type(writer, item->expr_type);
+        AstFileNode_t *record = SectionGet(&writer->nodes, AstFileNode_t, index);
+        __uint32_t parent;
+
+        // Parents are always written before their children
+        if (item->parent == NULL || !ptr_map_get(&writer->node_map, item->parent, &parent))
+            parent = ASTFILE_NONE;
+
+        record->type = item->type;
+        record->next = item->next ? index + 1 : ASTFILE_NONE;
+        record->left = left;
+        record->right = right;
+        record->parent = parent;
+        record->expr_type = expr_type;
+        if (item->type == AST_STR_LIT || item->type == AST_FLOAT_LIT)
+            record->value = write_string(writer, item->value.str);
+        else if (item->type == AST_INT_LIT)
+            record->value = item->value.lit;
+        else
+            record->value = item->value.num;
+    }
+    return first;
+}
+
+// Every store is kept, the guess depends on the function making the call
+static void write_votes(AstFileWriter_t *writer, CallTargets_t *targets, __uint32_t *first, __uint32_t *count)
+{
+    *first = SectionCount(&writer->votes, AstFileVote_t);
+    *count = targets->vote_count;
+    for (size_t i = 0; i < targets->vote_count; i++)
+    {
+        AstFileVote_t record = {targets->votes[i].target, targets->votes[i].position};
+        section_append(&writer->votes, &record, sizeof(record));
+    }
+}
+
+static void write_symbols(AstFileWriter_t *writer)
+{
+    int count = symtab_global_symbol_count();
+
+    for (int i = 0; i < count; i++)
+    {
+        Symbol_t *symbol = symtab_get_symbol(i);
+        AstFileSymbol_t record = {0};
+        __uint32_t init_value;
+
+        record.name = write_string(writer, symbol->sym_name);
+        record.sym_type = symbol->sym_type;
+        record.data_type = write_type(writer, symbol->data_type);
+        record.init_value = ASTFILE_NONE;
+        record.first_arg = SectionCount(&writer->args, AstFileArg_t);
+        if (symbol->sym_type == SYMBOL_FUNC)
+        {
+            LList_t *args = &((SymbolFunc_t *)symbol)->args;
+            AstFileArg_t *arg_args = malloc((args->size ? args->size : 1) * sizeof(AstFileArg_t));
+            for (size_t j = 0; j < args->size; j++)
+            {
+                SymbolFuncArg_t *arg = LList_SymbolFuncArg_get(args, j);
+                AstFileArg_t arg_record;
+                arg_record.name = write_string(writer, arg->arg_name);
+                arg_record.type = write_type(writer, arg->arg_type);
+                write_votes(writer, &arg->targets, &arg_record.first_vote, &arg_record.vote_count);
+                arg_args[j] = arg_record;
+            }
+            // Writing the types of the arguments may add parameters of
+            // function types, the arguments are appended once they are done
+            record.first_arg = SectionCount(&writer->args, AstFileArg_t);
+            section_append(&writer->args, arg_args, args->size * sizeof(AstFileArg_t));
+            free(arg_args);
+            record.arg_count = args->size;
+            record.definition = ((SymbolFunc_t *)symbol)->definition;
+        }
+        else
+        {
+            write_votes(writer, &symbol->targets, &record.first_vote, &record.vote_count);
+            // Initializers are part of the tree, unless the declaration
+            // was already released
+            if (symbol->init_value != NULL && !ptr_map_get(&writer->node_map, symbol->init_value, &init_value))
+                init_value = write_nodes(writer, symbol->init_value);
+            if (symbol->init_value != NULL)
+                record.init_value = init_value;
+        }
+        section_append(&writer->symbols, &record, sizeof(record));
+    }
+}
+
+static size_t place_section(size_t *offset, Section_t *section)
+{
+    size_t start = (*offset + ASTFILE_SECTION_ALIGNMENT - 1) & ~(size_t)(ASTFILE_SECTION_ALIGNMENT - 1);
+    *offset = start + section->len;
+    return start;
+}
+
+bool astfile_write(char *path, ASTNode_t *root)
+{
+    AstFileWriter_t writer = {0};
+    AstFileHeader_t header = {0};
+    Section_t *sections[] = {&writer.nodes, &writer.types, &writer.symbols, &writer.args, &writer.votes, &writer.strings};
+    __uint64_t *offsets[] = {&header.nodes, &header.types, &header.symbols, &header.args, &header.votes, &header.strings};
+    size_t offset = sizeof(AstFileHeader_t);
+    char *payload;
+    FILE *file;
+
+    header.root = write_nodes(&writer, root);
+    write_symbols(&writer);
+
+    for (size_t i = 0; i < sizeof(sections) / sizeof(sections[0]); i++)
+        *offsets[i] = place_section(&offset, sections[i]);
+
+    payload = calloc(1, offset);
+    for (size_t i = 0; i < sizeof(sections) / sizeof(sections[0]); i++)
+    {
+        if (sections[i]->len)
+            memcpy(payload + *offsets[i], sections[i]->data, sections[i]->len);
+        free(sections[i]->data);
+    }
+
+    memcpy(header.magic, ASTFILE_MAGIC, sizeof(header.magic));
+    header.version = ASTFILE_VERSION;
+    header.size = offset;
+    header.node_count = SectionCount(&writer.nodes, AstFileNode_t);
+    header.type_count = SectionCount(&writer.types, AstFileType_t);
+    header.symbol_count = SectionCount(&writer.symbols, AstFileSymbol_t);
+    header.arg_count = SectionCount(&writer.args, AstFileArg_t);
+    header.vote_count = SectionCount(&writer.votes, AstFileVote_t);
+    header.strings_size = writer.strings.len;
+    header.checksum = checksum(payload + sizeof(header), offset - sizeof(header));
+    memcpy(payload, &header, sizeof(header));
+
+    free(writer.node_map.keys);
+    free(writer.node_map.values);
+    free(writer.type_map.keys);
+    free(writer.type_map.values);
+    free(writer.string_map.keys);
+    free(writer.string_map.values);
+
+    file = writer_open(path);
+    if (file == NULL)
+    {
+        free(payload);
+        return false;
+    }
+    fwrite(payload, 1, offset, file);
+    free(payload);
+    return fclose(file) == 0;
+}
+
+bool astfile_probe(char *path)
+{
+    char magic[4];
+    FILE *file = fopen(path, "rb");
+    bool found;
+
+    if (file == NULL)
+        return false;
+    found = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+            memcmp(magic, ASTFILE_MAGIC, sizeof(magic)) == 0;
+    fclose(file);
+    return found;
+}
+
+static bool valid_index(__int32_t index, __uint32_t count)
+{
+    return index == ASTFILE_NONE || (index >= 0 && (__uint32_t)index < count);
+}
+
+static bool valid_section(AstFileHeader_t *header, __uint64_t offset, __uint64_t count, size_t element_size)
+{
+    return offset % ASTFILE_SECTION_ALIGNMENT == 0 &&
+           offset >= sizeof(AstFileHeader_t) &&
+           offset <= header->size &&
+           count <= (header->size - offset) / element_size;
+}
+
+// Checks every index and offset once, readers can then follow them freely
+static bool validate(AstFile_t *file)
+{
+    AstFileHeader_t *h = file->header;
+
+    if (
+        !valid_section(h, h->nodes, h->node_count, sizeof(AstFileNode_t)) ||
+        !valid_section(h, h->types, h->type_count, sizeof(AstFileType_t)) ||
+        !valid_section(h, h->symbols, h->symbol_count, sizeof(AstFileSymbol_t)) ||
+        !valid_section(h, h->args, h->arg_count, sizeof(AstFileArg_t)) ||
+        !valid_section(h, h->votes, h->vote_count, sizeof(AstFileVote_t)) ||
+        !valid_section(h, h->strings, h->strings_size, 1) ||
+        (h->strings_size > 0 && file->strings[h->strings_size - 1] != '\0') ||
+        !valid_index(h->root, h->node_count))
+        return false;
+
+    for (__uint32_t i = 0; i < h->node_count; i++)
+    {
+        AstFileNode_t *node = &file->nodes[i];
+        if (
+            !valid_index(node->next, h->node_count) ||
+            !valid_index(node->left, h->node_count) ||
+            !valid_index(node->right, h->node_count) ||
+            !valid_index(node->parent, h->node_count) ||
+            !valid_index(node->expr_type, h->type_count) ||
+            node->type > AST_INDIRECT_CALL ||
+            ((node->type == AST_STR_LIT || node->type == AST_FLOAT_LIT) && (node->value < 0 || (__uint64_t)node->value >= h->strings_size)))
+            return false;
+    }
+    for (__uint32_t i = 0; i < h->type_count; i++)
+    {
+        AstFileType_t *type = &file->types[i];
+        if (
+            type->name >= h->strings_size ||
+            !valid_index(type->base_type, i) ||
+            !valid_index(type->return_type, i) ||
+            type->primative < ASTFILE_NONE || type->primative > DT_ULONG ||
+            type->param_count > UINT8_MAX ||
+            type->first_param > h->arg_count ||
+            type->param_count > h->arg_count - type->first_param)
+            return false;
+        for (__uint32_t j = 0; j < type->param_count; j++)
+        {
+            if (!valid_index(file->args[type->first_param + j].type, i))
+                return false;
+        }
+    }
+    for (__uint32_t i = 0; i < h->symbol_count; i++)
+    {
+        AstFileSymbol_t *symbol = &file->symbols[i];
+        if (
+            symbol->name >= h->strings_size ||
+            (symbol->sym_type != SYMBOL_VAR && symbol->sym_type != SYMBOL_FUNC && symbol->sym_type != SYMBOL_ENUM) ||
+            !valid_index(symbol->data_type, h->type_count) ||
+            !valid_index(symbol->init_value, h->node_count) ||
+            symbol->first_arg > h->arg_count ||
+            symbol->arg_count > h->arg_count - symbol->first_arg ||
+            symbol->first_vote > h->vote_count ||
+            symbol->vote_count > h->vote_count - symbol->first_vote)
+            return false;
+    }
+    for (__uint32_t i = 0; i < h->arg_count; i++)
+    {
+        if (
+            file->args[i].name >= h->strings_size ||
+            !valid_index(file->args[i].type, h->type_count) ||
+            file->args[i].first_vote > h->vote_count ||
+            file->args[i].vote_count > h->vote_count - file->args[i].first_vote)
+            return false;
+    }
+    for (__uint32_t i = 0; i < h->vote_count; i++)
+    {
+        if (
+            !valid_index(file->votes[i].target, h->symbol_count) ||
+            file->votes[i].position < 0)
+            return false;
+    }
+    return true;
+}
+
+AstFile_t *astfile_open(char *path)
+{
+    AstFile_t *file;
+    struct stat st;
+    void *data;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        debug_print(SEV_ERROR, "[ASTFILE] Couldn't open %s", path);
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(AstFileHeader_t))
+    {
+        debug_print(SEV_ERROR, "[ASTFILE] %s is too small", path);
+        close(fd);
+        return NULL;
+    }
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        debug_print(SEV_ERROR, "[ASTFILE] Couldn't map %s", path);
+        return NULL;
+    }
+
+    file = malloc(sizeof(AstFile_t));
+    file->header = data;
+    file->size = st.st_size;
+    if (
+        memcmp(file->header->magic, ASTFILE_MAGIC, sizeof(file->header->magic)) != 0 ||
+        file->header->version != ASTFILE_VERSION ||
+        file->header->size != file->size)
+    {
+        debug_print(SEV_ERROR, "[ASTFILE] %s has an unsupported version", path);
+        astfile_close(file);
+        return NULL;
+    }
+    if (file->header->checksum != checksum((char *)data + sizeof(AstFileHeader_t), file->size - sizeof(AstFileHeader_t)))
+    {
+        debug_print(SEV_ERROR, "[ASTFILE] %s is corrupted", path);
+        astfile_close(file);
+        return NULL;
+    }
+
+    file->nodes = (AstFileNode_t *)((char *)data + file->header->nodes);
+    file->types = (AstFileType_t *)((char *)data + file->header->types);
+    file->symbols = (AstFileSymbol_t *)((char *)data + file->header->symbols);
+    file->args = (AstFileArg_t *)((char *)data + file->header->args);
+    file->votes = (AstFileVote_t *)((char *)data + file->header->votes);
+    file->strings = (char *)data + file->header->strings;
+    if (!validate(file))
+    {
+        debug_print(SEV_ERROR, "[ASTFILE] %s is malformed", path);
+        astfile_close(file);
+        return NULL;
+    }
+    return file;
+}
+
+const char *astfile_str(AstFile_t *file, __uint32_t offset)
+{
+    return file->strings + offset;
+}
+
+static Datatype_t *type_at(Datatype_t **types, __int32_t index)
+{
+    return index == ASTFILE_NONE ? NULL : types[index];
+}
+
+static Datatype_t **load_types(AstFile_t *file)
+{
+    Datatype_t **types = malloc((file->header->type_count + 1) * sizeof(Datatype_t *));
+
+    // Base types always come first
+    for (__uint32_t i = 0; i < file->header->type_count; i++)
+    {
+        AstFileType_t *record = &file->types[i];
+        if (record->primative != ASTFILE_NONE)
+        {
+            types[i] = datatype_get_primative_type(record->primative);
+            continue;
+        }
+        types[i] = calloc(1, sizeof(Datatype_t));
+        types[i]->name = (char *)astfile_str(file, record->name);
+        types[i]->size = record->size;
+        types[i]->pointer_level = record->pointer_level;
+        types[i]->array_size = record->array_size;
+        types[i]->base_type = record->base_type == ASTFILE_NONE ? NULL : types[record->base_type];
+        types[i]->is_const = record->is_const;
+        types[i]->is_float = record->is_float;
+        types[i]->is_unsigned = record->is_unsigned;
+        types[i]->return_type = type_at(types, record->return_type);
+        types[i]->param_count = record->param_count;
+        types[i]->param_types = malloc((record->param_count ? record->param_count : 1) * sizeof(Datatype_t *));
+        for (__uint32_t j = 0; j < record->param_count; j++)
+            types[i]->param_types[j] = types[file->args[record->first_param + j].type];
+    }
+    return types;
+}
+
+static ASTNode_t *node_at(ASTNode_t *nodes, __int32_t index)
+{
+    return index == ASTFILE_NONE ? NULL : &nodes[index];
+}
+
+static void load_votes(AstFile_t *file, CallTargets_t *targets, __uint32_t first, __uint32_t count)
+{
+    targets->votes = malloc((count ? count : 1) * sizeof(CallVote_t));
+    targets->vote_count = count;
+    targets->vote_capacity = count ? count : 1;
+    for (__uint32_t i = 0; i < count; i++)
+        targets->votes[i] = (CallVote_t){file->votes[first + i].target, file->votes[first + i].position};
+}
+
+ASTNode_t *astfile_load(AstFile_t *file)
+{
+    AstFileHeader_t *h = file->header;
+    Datatype_t **types = load_types(file);
+    ASTNode_t *nodes = calloc(h->node_count ? h->node_count : 1, sizeof(ASTNode_t));
+    int existing = symtab_global_symbol_count();
+
+    for (__uint32_t i = 0; i < h->node_count; i++)
+    {
+        AstFileNode_t *record = &file->nodes[i];
+        nodes[i].type = (ASTNode_type_e)record->type;
+        nodes[i].next = node_at(nodes, record->next);
+        nodes[i].left = node_at(nodes, record->left);
+        nodes[i].right = node_at(nodes, record->right);
+        nodes[i].parent = node_at(nodes, record->parent);
+        nodes[i].expr_type = type_at(types, record->expr_type);
+        if (record->type == AST_STR_LIT || record->type == AST_FLOAT_LIT)
+            nodes[i].value.str = (char *)astfile_str(file, record->value);
+        else if (record->type == AST_INT_LIT)
+            nodes[i].value.lit = record->value;
+        else
+            nodes[i].value.num = (int)record->value;
+    }
+
+    // Nodes refer to symbols by index, the builtins added by the symbol
+    // table are already in place
+    for (__uint32_t i = 0; i < h->symbol_count; i++)
+    {
+        AstFileSymbol_t *record = &file->symbols[i];
+        char *name = (char *)astfile_str(file, record->name);
+        Symbol_t *symbol;
+
+        if ((int)i < existing)
+        {
+            if (strcmp(symtab_get_symbol(i)->sym_name, name) != 0)
+            {
+                debug_print(SEV_ERROR, "[ASTFILE] Symbol %s doesn't match the builtin %s", name, symtab_get_symbol(i)->sym_name);
+                exit(1);
+            }
+            continue;
+        }
+        if (symtab_add_global_symbol(name, record->sym_type, type_at(types, record->data_type)) != (int)i)
+        {
+            debug_print(SEV_ERROR, "[ASTFILE] Symbol %s can't be loaded at its index", name);
+            exit(1);
+        }
+
+        symbol = symtab_get_symbol(i);
+        if (record->sym_type != SYMBOL_FUNC)
+        {
+            load_votes(file, &symbol->targets, record->first_vote, record->vote_count);
+            symbol->init_value = node_at(nodes, record->init_value);
+            continue;
+        }
+        ((SymbolFunc_t *)symbol)->definition = record->definition;
+        for (__uint32_t j = 0; j < record->arg_count; j++)
+        {
+            AstFileArg_t *arg_record = &file->args[record->first_arg + j];
+            SymbolFuncArg_t *arg = calloc(1, sizeof(SymbolFuncArg_t));
+            arg->arg_name = (char *)astfile_str(file, arg_record->name);
+            arg->arg_type = type_at(types, arg_record->type);
+            load_votes(file, &arg->targets, arg_record->first_vote, arg_record->vote_count);
+            LList_SymbolFuncArg_append(&((SymbolFunc_t *)symbol)->args, arg);
+        }
+    }
+
+    free(types);
+    return node_at(nodes, h->root);
+}
+
+void astfile_close(AstFile_t *file)
+{
+    munmap(file->header, file->size);
+    free(file);
+}
@@ -0,0 +1,163 @@
+#ifndef _ASTFILE_H_
+#define _ASTFILE_H_
+
+#include "ast.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define ASTFILE_MAGIC "TCCA"
+#define ASTFILE_VERSION 9
+#define ASTFILE_NONE -1 /**< Index standing for a NULL pointer. */
+
+/**
+ * @brief Header at the start of a serialized tree.
+ *
+ * Every section starts at a multiple of 8 bytes from the start of the file
+ * and everything refers to nodes, types, symbols and strings by index or by
+ * offset, so the file can be mapped anywhere and read in place.
+ */
+typedef struct
+{
+    char magic[4];
+    __uint32_t version;
+    __uint64_t size;     /**< Size of the whole file. */
+    __uint64_t checksum; /**< Checksum of everything after the header. */
+    __int32_t root;      /**< First top-level declaration. */
+    __uint32_t node_count;
+    __uint32_t type_count;
+    __uint32_t symbol_count;
+    __uint32_t arg_count;
+    __uint32_t vote_count;
+    __uint32_t strings_size;
+    __uint64_t nodes;   /**< Offset of the AstFileNode_t array. */
+    __uint64_t types;   /**< Offset of the AstFileType_t array. */
+    __uint64_t symbols; /**< Offset of the AstFileSymbol_t array. */
+    __uint64_t args;    /**< Offset of the AstFileArg_t array. */
+    __uint64_t votes;   /**< Offset of the AstFileVote_t array. */
+    __uint64_t strings; /**< Offset of the interned, NUL terminated strings. */
+} AstFileHeader_t;
+
+typedef struct
+{
+    __uint32_t type; /**< ASTNode_type_e of the node. */
+    __int32_t next;
+    __int32_t left;
+    __int32_t right;
+    __int32_t parent;
+    __int32_t expr_type;
+    __int64_t value; /**< Value of the node, or string offset for AST_STR_LIT and AST_FLOAT_LIT. */
+} AstFileNode_t;
+
+typedef struct
+{
+    __uint32_t name;      /**< String offset. */
+    __int32_t base_type;  /**< Type index. */
+    __int32_t primative;  /**< Datatype_Primative_e for the builtin types, ASTFILE_NONE otherwise. */
+    __uint32_t array_size;
+    __uint8_t size;
+    __int8_t pointer_level;
+    __uint8_t is_const;
+    __uint8_t is_float;
+    __uint8_t is_unsigned;
+    __int32_t return_type;  /**< Type index, ASTFILE_NONE for the types other than functions. */
+    __uint32_t first_param; /**< Index of the AstFileArg_t of the first parameter of a function type. */
+    __uint32_t param_count;
+} AstFileType_t;
+
+typedef struct
+{
+    __uint32_t name; /**< String offset. */
+    __uint32_t sym_type;
+    __int32_t data_type;  /**< Type index. */
+    __int32_t init_value; /**< Node index. */
+    __uint32_t first_arg; /**< Index of the first argument of a function. */
+    __uint32_t arg_count;
+    __uint32_t first_vote; /**< Index of the first store to a function pointer. */
+    __uint32_t vote_count;
+    __int32_t definition; /**< Position of the definition of a function. */
+} AstFileSymbol_t;
+
+typedef struct
+{
+    __uint32_t name; /**< String offset. */
+    __int32_t type;  /**< Type index. */
+    __uint32_t first_vote;
+    __uint32_t vote_count;
+} AstFileArg_t;
+
+typedef struct
+{
+    __int32_t target; /**< Symbol index of the stored function. */
+    __int32_t position; /**< Position of the declaration holding the store. */
+} AstFileVote_t;
+
+/**
+ * @brief A serialized tree mapped in memory.
+ */
+typedef struct
+{
+    AstFileHeader_t *header;
+    AstFileNode_t *nodes;
+    AstFileType_t *types;
+    AstFileSymbol_t *symbols;
+    AstFileArg_t *args;
+    AstFileVote_t *votes;
+    char *strings;
+    size_t size; /**< Size of the mapping. */
+} AstFile_t;
+
+/**
+ * @brief Writes the parsed tree and the symbol table to `path`.
+ *
+ * Strings are interned so every identifier and literal is stored once.
+ *
+ * @param path Path of the file to write.
+ * @param root Pointer to the first top-level declaration.
+ * @return true on success, false otherwise.
+ */
+bool astfile_write(char *path, ASTNode_t *root);
+
+/**
+ * @brief Checks whether `path` holds a serialized tree.
+ *
+ * @param path Path of the file to check.
+ * @return true if the file starts with ASTFILE_MAGIC.
+ */
+bool astfile_probe(char *path);
+
+/**
+ * @brief Maps a serialized tree in memory.
+ *
+ * The version, the size of every section and the checksum are verified,
+ * then the tree can be read in place with astfile_str() and the section
+ * pointers.
+ *
+ * @param path Path of the file to open.
+ * @return The mapped file, or NULL if it is missing or invalid.
+ */
+AstFile_t *astfile_open(char *path);
+
+/**
+ * @brief Returns the string at `offset` in the string section.
+ */
+const char *astfile_str(AstFile_t *file, __uint32_t offset);
+
+/**
+ * @brief Rebuilds the symbol table and the AST of a mapped file.
+ *
+ * Symbols are added to the global symbol table at the index they had when
+ * the file was written. Strings are used in place, so the file must stay
+ * open as long as the tree is used.
+ *
+ * @param file Pointer to the mapped file.
+ * @return Pointer to the first top-level declaration.
+ */
+ASTNode_t *astfile_load(AstFile_t *file);
+
+/**
+ * @brief Unmaps a serialized tree.
+ */
+void astfile_close(AstFile_t *file);
+
+#endif // _ASTFILE_H_
@@ -0,0 +1,1055 @@
+/**
+ * @file bytecode.c
+ * @brief Lowering of the AST to the bytecode run by the interpreter.
+ *
+ * Follows the structure of codegen.c: expressions are evaluated into
+ * registers allocated like a stack, the result of an expression is always
+ * the first register it allocated.
+ *
+ * @project ToyCComp
+ */
+
+#define _GNU_SOURCE
+
+#include "bytecode.h"
+#include "consteval.h"
+#include "debug.h"
+#include "symtab.h"
+#include "llist_definitions.h"
+
+#include <dlfcn.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    Bytecode_t *program;
+    int top;            /**< First free register. */
+    int params;         /**< Registers holding the parameters, the first ones. */
+    int max_reg;        /**< Registers used by the current function. */
+    int func;           /**< Symbol index of the current function. */
+    size_t *breaks;     /**< Jumps to the end of the enclosing loops. */
+    size_t break_count;
+    size_t break_capacity;
+    bool *address_taken; /**< Functions used as pointers, indexed by symbol index. */
+    long *locals_offsets; /**< Offset of the local arrays in the locals of a call, indexed by symbol index. */
+    size_t locals_size;   /**< Bytes of the local arrays of the current function. */
+} BcGen_t;
+
+static const struct
+{
+    char *name;
+    Builtin_e builtin;
+} builtins[] = {
+    {"print", BUILTIN_PRINT},
+    {"print_char", BUILTIN_PRINT_CHAR},
+    {"print_str", BUILTIN_PRINT_STR},
+    {"print_ln", BUILTIN_PRINT_LN},
+    {"print_double", BUILTIN_PRINT_DOUBLE},
+    {"arena_new", BUILTIN_ARENA_NEW},
+    {"arena_alloc", BUILTIN_ARENA_ALLOC},
+    {"arena_reset", BUILTIN_ARENA_RESET},
+};
+
+static int gen_expr(BcGen_t *g, ASTNode_t *root);
+static void gen_statements(BcGen_t *g, ASTNode_t *root);
+
+static int size_index(int size)
+{
+    switch (size)
+    {
+    case 8:
+        return 0;
+    case 16:
+        return 1;
+    case 32:
+        return 2;
+    default:
+        return 3;
+    }
+}
+
+static int expr_size(ASTNode_t *root)
+{
+    // Offsets are always added to a pointer
+    if (root->type == AST_OFFSET_SCALE)
+        return 64;
+    return root->expr_type->size;
+}
+
+// char arithmetic is done in 32 bits, like in the native code
+static int arith_size(ASTNode_t *root)
+{
+    return expr_size(root) < 32 ? 32 : expr_size(root);
+}
+
+static bool is_comparison(ASTNode_t *root)
+{
+    return root->type >= AST_COMP_GT && root->type <= AST_COMP_NE;
+}
+
+static bool is_float(ASTNode_t *root)
+{
+    return root->type != AST_OFFSET_SCALE && datatype_is_float(root->expr_type);
+}
+
+static bool is_uint32(Datatype_t *type)
+{
+    return type->size == 32 && datatype_is_unsigned(type);
+}
+
+// Loads zero extend the unsigned ints, like the narrower types
+static Opcode_e load_op(Opcode_e sized, Opcode_e unsigned32, Datatype_t *type)
+{
+    return is_uint32(type) ? unsigned32 : sized + size_index(type->size);
+}
+
+static bool is_float_comparison(ASTNode_t *root)
+{
+    return datatype_is_float(datatype_expr_type(root->left->expr_type, root->right->expr_type));
+}
+
+static size_t emit(BcGen_t *g, Opcode_e op, int a, int b, int c, long imm)
+{
+    Bytecode_t *p = g->program;
+
+    if (p->code_count == p->code_capacity)
+    {
+        p->code_capacity = p->code_capacity ? p->code_capacity * 2 : 1024;
+        p->code = realloc(p->code, p->code_capacity * sizeof(Instr_t));
+    }
+    p->code[p->code_count] = (Instr_t){op, a, b, c, (__int32_t)imm};
+    return p->code_count++;
+}
+
+static void patch(BcGen_t *g, size_t at, size_t target)
+{
+    g->program->code[at].imm = (__int32_t)target;
+}
+
+static int alloc_reg(BcGen_t *g)
+{
+    if (g->top == BYTECODE_MAX_REGS)
+    {
+        debug_print(SEV_ERROR, "[BC] Expression too complex in %s", symtab_get_symbol(g->func)->sym_name);
+        exit(1);
+    }
+    if (g->top + 1 > g->max_reg)
+        g->max_reg = g->top + 1;
+    return g->top++;
+}
+
+static size_t alloc_data(BcGen_t *g, size_t size, size_t align)
+{
+    Bytecode_t *p = g->program;
+    size_t offset = (p->data_size + align - 1) & ~(align - 1);
+
+    if (offset + size > p->data_capacity)
+    {
+        size_t capacity = p->data_capacity ? p->data_capacity : 4096;
+        while (offset + size > capacity)
+            capacity *= 2;
+        p->data = realloc(p->data, capacity);
+        memset(p->data + p->data_capacity, 0, capacity - p->data_capacity);
+        p->data_capacity = capacity;
+    }
+    p->data_size = offset + size;
+    if (offset + size > INT32_MAX)
+    {
+        debug_print(SEV_ERROR, "[BC] Program data is larger than 2GB");
+        exit(1);
+    }
+    return offset;
+}
+
+// Size of the values stored in a variable, the elements for arrays
+static int var_size(Symbol_t *symbol)
+{
+    if (symbol->data_type->array_size > 0)
+        return datatype_deref_pointer(symbol->data_type, 1)->size;
+    return symbol->data_type->size;
+}
+
+static long var_offset(BcGen_t *g, int index)
+{
+    Bytecode_t *p = g->program;
+    Symbol_t *symbol = symtab_get_symbol(index);
+
+    if (p->var_offsets[index] == BYTECODE_NO_OFFSET)
+    {
+        size_t bytes = var_size(symbol) / 8;
+        size_t count = symbol->data_type->array_size ? symbol->data_type->array_size : 1;
+        p->var_offsets[index] = alloc_data(g, bytes * count, bytes);
+    }
+    return p->var_offsets[index];
+}
+
+static bool is_local_array(BcGen_t *g, int index)
+{
+    return g->locals_offsets[index] != BYTECODE_NO_OFFSET;
+}
+
+// Address of a variable, local arrays are in the locals of the call
+static int gen_var_addr(BcGen_t *g, int index)
+{
+    int r = alloc_reg(g);
+
+    if (is_local_array(g, index))
+        emit(g, OP_LADDR, r, 0, 0, g->locals_offsets[index]);
+    else
+        emit(g, OP_ADDR, r, 0, 0, var_offset(g, index));
+    return r;
+}
+
+static long string_offset(BcGen_t *g, char *str)
+{
+    size_t len = strlen(str) + 1;
+    size_t offset = alloc_data(g, len, 1);
+
+    memcpy(g->program->data + offset, str, len);
+    return offset;
+}
+
+static void add_reloc(BcGen_t *g, size_t offset, size_t target)
+{
+    Bytecode_t *p = g->program;
+
+    p->relocs = realloc(p->relocs, (p->reloc_count + 1) * sizeof(BytecodeReloc_t));
+    p->relocs[p->reloc_count++] = (BytecodeReloc_t){offset, target};
+}
+
+static int gen_const(BcGen_t *g, long value)
+{
+    Bytecode_t *p = g->program;
+    int r = alloc_reg(g);
+
+    if (value >= INT32_MIN && value <= INT32_MAX)
+    {
+        emit(g, OP_LOADI, r, 0, 0, value);
+        return r;
+    }
+    p->constants = realloc(p->constants, (p->constant_count + 1) * sizeof(long));
+    p->constants[p->constant_count] = value;
+    emit(g, OP_LOADK, r, 0, 0, p->constant_count++);
+    return r;
+}
+
+// Floating point constants are held as the bits of a double
+static int gen_float_const(BcGen_t *g, double value)
+{
+    return gen_const(g, consteval_float_bits(value, 64));
+}
+
+static int gen_expr_widen(BcGen_t *g, ASTNode_t *root, int size)
+{
+    int r = gen_expr(g, root);
+
+    // Widening keeps the value as it is, narrowing wraps it
+    if (size < expr_size(root))
+        emit(g, OP_CAST8 + size_index(size), r, 0, 0, 0);
+    return r;
+}
+
+// Converts the value of an expression to another type like an assignment
+static int gen_expr_convert(BcGen_t *g, ASTNode_t *root, Datatype_t *type)
+{
+    int r;
+
+    // int and unsigned int values of the same bits are extended differently
+    if (!datatype_is_float(type) && !is_float(root))
+    {
+        r = gen_expr_widen(g, root, type->size);
+        if (is_uint32(type) && expr_size(root) >= 32 && (root->type == AST_OFFSET_SCALE || !is_uint32(root->expr_type)))
+            emit(g, OP_CASTU32, r, 0, 0, 0);
+        else if (type->size == 32 && !datatype_is_unsigned(type) && root->type != AST_OFFSET_SCALE && is_uint32(root->expr_type))
+            emit(g, OP_CAST32, r, 0, 0, 0);
+        return r;
+    }
+
+    r = gen_expr(g, root);
+    if (datatype_is_float(type))
+    {
+        if (!is_float(root))
+            emit(g, datatype_is_unsigned(root->expr_type) ? OP_U2F : OP_I2F, r, 0, 0, 0);
+        if (type->size == 32 && (!is_float(root) || expr_size(root) == 64))
+            emit(g, OP_FROUND, r, 0, 0, 0);
+        return r;
+    }
+    emit(g, datatype_is_unsigned(type) && type->size == 64 ? OP_F2U : OP_F2I, r, 0, 0, 0);
+    if (is_uint32(type))
+        emit(g, OP_CASTU32, r, 0, 0, 0);
+    else if (type->size < 64)
+        emit(g, OP_CAST8 + size_index(type->size), r, 0, 0, 0);
+    return r;
+}
+
+// floats are stored in 32 bits and held as doubles in the registers
+static void gen_narrow_float(BcGen_t *g, int r, Datatype_t *type)
+{
+    if (datatype_is_float(type) && type->size == 32)
+        emit(g, OP_FNARROW, r, 0, 0, 0);
+}
+
+static void gen_widen_float(BcGen_t *g, int r, Datatype_t *type)
+{
+    if (datatype_is_float(type) && type->size == 32)
+        emit(g, OP_FWIDEN, r, 0, 0, 0);
+}
+
+static int gen_expr_comparison(BcGen_t *g, ASTNode_t *root)
+{
+    Datatype_t *type = datatype_expr_type(root->left->expr_type, root->right->expr_type);
+    int left = gen_expr_convert(g, root->left, type);
+    int right = gen_expr_convert(g, root->right, type);
+    Opcode_e op = datatype_is_float(type) ? OP_FGT : OP_GT;
+
+    // Equality doesn't depend on the sign
+    if (datatype_is_unsigned(type) && root->type <= AST_COMP_LE)
+        op = OP_GTU;
+    emit(g, op + (root->type - AST_COMP_GT), left, left, right, 0);
+    g->top = left + 1;
+    return left;
+}
+
+static int gen_expr_float(BcGen_t *g, ASTNode_t *root)
+{
+    int r;
+
+    r = gen_expr_convert(g, root->left, root->expr_type);
+    gen_expr_convert(g, root->right, root->expr_type);
+    emit(g, OP_FADD + (root->type - AST_ADD), r, r, r + 1, 0);
+    if (root->expr_type->size == 32)
+        emit(g, OP_FROUND, r, 0, 0, 0);
+    g->top = r + 1;
+    return r;
+}
+
+// The operands are converted to the unsigned type of the expression, and are
+// then zero extended like the result
+static int gen_expr_unsigned(BcGen_t *g, ASTNode_t *root)
+{
+    int size = arith_size(root);
+    ConstValue_t value;
+    int r = gen_expr_convert(g, root->left, root->expr_type);
+    bool is_const = consteval_expr(root->right, &value) && value.type == CONST_INT && value.num > 0 && value.num <= INT32_MAX;
+
+    // Division and modulo by a power of two are a shift and a mask
+    if (is_const && root->type >= AST_DIV && (value.num & (value.num - 1)) == 0)
+    {
+        if (root->type == AST_DIV)
+            emit(g, OP_SHRI, r, r, 0, __builtin_ctzl(value.num));
+        else
+            emit(g, OP_ANDI, r, r, 0, value.num - 1);
+        return r;
+    }
+    if (is_const && root->type < AST_DIV)
+        emit(g, OP_ADDI8 + 4 * (root->type - AST_ADD) + size_index(size), r, r, 0, value.num);
+    else
+    {
+        gen_expr_convert(g, root->right, root->expr_type);
+        if (root->type == AST_DIV || root->type == AST_MOD)
+            emit(g, root->type == AST_DIV ? OP_DIVU : OP_MODU, r, r, r + 1, 0);
+        else
+            emit(g, OP_ADD8 + 4 * (root->type - AST_ADD) + size_index(size), r, r, r + 1, 0);
+        g->top = r + 1;
+    }
+    if (size == 32 && root->type < AST_DIV)
+        emit(g, OP_CASTU32, r, 0, 0, 0);
+    return r;
+}
+
+static int gen_expr_arr_index(BcGen_t *g, ASTNode_t *root)
+{
+    int scale = (int)log2(root->value.num / 8);
+    int r, index;
+
+    if (root->left->type == AST_VAR && root->left->expr_type->array_size > 0)
+    {
+        index = gen_expr_widen(g, root->right, 64);
+        if (is_local_array(g, root->left->value.num))
+            emit(g, OP_LINDEX, index, index, scale, g->locals_offsets[root->left->value.num]);
+        else
+            emit(g, OP_INDEX, index, index, scale, var_offset(g, root->left->value.num));
+        return index;
+    }
+
+    // Pointers are indexed through their value
+    r = gen_expr(g, root->left);
+    index = gen_expr_widen(g, root->right, 64);
+    emit(g, OP_MULI64, index, index, 0, 1 << scale);
+    emit(g, OP_ADD64, r, r, index, 0);
+    g->top = r + 1;
+    return r;
+}
+
+// The interpreter runs the iterations of parallel_for in order, one of the
+// schedules the thread pool of the runtime may pick
+static int gen_parallel_for(BcGen_t *g, ASTNode_t *root)
+{
+    ASTNode_t *lo = root->left;
+    int base = g->top;
+    size_t loop;
+
+    gen_expr_convert(g, lo, DATATYPE_LONG);
+    gen_expr_convert(g, lo->next, DATATYPE_LONG);
+    alloc_reg(g);
+    loop = emit(g, OP_JGE, base, base + 1, 0, 0);
+    emit(g, OP_ADDI64, base + 2, base, 0, 0);
+    emit(g, OP_CALL, base + 2, 1, 0, lo->next->next->value.num);
+    emit(g, OP_ADDI64, base, base, 0, 1);
+    emit(g, OP_JMP, 0, 0, 0, loop);
+    patch(g, loop, g->program->code_count);
+    g->top = base + 1;
+    return base;
+}
+
+static int gen_expr_fcall(BcGen_t *g, ASTNode_t *root)
+{
+    SymbolFunc_t *func = (SymbolFunc_t *)symtab_get_symbol(root->value.num);
+    int base = g->top;
+    int nargs = 0;
+
+    if (strcmp(func->sym_name, "parallel_for") == 0)
+        return gen_parallel_for(g, root);
+
+    // Arguments are evaluated in the registers the callee starts with
+    for (ASTNode_t *arg = root->left; arg != NULL; arg = arg->next, nargs++)
+    {
+        SymbolFuncArg_t *formal_arg = LList_SymbolFuncArg_get(&func->args, nargs);
+        gen_expr_convert(g, arg, formal_arg->arg_type);
+    }
+    if (nargs == 0)
+        alloc_reg(g);
+
+    emit(g, OP_CALL, base, nargs, 0, root->value.num);
+    g->top = base + 1;
+    return base;
+}
+
+// Operands are evaluated in consecutive registers like call arguments
+// The pointer is evaluated first, the arguments in the registers after it.
+// There is no guess of the target like in the generated assembly, the
+// dispatch on the pointer is the same for every callee
+static int gen_indirect_call(BcGen_t *g, ASTNode_t *root)
+{
+    Datatype_t *func = root->right->expr_type->base_type;
+    int base = gen_expr(g, root->right);
+    int nargs = 0;
+
+    for (ASTNode_t *arg = root->left; arg != NULL; arg = arg->next, nargs++)
+        gen_expr_convert(g, arg, func->param_types[nargs]);
+    if (nargs == 0)
+        alloc_reg(g);
+
+    emit(g, OP_CALLR, base + 1, nargs, base, 0);
+    emit(g, OP_ADDI64, base, base + 1, 0, 0);
+    g->top = base + 1;
+    return base;
+}
+
+static int gen_expr_atomic(BcGen_t *g, ASTNode_t *root)
+{
+    AtomicOp_e op = ASTAtomicOp(root->value.num);
+    ASTNode_t *ptr = root->left;
+    int base = g->top;
+    int size = 0;
+    Datatype_t *type;
+
+    if (op == ATOMIC_FENCE)
+        alloc_reg(g);
+    else
+    {
+        type = datatype_deref_pointer(ptr->expr_type, 1);
+        size = type->size;
+        gen_expr(g, ptr);
+        for (ASTNode_t *arg = ptr->next; arg != NULL; arg = arg->next)
+        {
+            if (op == ATOMIC_COMPARE_EXCHANGE && arg == ptr->next)
+                gen_expr(g, arg);
+            else
+                gen_expr_convert(g, arg, type);
+        }
+    }
+    emit(g, OP_ATOMIC, base, op, size_index(size), ASTAtomicOrder(root->value.num));
+    if (is_uint32(root->expr_type))
+        emit(g, OP_CASTU32, base, 0, 0, 0);
+    g->top = base + 1;
+    return base;
+}
+
+static int gen_expr(BcGen_t *g, ASTNode_t *root)
+{
+    int size = expr_size(root);
+    ConstValue_t value;
+    int r;
+
+    // Floating point constants are folded like the integer ones below
+    if (is_float(root) && consteval_expr(root, &value) && consteval_convert(&value, root->expr_type))
+        return gen_float_const(g, value.fnum);
+
+    switch (root->type)
+    {
+    case AST_FUNC_CALL:
+        return gen_expr_fcall(g, root);
+    case AST_INDIRECT_CALL:
+        return gen_indirect_call(g, root);
+    case AST_ATOMIC:
+        return gen_expr_atomic(g, root);
+    case AST_ADDRESSOF:
+        return gen_var_addr(g, root->left->value.num);
+    case AST_COMP_GT:
+    case AST_COMP_GE:
+    case AST_COMP_LT:
+    case AST_COMP_LE:
+    case AST_COMP_EQ:
+    case AST_COMP_NE:
+        return gen_expr_comparison(g, root);
+
+    case AST_ADD:
+    case AST_SUBTRACT:
+    case AST_MULT:
+    case AST_DIV:
+    case AST_MOD:
+        if (is_float(root))
+            return gen_expr_float(g, root);
+        // Fold arithmetic on constants, e.g. on const variables
+        if (consteval_expr(root, &value) && value.type == CONST_INT)
+            return gen_const(g, value.num);
+        if (datatype_is_unsigned(root->expr_type))
+            return gen_expr_unsigned(g, root);
+        size = arith_size(root);
+        r = gen_expr_widen(g, root->left, size);
+        // Constant operands are kept in the instruction
+        if (
+            consteval_expr(root->right, &value) && value.type == CONST_INT &&
+            value.num >= INT32_MIN && value.num <= INT32_MAX &&
+            !(root->type >= AST_DIV && (value.num == 0 || value.num == -1)))
+        {
+            emit(g, OP_ADDI8 + 4 * (root->type - AST_ADD) + size_index(size), r, r, 0, value.num);
+            return r;
+        }
+        gen_expr_widen(g, root->right, size);
+        emit(g, OP_ADD8 + 4 * (root->type - AST_ADD) + size_index(size), r, r, r + 1, 0);
+        g->top = r + 1;
+        return r;
+
+    case AST_INT_LIT:
+        // Unsigned literals are zero extended
+        consteval_expr(root, &value);
+        return gen_const(g, value.num);
+    case AST_STR_LIT:
+        r = alloc_reg(g);
+        emit(g, OP_ADDR, r, 0, 0, string_offset(g, root->value.str));
+        return r;
+    case AST_VAR:
+        // Arrays evaluate to the address of their first element
+        if (root->expr_type->array_size > 0)
+            return gen_var_addr(g, root->value.num);
+        // const scalars are used as immediates instead of being loaded
+        if (consteval_expr(root, &value) && value.type == CONST_INT)
+            return gen_const(g, value.num);
+        r = alloc_reg(g);
+        emit(g, load_op(OP_LOADG8, OP_LOADGU32, root->expr_type), r, 0, 0, var_offset(g, root->value.num));
+        gen_widen_float(g, r, root->expr_type);
+        return r;
+    case AST_PARAM:
+        // Parameters are already converted to their type by the caller
+        r = alloc_reg(g);
+        emit(g, OP_ADDI64, r, root->value.num, 0, 0);
+        return r;
+    case AST_FUNC_ADDR:
+        g->address_taken[root->value.num] = true;
+        return gen_const(g, root->value.num + 1);
+    case AST_OFFSET_SCALE:
+        r = gen_expr_widen(g, root->left, 64);
+        emit(g, OP_MULI64, r, r, 0, root->value.num);
+        return r;
+    case AST_PTRDREF:
+        r = gen_expr(g, root->left);
+        emit(g, load_op(OP_LOAD8, OP_LOADU32, root->expr_type), r, r, 0, 0);
+        gen_widen_float(g, r, root->expr_type);
+        return r;
+    case AST_ARRAY_INDEX:
+        r = gen_expr_arr_index(g, root);
+        emit(g, load_op(OP_LOAD8, OP_LOADU32, root->expr_type), r, r, 0, 0);
+        gen_widen_float(g, r, root->expr_type);
+        return r;
+
+    default:
+        debug_print(SEV_ERROR, "[BC] Unexpected type: %s in gen_expr", NodeToString(*root));
+        exit(1);
+    }
+}
+
+// Jumps when the condition is `when`, comparisons are fused with the jump
+static size_t gen_cond_jump(BcGen_t *g, ASTNode_t *cond, bool when)
+{
+    static const Opcode_e negated[] = {OP_JLE, OP_JLT, OP_JGE, OP_JGT, OP_JNE, OP_JEQ};
+    size_t at;
+
+    // Floating point comparisons with NaN can't be negated, they are
+    // evaluated and tested instead
+    if (is_comparison(cond) && !is_float_comparison(cond))
+    {
+        Datatype_t *type = datatype_expr_type(cond->left->expr_type, cond->right->expr_type);
+        int left = gen_expr_convert(g, cond->left, type);
+        int right = gen_expr_convert(g, cond->right, type);
+        int index = cond->type - AST_COMP_GT;
+        Opcode_e op = when ? (Opcode_e)(OP_JGT + index) : negated[index];
+
+        // Equality doesn't depend on the sign
+        if (datatype_is_unsigned(type) && op <= OP_JLE)
+            op += OP_JGTU - OP_JGT;
+        at = emit(g, op, left, right, 0, 0);
+    }
+    else
+    {
+        int r = gen_expr(g, cond);
+        at = emit(g, when ? OP_JNZ : OP_JZ, r, 0, 0, 0);
+    }
+    g->top = g->params;
+    return at;
+}
+
+static void gen_store(BcGen_t *g, ASTNode_t *lvalue, int value)
+{
+    int size = lvalue->expr_type->size;
+    int addr;
+
+    if (lvalue->type != AST_PARAM)
+        gen_narrow_float(g, value, lvalue->expr_type);
+    switch (lvalue->type)
+    {
+    case AST_VAR:
+        emit(g, OP_STOREG8 + size_index(size), 0, value, 0, var_offset(g, lvalue->value.num));
+        return;
+    case AST_PARAM:
+        emit(g, OP_ADDI64, lvalue->value.num, value, 0, 0);
+        return;
+    case AST_PTRDREF:
+        addr = gen_expr(g, lvalue->left);
+        break;
+    case AST_ARRAY_INDEX:
+        addr = gen_expr_arr_index(g, lvalue);
+        break;
+    default:
+        debug_print(SEV_ERROR, "[BC] Unsupported lvalue type %s", NodeToString(*lvalue));
+        exit(1);
+    }
+    emit(g, OP_STORE8 + size_index(size), addr, value, 0, 0);
+}
+
+// Writes a constant in the data, addresses are filled in at load time
+static void init_data(BcGen_t *g, Symbol_t *symbol, size_t offset, Datatype_t *type, ASTNode_t *init)
+{
+    Bytecode_t *p = g->program;
+    ConstValue_t value;
+    long num;
+    int index;
+
+    if (!consteval_expr(init, &value) || !consteval_convert(&value, type))
+    {
+        debug_print(SEV_ERROR, "[BC] Initializer of global %s is not a constant expression", symbol->sym_name);
+        exit(1);
+    }
+
+    switch (value.type)
+    {
+    case CONST_INT:
+        num = value.num;
+        memcpy(p->data + offset, &num, type->size / 8);
+        return;
+    case CONST_FLOAT:
+        num = consteval_float_bits(value.fnum, type->size);
+        memcpy(p->data + offset, &num, type->size / 8);
+        return;
+    case CONST_ADDR:
+        index = symtab_find_global_symbol(value.base);
+        if (symtab_get_symbol(index)->sym_type == SYMBOL_FUNC)
+        {
+            num = index + 1;
+            memcpy(p->data + offset, &num, sizeof(num));
+            g->address_taken[index] = true;
+            return;
+        }
+        add_reloc(g, offset, var_offset(g, index) + value.num);
+        return;
+    case CONST_STR:
+        add_reloc(g, offset, string_offset(g, value.base) + value.num);
+        return;
+    }
+}
+
+static bool is_const_initializer(ASTNode_t *root)
+{
+    ConstValue_t value;
+
+    if (root->type != AST_INIT_LIST)
+        return consteval_expr(root, &value);
+    for (ASTNode_t *elem = root->left; elem; elem = elem->next)
+    {
+        if (!consteval_expr(elem, &value))
+            return false;
+    }
+    return true;
+}
+
+// Like in C a shorter initializer leaves the other elements zeroed, an array
+// without one keeps whatever the locals held
+static void gen_decl_local_array(BcGen_t *g, Symbol_t *symbol, long offset, ASTNode_t *init)
+{
+    Datatype_t *type = datatype_deref_pointer(symbol->data_type, 1);
+    int size = type->size;
+    size_t count = 0;
+
+    if (init == NULL)
+        return;
+    for (ASTNode_t *elem = init->left; elem; elem = elem->next)
+        count++;
+    if (count < symbol->data_type->array_size)
+    {
+        int bytes = gen_const(g, (size / 8) * symbol->data_type->array_size);
+        emit(g, OP_LZERO, bytes, 0, 0, offset);
+        g->top = g->params;
+    }
+    for (ASTNode_t *elem = init->left; elem; elem = elem->next, offset += size / 8)
+    {
+        int value = gen_expr_convert(g, elem, type);
+        int addr = alloc_reg(g);
+
+        gen_narrow_float(g, value, type);
+        emit(g, OP_LADDR, addr, 0, 0, offset);
+        emit(g, OP_STORE8 + size_index(size), addr, value, 0, 0);
+        g->top = g->params;
+    }
+}
+
+static void gen_decl_var(BcGen_t *g, ASTNode_t *root, bool is_global)
+{
+    Symbol_t *symbol = symtab_get_symbol(root->value.num);
+    int size = var_size(symbol);
+    ASTNode_t *init = root->left;
+    Datatype_t *type = symbol->data_type;
+
+    if (!is_global && is_local_array(g, root->value.num))
+    {
+        gen_decl_local_array(g, symbol, g->locals_offsets[root->value.num], init);
+        return;
+    }
+
+    size_t offset = var_offset(g, root->value.num);
+    if (symbol->data_type->array_size > 0)
+        type = datatype_deref_pointer(symbol->data_type, 1);
+    if (init == NULL)
+        return;
+
+    // const variables with a constant value are initialized once like globals
+    if (is_global || (type->is_const && is_const_initializer(init)))
+    {
+        if (init->type != AST_INIT_LIST)
+        {
+            init_data(g, symbol, offset, type, init);
+            return;
+        }
+        for (ASTNode_t *elem = init->left; elem; elem = elem->next, offset += size / 8)
+            init_data(g, symbol, offset, type, elem);
+        return;
+    }
+
+    if (init->type != AST_INIT_LIST)
+    {
+        int value = gen_expr_convert(g, init, type);
+        gen_narrow_float(g, value, type);
+        emit(g, OP_STOREG8 + size_index(size), 0, value, 0, offset);
+        g->top = g->params;
+        return;
+    }
+    for (ASTNode_t *elem = init->left; elem; elem = elem->next, offset += size / 8)
+    {
+        int value = gen_expr_convert(g, elem, type);
+        gen_narrow_float(g, value, type);
+        emit(g, OP_STOREG8 + size_index(size), 0, value, 0, offset);
+        g->top = g->params;
+    }
+}
+
+static void push_break(BcGen_t *g, size_t at)
+{
+    if (g->break_count == g->break_capacity)
+    {
+        g->break_capacity = g->break_capacity ? g->break_capacity * 2 : 16;
+        g->breaks = realloc(g->breaks, g->break_capacity * sizeof(size_t));
+    }
+    g->breaks[g->break_count++] = at;
+}
+
+static void patch_breaks(BcGen_t *g, size_t first, size_t target)
+{
+    for (size_t i = first; i < g->break_count; i++)
+        patch(g, g->breaks[i], target);
+    g->break_count = first;
+}
+
+static void gen_statement(BcGen_t *g, ASTNode_t *root)
+{
+    size_t first_break = g->break_count;
+    size_t start, jump, end_jump;
+    int r;
+
+    switch (root->type)
+    {
+    case AST_VAR_DECL:
+        gen_decl_var(g, root, false);
+        break;
+    case AST_ASSIGN:
+        r = gen_expr_convert(g, root->right, root->left->expr_type);
+        gen_store(g, root->left, r);
+        break;
+    case AST_IF:
+        jump = gen_cond_jump(g, root->left, false);
+        gen_statements(g, root->right->left);
+        if (root->right->right)
+        {
+            end_jump = emit(g, OP_JMP, 0, 0, 0, 0);
+            patch(g, jump, g->program->code_count);
+            gen_statements(g, root->right->right);
+            jump = end_jump;
+        }
+        patch(g, jump, g->program->code_count);
+        break;
+    case AST_WHILE:
+        start = g->program->code_count;
+        jump = gen_cond_jump(g, root->left, false);
+        gen_statements(g, root->right);
+        emit(g, OP_JMP, 0, 0, 0, start);
+        patch(g, jump, g->program->code_count);
+        patch_breaks(g, first_break, g->program->code_count);
+        break;
+    case AST_DO_WHILE:
+        start = g->program->code_count;
+        gen_statements(g, root->right);
+        patch(g, gen_cond_jump(g, root->left, true), start);
+        patch_breaks(g, first_break, g->program->code_count);
+        break;
+    case AST_FOR:
+        gen_statement(g, root->left);
+        start = g->program->code_count;
+        jump = gen_cond_jump(g, root->left->next, false);
+        gen_statements(g, root->right);
+        gen_statement(g, root->left->next->next);
+        emit(g, OP_JMP, 0, 0, 0, start);
+        patch(g, jump, g->program->code_count);
+        patch_breaks(g, first_break, g->program->code_count);
+        break;
+    case AST_BREAK:
+        push_break(g, emit(g, OP_JMP, 0, 0, 0, 0));
+        break;
+    case AST_EMPTY:
+        break;
+    case AST_RETURN:
+        if (root->left != NULL)
+            r = gen_expr_convert(g, root->left, symtab_get_symbol(root->value.num)->data_type);
+        else
+            r = gen_const(g, 0);
+        emit(g, OP_RET, r, 0, 0, 0);
+        break;
+    case AST_FUNC_CALL:
+        gen_expr_fcall(g, root);
+        break;
+    case AST_INDIRECT_CALL:
+        gen_indirect_call(g, root);
+        break;
+    case AST_ATOMIC:
+        gen_expr_atomic(g, root);
+        break;
+    default:
+        debug_print(SEV_ERROR, "[BC] Unexpected node: %s", NodeToString(*root));
+        exit(1);
+    }
+    g->top = g->params;
+}
+
+static void gen_statements(BcGen_t *g, ASTNode_t *root)
+{
+    for (; root; root = root->next)
+        gen_statement(g, root);
+}
+
+// Arrays of the function which aren't constant, the others are shared by
+// every call like in the generated assembly
+static void place_local_arrays(BcGen_t *g, ASTNode_t *root)
+{
+    for (; root != NULL; root = root->next)
+    {
+        if (root->type == AST_VAR_DECL)
+        {
+            Symbol_t *symbol = symtab_get_symbol(root->value.num);
+            Datatype_t *type = symbol->data_type;
+
+            if (
+                type->array_size > 0 &&
+                (!datatype_deref_pointer(type, 1)->is_const || (root->left != NULL && !is_const_initializer(root->left))))
+            {
+                size_t bytes = datatype_deref_pointer(type, 1)->size / 8;
+                size_t offset = (g->locals_size + bytes - 1) & ~(bytes - 1);
+
+                g->locals_offsets[root->value.num] = offset;
+                g->locals_size = offset + bytes * type->array_size;
+            }
+        }
+        place_local_arrays(g, root->left);
+        place_local_arrays(g, root->right);
+    }
+}
+
+static void gen_decl_func(BcGen_t *g, ASTNode_t *root)
+{
+    BytecodeFunc_t *func = &g->program->functions[root->value.num];
+
+    // The arguments are evaluated in the first registers of the callee
+    g->func = root->value.num;
+    g->params = ((SymbolFunc_t *)symtab_get_symbol(root->value.num))->args.size;
+    g->top = g->params;
+    g->max_reg = g->params > 1 ? g->params : 1;
+    func->entry = g->program->code_count;
+    func->defined = true;
+    g->locals_size = 0;
+    place_local_arrays(g, root->left);
+    if (g->locals_size > UINT32_MAX - 15)
+    {
+        debug_print(SEV_ERROR, "[BC] Local arrays of %s are too large", symtab_get_symbol(g->func)->sym_name);
+        exit(1);
+    }
+    func->locals_size = (g->locals_size + 15) & ~15;
+    gen_statements(g, root->left);
+
+    // Falling off the end returns 0
+    emit(g, OP_RET, gen_const(g, 0), 0, 0, 0);
+    func->reg_count = g->max_reg;
+    g->params = 0;
+}
+
+// Binds a function without a body to its native builtin or to the C
+// function an extern prototype declares
+static void bind_function(Bytecode_t *p, int index, int nargs)
+{
+    BytecodeFunc_t *func = &p->functions[index];
+    Symbol_t *symbol = symtab_get_symbol(index);
+
+    for (size_t j = 0; j < sizeof(builtins) / sizeof(builtins[0]); j++)
+    {
+        if (strcmp(builtins[j].name, symbol->sym_name) == 0)
+        {
+            func->is_builtin = true;
+            func->builtin = builtins[j].builtin;
+            return;
+        }
+    }
+
+    if (func->native == NULL)
+        func->native = dlsym(RTLD_DEFAULT, symbol->sym_name);
+    if (func->native == NULL)
+    {
+        debug_print(SEV_ERROR, "[BC] Function %s is not defined", symbol->sym_name);
+        exit(1);
+    }
+    if (nargs > BYTECODE_MAX_NATIVE_ARGS)
+    {
+        debug_print(
+            SEV_ERROR, "[BC] %s can't be called with more than %d arguments",
+            symbol->sym_name, BYTECODE_MAX_NATIVE_ARGS);
+        exit(1);
+    }
+    func->ret_size = symbol->data_type->size;
+    func->ret_float = datatype_is_float(symbol->data_type);
+    func->ret_unsigned = datatype_is_unsigned(symbol->data_type);
+    func->float_args = 0;
+    func->float32_args = 0;
+    for (size_t i = 0; i < ((SymbolFunc_t *)symbol)->args.size; i++)
+    {
+        Datatype_t *type = LList_SymbolFuncArg_get(&((SymbolFunc_t *)symbol)->args, i)->arg_type;
+        if (datatype_is_float(type))
+            func->float_args |= 1 << i;
+        if (datatype_is_float(type) && type->size == 32)
+            func->float32_args |= 1 << i;
+    }
+}
+
+// Binds every call to its function, to the native builtin or to a function
+// of the C library, and the functions used as pointers
+static void link_calls(BcGen_t *g)
+{
+    Bytecode_t *p = g->program;
+
+    for (size_t i = 0; i < p->code_count; i++)
+    {
+        Instr_t *ins = &p->code[i];
+        if (ins->op != OP_CALL || p->functions[ins->imm].defined)
+            continue;
+
+        bind_function(p, ins->imm, ins->b);
+        if (p->functions[ins->imm].is_builtin)
+        {
+            ins->op = OP_CALLN;
+            ins->imm = p->functions[ins->imm].builtin;
+        }
+        else
+            ins->op = OP_CALLX;
+    }
+
+    for (size_t i = 0; i < p->symbol_count; i++)
+    {
+        if (g->address_taken[i] && !p->functions[i].defined)
+            bind_function(p, i, ((SymbolFunc_t *)symtab_get_symbol(i))->args.size);
+    }
+}
+
+Bytecode_t *bytecode_compile(ASTNode_t *root)
+{
+    BcGen_t g = {0};
+    Bytecode_t *p = calloc(1, sizeof(Bytecode_t));
+
+    g.program = p;
+    p->symbol_count = symtab_global_symbol_count();
+    p->functions = calloc(p->symbol_count, sizeof(BytecodeFunc_t));
+    p->var_offsets = malloc(p->symbol_count * sizeof(long));
+    g.locals_offsets = malloc(p->symbol_count * sizeof(long));
+    g.address_taken = calloc(p->symbol_count, sizeof(bool));
+    for (size_t i = 0; i < p->symbol_count; i++)
+    {
+        p->var_offsets[i] = BYTECODE_NO_OFFSET;
+        g.locals_offsets[i] = BYTECODE_NO_OFFSET;
+    }
+
+    for (; root; root = root->next)
+    {
+        switch (root->type)
+        {
+        case AST_FUNC_DECL:
+            gen_decl_func(&g, root);
+            break;
+        case AST_VAR_DECL:
+            gen_decl_var(&g, root, true);
+            break;
+        case AST_FUNC_PROTO:
+            break;
+        default:
+            debug_print(SEV_ERROR, "[BC] Unexpected declaration type found");
+            exit(1);
+        }
+    }
+
+    p->main_func = symtab_find_global_symbol("main");
+    if (p->main_func < 0 || !p->functions[p->main_func].defined)
+    {
+        debug_print(SEV_ERROR, "[BC] The program has no main function");
+        exit(1);
+    }
+    link_calls(&g);
+    free(g.breaks);
+    free(g.address_taken);
+    free(g.locals_offsets);
+    return p;
+}
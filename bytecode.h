@@ -0,0 +1,196 @@
+#ifndef _BYTECODE_H_
+#define _BYTECODE_H_
+
+#include "ast.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define BYTECODE_MAX_REGS 256 /**< Registers of a function, operands are 8 bits. */
+#define BYTECODE_NO_OFFSET -1 /**< Variable without storage yet. */
+#define BYTECODE_MAX_NATIVE_ARGS 8
+
+/**
+ * @brief Instructions of the bytecode.
+ *
+ * Every value is a 64-bit register of the running function: `a`, `b` and
+ * `c` name registers and `imm` is a signed immediate, a byte offset in the
+ * data of the program or an instruction index. Values narrower than 64 bits
+ * are kept converted to 64 bits, `char`, `short` and the unsigned types zero
+ * extended and `int` sign extended, so the sized variants of an instruction
+ * only differ in how the result is converted. `unsigned int` results are
+ * converted by an extra OP_CASTU32. Floating point registers hold the bits of a
+ * double, float values are rounded to float but kept as doubles. A function
+ * pointer holds the symbol index of the function plus one, 0 is NULL.
+ */
+#define BYTECODE_SIZED(op) op##8, op##16, op##32, op##64
+typedef enum
+{
+    OP_LOADI,                  /**< a = imm */
+    OP_LOADK,                  /**< a = constants[imm] */
+    OP_ADDR,                   /**< a = data + imm */
+    BYTECODE_SIZED(OP_CAST),   /**< a = (size)a */
+    BYTECODE_SIZED(OP_LOAD),   /**< a = *(size *)(b + imm) */
+    BYTECODE_SIZED(OP_LOADG),  /**< a = *(size *)(data + imm) */
+    BYTECODE_SIZED(OP_STORE),  /**< *(size *)(a + imm) = b */
+    BYTECODE_SIZED(OP_STOREG), /**< *(size *)(data + imm) = b */
+    BYTECODE_SIZED(OP_ADD),    /**< a = (size)(b + c) */
+    BYTECODE_SIZED(OP_SUB),    /**< a = (size)(b - c) */
+    BYTECODE_SIZED(OP_MUL),    /**< a = (size)(b * c) */
+    BYTECODE_SIZED(OP_DIV),    /**< a = (size)(b / c) */
+    BYTECODE_SIZED(OP_MOD),    /**< a = (size)(b % c) */
+    BYTECODE_SIZED(OP_ADDI),   /**< a = (size)(b + imm) */
+    BYTECODE_SIZED(OP_SUBI),   /**< a = (size)(b - imm) */
+    BYTECODE_SIZED(OP_MULI),   /**< a = (size)(b * imm) */
+    BYTECODE_SIZED(OP_DIVI),   /**< a = (size)(b / imm), imm is neither 0 nor -1 */
+    BYTECODE_SIZED(OP_MODI),   /**< a = (size)(b % imm), imm is neither 0 nor -1 */
+    OP_INDEX,                  /**< a = data + imm + (b << c) */
+    OP_LADDR,                  /**< a = locals + imm, in the local arrays of the running call */
+    OP_LINDEX,                 /**< a = locals + imm + (b << c) */
+    OP_LZERO,                  /**< Zeroes a bytes at locals + imm. */
+    OP_GT,                     /**< a = b > c, in the order of the AST comparisons */
+    OP_GE,
+    OP_LT,
+    OP_LE,
+    OP_EQ,
+    OP_NE,
+    OP_LOADU32,  /**< a = *(unsigned int *)(b + imm) */
+    OP_LOADGU32, /**< a = *(unsigned int *)(data + imm) */
+    OP_CASTU32,  /**< a = (unsigned int)a */
+    OP_DIVU,     /**< a = b / c as unsigned longs */
+    OP_MODU,     /**< a = b % c as unsigned longs */
+    OP_SHRI,     /**< a = b >> imm, shifting in zeros */
+    OP_ANDI,     /**< a = b & imm */
+    OP_GTU,      /**< a = b > c as unsigned longs, in the order of the AST comparisons */
+    OP_GEU,
+    OP_LTU,
+    OP_LEU,
+    OP_FADD,   /**< a = b + c, as doubles */
+    OP_FSUB,   /**< a = b - c */
+    OP_FMUL,   /**< a = b * c */
+    OP_FDIV,   /**< a = b / c */
+    OP_FROUND, /**< a = (float)a, after the arithmetic on floats */
+    OP_FGT,    /**< a = b > c as doubles, in the order of the AST comparisons */
+    OP_FGE,
+    OP_FLT,
+    OP_FLE,
+    OP_FEQ,
+    OP_FNE,
+    OP_I2F,     /**< a = (double)a */
+    OP_F2I,     /**< a = (long)a, truncated */
+    OP_U2F,     /**< a = (double)(unsigned long)a */
+    OP_F2U,     /**< a = (unsigned long)a, truncated */
+    OP_FWIDEN,  /**< a = the float stored in the low 32 bits of a */
+    OP_FNARROW, /**< a = the bits of (float)a, to be stored in 32 bits */
+    OP_JMP,  /**< Jumps to imm. */
+    OP_JZ,   /**< Jumps to imm if a == 0. */
+    OP_JNZ,  /**< Jumps to imm if a != 0. */
+    OP_JGT,  /**< Jumps to imm if a > b. */
+    OP_JGE,
+    OP_JLT,
+    OP_JLE,
+    OP_JEQ,
+    OP_JNE,
+    OP_JGTU, /**< Jumps to imm if a > b as unsigned longs. */
+    OP_JGEU,
+    OP_JLTU,
+    OP_JLEU,
+    OP_CALL,   /**< Calls function imm with the b arguments starting at a, the result is left in a. */
+    OP_CALLN,  /**< Same as OP_CALL for the Builtin_e imm, implemented natively. */
+    OP_CALLX,  /**< Same as OP_CALL for the C function of the extern prototype imm. */
+    OP_CALLR,  /**< Same as OP_CALL for the function pointer in c. */
+    OP_ATOMIC, /**< AtomicOp_e b on the c-sized object at a, operands from a + 1, memory order imm. */
+    OP_RET,    /**< Returns a. */
+    OP_COUNT
+} Opcode_e;
+
+/**
+ * @brief Builtin functions implemented by the interpreter.
+ */
+typedef enum
+{
+    BUILTIN_PRINT,
+    BUILTIN_PRINT_CHAR,
+    BUILTIN_PRINT_STR,
+    BUILTIN_PRINT_LN,
+    BUILTIN_PRINT_DOUBLE,
+    BUILTIN_ARENA_NEW,
+    BUILTIN_ARENA_ALLOC,
+    BUILTIN_ARENA_RESET
+} Builtin_e;
+
+typedef struct
+{
+    __uint8_t op; /**< Opcode_e of the instruction. */
+    __uint8_t a;
+    __uint8_t b;
+    __uint8_t c;
+    __int32_t imm;
+} Instr_t;
+
+typedef struct
+{
+    __uint32_t entry;       /**< Index of the first instruction. */
+    __uint32_t reg_count;   /**< Registers used by the function. */
+    __uint32_t locals_size; /**< Bytes of the local arrays of a call. */
+    bool defined;
+    bool is_builtin;    /**< A builtin called through a pointer, `builtin` is its Builtin_e. */
+    __uint8_t builtin;
+    void *native;       /**< C function called for an extern prototype. */
+    __uint8_t ret_size; /**< Size of the value returned by `native`, 0 for void. */
+    bool ret_float;     /**< `native` returns a float or a double. */
+    bool ret_unsigned;  /**< `native` returns an unsigned integer. */
+    __uint8_t float_args;   /**< Bit i is set when argument i of `native` is a float or a double. */
+    __uint8_t float32_args; /**< Bit i is set when it is a float. */
+} BytecodeFunc_t;
+
+/**
+ * @brief Address stored in the data at load time.
+ */
+typedef struct
+{
+    size_t offset; /**< Offset of the 64-bit slot holding the address. */
+    size_t target; /**< Offset the address points to. */
+} BytecodeReloc_t;
+
+/**
+ * @brief A program lowered to bytecode.
+ *
+ * Every variable, local ones included, lives in the data of the program like
+ * in the generated assembly, string literals are placed after them. Local
+ * arrays are the exception, like in the stack frame of the generated assembly
+ * every call has its own, in the locals the interpreter gives it.
+ */
+typedef struct
+{
+    Instr_t *code;
+    size_t code_count;
+    size_t code_capacity;
+    long *constants; /**< Integers that don't fit an immediate. */
+    size_t constant_count;
+    BytecodeFunc_t *functions; /**< Indexed by symbol index. */
+    long *var_offsets;         /**< Data offset of every variable, indexed by symbol index. */
+    size_t symbol_count;
+    __uint8_t *data;
+    size_t data_size;
+    size_t data_capacity;
+    BytecodeReloc_t *relocs;
+    size_t reloc_count;
+    int main_func; /**< Symbol index of main. */
+} Bytecode_t;
+
+/**
+ * @brief Lowers a whole program to bytecode.
+ *
+ * Temporaries are allocated to registers of the function like the code
+ * generator allocates machine registers, comparisons feeding a branch are
+ * fused with it, and calls to the builtins are bound to their native
+ * implementation. Extern prototypes are bound to the function of the same
+ * name loaded in the compiler, the C library in particular.
+ *
+ * @param root Pointer to the first top-level declaration.
+ * @return The program, ready to be run by vm_run().
+ */
+Bytecode_t *bytecode_compile(ASTNode_t *root);
+
+#endif // _BYTECODE_H_
@@ -0,0 +1,447 @@
+/**
+ * @file cache.c
+ * @brief Cache of the code generated for every function.
+ *
+ * The code of every function is stored next to the output along with its
+ * fingerprint, so the next compilation of the file only generates the code
+ * of the functions that changed.
+ *
+ * @project ToyCComp
+ */
+
+#include "cache.h"
+#include "debug.h"
+#include "symtab.h"
+#include "writer.h"
+#include "llist_definitions.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CACHE_NULL_STR 0xFFFFFFFFu
+
+typedef struct
+{
+    char *pos;
+    char *end;
+    bool ok;
+} CacheReader_t;
+
+static __uint64_t hash_node(__uint64_t hash, ASTNode_t *node, int func);
+
+static __uint32_t name_hash(const char *name)
+{
+    // FNV-1a
+    __uint32_t hash = 2166136261u;
+    for (; *name; name++)
+    {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static __uint64_t hash_bytes(__uint64_t hash, const void *data, size_t len)
+{
+    // FNV-1a
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= ((unsigned char *)data)[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static __uint64_t hash_int(__uint64_t hash, long value)
+{
+    // Mixes a whole word at once, most of the hashed data is numbers
+    hash = (hash ^ (__uint64_t)value) * 0x9E3779B97F4A7C15ull;
+    return hash ^ (hash >> 29);
+}
+
+static __uint64_t hash_str(__uint64_t hash, char *str)
+{
+    return hash_bytes(hash, str, strlen(str) + 1);
+}
+
+static __uint64_t hash_datatype(__uint64_t hash, Datatype_t *type)
+{
+    for (; type != NULL; type = type->base_type)
+    {
+        hash = hash_int(hash, type->size);
+        hash = hash_int(hash, type->pointer_level);
+        hash = hash_int(hash, type->array_size);
+        hash = hash_int(hash, type->is_const);
+        hash = hash_int(hash, type->is_float);
+        hash = hash_int(hash, type->is_unsigned);
+        if (type->return_type == NULL)
+            continue;
+        hash = hash_datatype(hash, type->return_type);
+        for (size_t i = 0; i < type->param_count; i++)
+            hash = hash_datatype(hash, type->param_types[i]);
+    }
+    return hash_int(hash, -1);
+}
+
+// Calls through function pointers are compiled for the target guessed in
+// the function
+static __uint64_t hash_call_target(__uint64_t hash, CallTargets_t *targets, int func)
+{
+    int target = symtab_call_target(targets, ((SymbolFunc_t *)symtab_get_symbol(func))->definition);
+
+    if (target < 0)
+        return hash_int(hash, -1);
+    return hash_str(hash, symtab_get_symbol(target)->sym_name);
+}
+
+static __uint64_t hash_symbol(__uint64_t hash, int index, int func)
+{
+    Symbol_t *symbol = symtab_get_symbol(index);
+
+    hash = hash_str(hash, symbol->sym_name);
+    hash = hash_int(hash, symbol->sym_type);
+    hash = hash_datatype(hash, symbol->data_type);
+
+    if (symbol->sym_type == SYMBOL_FUNC)
+    {
+        LList_t *args = &((SymbolFunc_t *)symbol)->args;
+        for (size_t i = 0; i < args->size; i++)
+        {
+            hash = hash_datatype(hash, LList_SymbolFuncArg_get(args, i)->arg_type);
+            hash = hash_call_target(hash, &LList_SymbolFuncArg_get(args, i)->targets, func);
+        }
+        return hash;
+    }
+
+    hash = hash_call_target(hash, &symbol->targets, func);
+    if (symbol->data_type->is_const && symbol->init_value != NULL)
+    {
+        // const values are folded into the code using them
+        hash = hash_node(hash, symbol->init_value, func);
+    }
+    return hash;
+}
+
+static __uint64_t hash_node(__uint64_t hash, ASTNode_t *node, int func)
+{
+    for (; node != NULL; node = node->next)
+    {
+        hash = hash_int(hash, node->type);
+        hash = hash_datatype(hash, node->expr_type);
+        switch (node->type)
+        {
+        case AST_STR_LIT:
+        case AST_FLOAT_LIT:
+            hash = hash_str(hash, node->value.str);
+            break;
+        case AST_INT_LIT:
+            hash = hash_int(hash, node->value.lit);
+            break;
+        case AST_VAR:
+        case AST_VAR_DECL:
+        case AST_FUNC_CALL:
+        case AST_FUNC_ADDR:
+        case AST_FUNC_DECL:
+        case AST_RETURN:
+            hash = hash_symbol(hash, node->value.num, func);
+            break;
+        case AST_WHILE:
+        case AST_DO_WHILE:
+        case AST_FOR:
+            // Holds a label once the code is generated
+            break;
+        default:
+            hash = hash_int(hash, node->value.num);
+            break;
+        }
+        hash = hash_node(hash, node->left, func);
+        hash = hash_node(hash, node->right, func);
+    }
+    return hash_int(hash, -1);
+}
+
+__uint64_t cache_hash_function(ASTNode_t *decl)
+{
+    __uint64_t hash = 14695981039346656037ull;
+
+    hash = hash_symbol(hash, decl->value.num, decl->value.num);
+    return hash_node(hash, decl->left, decl->value.num);
+}
+
+static void write_u32(FILE *file, __uint32_t value)
+{
+    fwrite(&value, sizeof(value), 1, file);
+}
+
+static void write_u64(FILE *file, __uint64_t value)
+{
+    fwrite(&value, sizeof(value), 1, file);
+}
+
+static void write_str(FILE *file, char *str)
+{
+    if (str == NULL)
+    {
+        write_u32(file, CACHE_NULL_STR);
+        return;
+    }
+    // Strings keep their terminator so they can be used in place once loaded
+    write_u32(file, strlen(str));
+    fwrite(str, 1, strlen(str) + 1, file);
+}
+
+static void *read_bytes(CacheReader_t *reader, size_t len)
+{
+    void *data = reader->pos;
+
+    if (!reader->ok || (size_t)(reader->end - reader->pos) < len)
+    {
+        reader->ok = false;
+        return NULL;
+    }
+    reader->pos += len;
+    return data;
+}
+
+static __uint32_t read_u32(CacheReader_t *reader)
+{
+    __uint32_t value = 0;
+    void *data = read_bytes(reader, sizeof(value));
+    if (data != NULL)
+        memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static __uint64_t read_u64(CacheReader_t *reader)
+{
+    __uint64_t value = 0;
+    void *data = read_bytes(reader, sizeof(value));
+    if (data != NULL)
+        memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static char *read_str(CacheReader_t *reader)
+{
+    __uint32_t len = read_u32(reader);
+    char *str;
+
+    if (len == CACHE_NULL_STR)
+        return NULL;
+    str = read_bytes(reader, (size_t)len + 1);
+    if (str != NULL && str[len] != '\0')
+        reader->ok = false;
+    return reader->ok ? str : NULL;
+}
+
+// Counts are checked against the remaining data before allocating anything
+static void *read_array(CacheReader_t *reader, size_t count, size_t element_size)
+{
+    if (!reader->ok || count > (size_t)(reader->end - reader->pos))
+    {
+        reader->ok = false;
+        return NULL;
+    }
+    return calloc(count ? count : 1, element_size);
+}
+
+static ASMRecord *read_record(CacheReader_t *reader)
+{
+    ASMRecord *record = calloc(1, sizeof(ASMRecord));
+
+    record->first_label = read_u32(reader);
+    record->label_count = read_u32(reader);
+
+    record->str_count = read_u32(reader);
+    record->strs = read_array(reader, record->str_count, sizeof(ASMRecordStr));
+    for (size_t i = 0; reader->ok && i < record->str_count; i++)
+    {
+        record->strs[i].id = read_u32(reader);
+        record->strs[i].str = read_str(reader);
+    }
+
+    record->symbol_count = read_u32(reader);
+    record->symbols = read_array(reader, record->symbol_count, sizeof(ASMRecordSymbol));
+    for (size_t i = 0; reader->ok && i < record->symbol_count; i++)
+    {
+        ASMRecordSymbol *symbol = &record->symbols[i];
+        symbol->name = read_str(reader);
+        symbol->size = (RegSize_e)read_u32(reader);
+        symbol->number_of_items = read_u64(reader);
+        symbol->read_only = read_u32(reader);
+        symbol->value_count = read_u32(reader);
+        symbol->values = read_array(reader, symbol->value_count, sizeof(ASMSymbolValue));
+        for (size_t j = 0; reader->ok && j < symbol->value_count; j++)
+        {
+            symbol->values[j].type = (ASMSymbolType)read_u32(reader);
+            symbol->values[j].num = (long)read_u64(reader);
+            symbol->values[j].label = read_str(reader);
+            if (symbol->values[j].type == ASM_SYMBOL_ADDR && symbol->values[j].label == NULL)
+                reader->ok = false;
+        }
+        if (symbol->name == NULL)
+            reader->ok = false;
+    }
+
+    record->call_count = read_u32(reader);
+    record->calls = read_array(reader, record->call_count, sizeof(char *));
+    for (size_t i = 0; reader->ok && i < record->call_count; i++)
+    {
+        record->calls[i] = read_str(reader);
+        if (record->calls[i] == NULL)
+            reader->ok = false;
+    }
+
+    record->code_len = read_u64(reader);
+    record->code = read_bytes(reader, record->code_len);
+    return record;
+}
+
+static void write_record(FILE *file, ASMRecord *record)
+{
+    write_u32(file, record->first_label);
+    write_u32(file, record->label_count);
+
+    write_u32(file, record->str_count);
+    for (size_t i = 0; i < record->str_count; i++)
+    {
+        write_u32(file, record->strs[i].id);
+        write_str(file, record->strs[i].str);
+    }
+
+    write_u32(file, record->symbol_count);
+    for (size_t i = 0; i < record->symbol_count; i++)
+    {
+        ASMRecordSymbol *symbol = &record->symbols[i];
+        write_str(file, symbol->name);
+        write_u32(file, symbol->size);
+        write_u64(file, symbol->number_of_items);
+        write_u32(file, symbol->read_only);
+        write_u32(file, symbol->value_count);
+        for (size_t j = 0; j < symbol->value_count; j++)
+        {
+            write_u32(file, symbol->values[j].type);
+            write_u64(file, (__uint64_t)symbol->values[j].num);
+            write_str(file, symbol->values[j].type == ASM_SYMBOL_ADDR ? symbol->values[j].label : NULL);
+        }
+    }
+
+    write_u32(file, record->call_count);
+    for (size_t i = 0; i < record->call_count; i++)
+        write_str(file, record->calls[i]);
+
+    write_u64(file, record->code_len);
+    fwrite(record->code, 1, record->code_len, file);
+}
+
+static bool read_cache(Cache_t *cache, CacheReader_t *reader)
+{
+    char *magic = read_bytes(reader, strlen(CACHE_MAGIC));
+
+    if (magic == NULL || memcmp(magic, CACHE_MAGIC, strlen(CACHE_MAGIC)) != 0)
+        return false;
+    if (
+        read_u32(reader) != CACHE_VERSION ||
+        read_u32(reader) != cache->syntax ||
+        read_u64(reader) != cache->array_alignment)
+        return false;
+
+    __uint32_t count = read_u32(reader);
+    for (__uint32_t i = 0; reader->ok && i < count; i++)
+    {
+        CacheEntry_t *entry = malloc(sizeof(CacheEntry_t));
+        entry->name = read_str(reader);
+        entry->hash = read_u64(reader);
+        entry->record = read_record(reader);
+        if (!reader->ok || entry->name == NULL)
+            return false;
+        entry->record->name = entry->name;
+
+        CacheEntry_t **bucket = &cache->old[name_hash(entry->name) % CACHE_BUCKETS];
+        entry->bucket_next = *bucket;
+        *bucket = entry;
+    }
+    return reader->ok && reader->pos == reader->end;
+}
+
+Cache_t *cache_load(char *path, AsmSyntax_e syntax, size_t array_alignment)
+{
+    Cache_t *cache = calloc(1, sizeof(Cache_t));
+    CacheReader_t reader;
+    FILE *file;
+    long size;
+
+    cache->path = path;
+    cache->syntax = syntax;
+    cache->array_alignment = array_alignment;
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+        return cache;
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    cache->data = malloc(size > 0 ? size : 1);
+    if (size < 0 || fread(cache->data, 1, size, file) != (size_t)size)
+        size = 0;
+    fclose(file);
+
+    reader.pos = cache->data;
+    reader.end = cache->data + size;
+    reader.ok = true;
+    if (!read_cache(cache, &reader))
+    {
+        // Everything is generated again, the cache is rewritten at the end
+        debug_print(SEV_DEBUG, "[CACHE] Ignoring %s", path);
+        memset(cache->old, 0, sizeof(cache->old));
+    }
+    return cache;
+}
+
+ASMRecord *cache_find(Cache_t *cache, char *name, __uint64_t hash)
+{
+    for (CacheEntry_t *entry = cache->old[name_hash(name) % CACHE_BUCKETS]; entry != NULL; entry = entry->bucket_next)
+    {
+        if (entry->hash == hash && strcmp(entry->name, name) == 0)
+            return entry->record;
+    }
+    return NULL;
+}
+
+void cache_add(Cache_t *cache, char *name, __uint64_t hash, ASMRecord *record)
+{
+    CacheEntry_t *entry = calloc(1, sizeof(CacheEntry_t));
+
+    entry->name = name;
+    entry->hash = hash;
+    entry->record = record;
+    if (cache->last_entry != NULL)
+        cache->last_entry->next = entry;
+    else
+        cache->entries = entry;
+    cache->last_entry = entry;
+}
+
+void cache_save(Cache_t *cache)
+{
+    FILE *file = writer_open(cache->path);
+    __uint32_t count = 0;
+
+    if (file == NULL)
+        exit(1);
+    for (CacheEntry_t *entry = cache->entries; entry != NULL; entry = entry->next)
+        count++;
+
+    fwrite(CACHE_MAGIC, 1, strlen(CACHE_MAGIC), file);
+    write_u32(file, CACHE_VERSION);
+    write_u32(file, cache->syntax);
+    write_u64(file, cache->array_alignment);
+    write_u32(file, count);
+    for (CacheEntry_t *entry = cache->entries; entry != NULL; entry = entry->next)
+    {
+        write_str(file, entry->name);
+        write_u64(file, entry->hash);
+        write_record(file, entry->record);
+    }
+    fclose(file);
+}
@@ -0,0 +1,93 @@
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+#include "asm.h"
+#include "ast.h"
+#include "codegen.h"
+
+#define CACHE_MAGIC "TCCC"
+#define CACHE_VERSION 6
+#define CACHE_BUCKETS 4096
+
+typedef struct CacheEntry CacheEntry_t;
+struct CacheEntry
+{
+    char *name;
+    __uint64_t hash;
+    ASMRecord *record;
+    CacheEntry_t *bucket_next;
+    CacheEntry_t *next;
+};
+
+/**
+ * @brief Code of the functions of a previous compilation.
+ *
+ * Functions whose fingerprint didn't change since the previous compilation
+ * reuse the code stored in the cache instead of being generated again.
+ */
+typedef struct Cache Cache_t;
+struct Cache
+{
+    char *path;                       /**< Path of the cache file. */
+    AsmSyntax_e syntax;               /**< Syntax of the cached code. */
+    size_t array_alignment;           /**< Alignment of the large arrays, local ones are aligned by the code. */
+    char *data;                       /**< Content of the cache file that was loaded. */
+    CacheEntry_t *old[CACHE_BUCKETS]; /**< Functions of the previous compilation. */
+    CacheEntry_t *entries;            /**< Functions of this compilation, in order. */
+    CacheEntry_t *last_entry;
+};
+
+/**
+ * @brief Loads the cache file at `path`.
+ *
+ * A missing cache, a cache written by another version of the compiler, for
+ * another syntax or another array alignment is treated as empty.
+ *
+ * @param path Path of the cache file.
+ * @param syntax Syntax of the code generated by this compilation.
+ * @param array_alignment Array alignment of this compilation.
+ * @return Pointer to the cache.
+ */
+Cache_t *cache_load(char *path, AsmSyntax_e syntax, size_t array_alignment);
+
+/**
+ * @brief Computes the fingerprint of a function declaration.
+ *
+ * Covers the structure of the body and the names and types of every symbol
+ * it refers to, including the signature of the functions it calls and the
+ * value of the const variables it uses. Symbols are hashed by name, so
+ * adding a declaration before the function doesn't change its fingerprint.
+ *
+ * @param decl Pointer to the AST_FUNC_DECL node.
+ * @return The fingerprint.
+ */
+__uint64_t cache_hash_function(ASTNode_t *decl);
+
+/**
+ * @brief Finds the code a function had in the previous compilation.
+ *
+ * @param cache Pointer to the cache.
+ * @param name Name of the function.
+ * @param hash Fingerprint of the function.
+ * @return The recorded code, or NULL if the function changed or is new.
+ */
+ASMRecord *cache_find(Cache_t *cache, char *name, __uint64_t hash);
+
+/**
+ * @brief Adds the code of a function of this compilation to the cache.
+ *
+ * @param cache Pointer to the cache.
+ * @param name Name of the function.
+ * @param hash Fingerprint of the function.
+ * @param record Code generated (or reused) for the function.
+ */
+void cache_add(Cache_t *cache, char *name, __uint64_t hash, ASMRecord *record);
+
+/**
+ * @brief Replaces the cache file with the functions of this compilation.
+ *
+ * @param cache Pointer to the cache.
+ */
+void cache_save(Cache_t *cache);
+
+#endif // _CACHE_H_
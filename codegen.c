@@ -16,18 +16,27 @@
 
 #include "asm.h"
 #include "ast.h"
+#include "cache.h"
 #include "codegen.h"
+#include "consteval.h"
 #include "debug.h"
+#include "decl.h"
 #include "symtab.h"
+#include "writer.h"
+#include "llist_definitions.h"
 
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 //////////////////////////////
 // All functions protptypes //
 //////////////////////////////
 
 static ASTNode_t *get_loop_context(ASTNode_t *root);
+static RegSize_e get_expr_size(ASTNode_t *root);
 
 static void generate_statements(CodeGenerator_t *gen, ASTNode_t *root);
 static void generate_statement(CodeGenerator_t *gen, ASTNode_t *root);
@@ -41,21 +50,36 @@ static void generate_stmt_return(CodeGenerator_t *gen, ASTNode_t *root);
 static void generate_stmt_fcall(CodeGenerator_t *gen, ASTNode_t *root);
 
 static Register generate_expr(CodeGenerator_t *gen, ASTNode_t *root);
+static Register generate_expr_widen(CodeGenerator_t *gen, ASTNode_t *root, RegSize_e size);
+static Register generate_expr_convert(CodeGenerator_t *gen, ASTNode_t *root, Datatype_t *type);
+static Register generate_expr_float(CodeGenerator_t *gen, ASTNode_t *root);
 static Register generate_expr_comparison(CodeGenerator_t *gen, ASTNode_t *root);
 static Register generate_expr_arithmetic(CodeGenerator_t *gen, ASTNode_t *root);
 static Register generate_expr_fcall(CodeGenerator_t *gen, ASTNode_t *root);
+static Register generate_indirect_call(CodeGenerator_t *gen, ASTNode_t *root, bool need_return);
+static char *guess_call_target(ASTNode_t *callee);
+static Register generate_expr_atomic(CodeGenerator_t *gen, ASTNode_t *root, bool need_result);
 static Register generate_expr_addressof(CodeGenerator_t *gen, ASTNode_t *root);
 static Register generate_expr_ptrdref(CodeGenerator_t *gen, ASTNode_t *root);
 static Register generate_expr_arr_index(CodeGenerator_t *gen, ASTNode_t *root);
+static size_t generate_func_args(CodeGenerator_t *gen, ASTNode_t *root);
+static bool is_inline_arena_alloc(ASTNode_t *root, long *align);
 
 static void generate_declerations(CodeGenerator_t *gen, ASTNode_t *root);
 static void generate_decleration(CodeGenerator_t *gen, ASTNode_t *root);
 static void generate_decl_func(CodeGenerator_t *gen, ASTNode_t *root);
-static void generate_decl_var(CodeGenerator_t *gen, ASTNode_t *root);
+static void generate_func_body(CodeGenerator_t *gen, ASTNode_t *root);
+static void generate_decl_var(CodeGenerator_t *gen, ASTNode_t *root, bool is_global);
+static bool generate_const_value(ASTNode_t *root, Datatype_t *type, ASMSymbolValue *out);
+static void generate_init_list(CodeGenerator_t *gen, Symbol_t *symbol, ASTNode_t *root, Datatype_t *type, bool is_global);
+static bool is_const_initializer(ASTNode_t *root);
+static bool is_stack_array(ASTNode_t *decl);
+static void place_local_arrays(CodeGenerator_t *gen, ASTNode_t *root);
 //////////////////////////////
 //////////////////////////////
 
 static bool return_called_flag = false;
+static int current_func = -1; /**< Symbol index of the function being generated. */
 
 static ASTNode_t *get_loop_context(ASTNode_t *node)
 {
@@ -72,12 +96,59 @@ static ASTNode_t *get_loop_context(ASTNode_t *node)
     return NULL;
 }
 
+static RegSize_e get_expr_size(ASTNode_t *root)
+{
+    // Offsets are scaled after being widened, as they are always added to
+    // a pointer
+    if (root->type == AST_OFFSET_SCALE)
+        return SIZE_64bit;
+    return (RegSize_e)root->expr_type->size;
+}
+
+static Register generate_expr_widen(CodeGenerator_t *gen, ASTNode_t *root, RegSize_e size)
+{
+    Register r = generate_expr(gen, root);
+
+    // Positive literals are loaded with a 32-bit mov which is already
+    // zero extended to 64 bits, like the unsigned values
+    if (root->type == AST_INT_LIT && root->value.lit >= 0)
+        return r;
+    if (root->type != AST_OFFSET_SCALE && datatype_is_unsigned(root->expr_type))
+        return r;
+    return asm_sign_extend(gen, r, get_expr_size(root), size);
+}
+
+// Converts the value of an expression to another type like an assignment
+// does, floating point values are held in xmm registers
+static Register generate_expr_convert(CodeGenerator_t *gen, ASTNode_t *root, Datatype_t *type)
+{
+    RegSize_e from = get_expr_size(root);
+    RegSize_e to = (RegSize_e)type->size;
+    bool from_float = root->type != AST_OFFSET_SCALE && datatype_is_float(root->expr_type);
+
+    if (datatype_is_float(type) && from_float)
+        return asm_float_convert(gen, generate_expr(gen, root), from, to);
+    if (datatype_is_float(type) && datatype_is_unsigned(root->expr_type))
+        return asm_uint_to_float(gen, generate_expr(gen, root), from, to);
+    if (datatype_is_float(type))
+        return asm_int_to_float(gen, generate_expr_widen(gen, root, from), from, to);
+    if (from_float && datatype_is_unsigned(type))
+        return asm_float_to_uint(gen, generate_expr(gen, root), from, to);
+    if (from_float)
+        return asm_float_to_int(gen, generate_expr(gen, root), from, to);
+    return generate_expr_widen(gen, root, to);
+}
+
 static Register generate_expr(CodeGenerator_t *gen, ASTNode_t *root)
 {
     switch (root->type)
     {
     case AST_FUNC_CALL:
         return generate_expr_fcall(gen, root);
+    case AST_INDIRECT_CALL:
+        return generate_indirect_call(gen, root, true);
+    case AST_ATOMIC:
+        return generate_expr_atomic(gen, root, true);
     case AST_ADDRESSOF:
         return generate_expr_addressof(gen, root);
     default:
@@ -88,6 +159,8 @@ static Register generate_expr(CodeGenerator_t *gen, ASTNode_t *root)
 static Register generate_expr_comparison(CodeGenerator_t *gen, ASTNode_t *root)
 {
     Register left, right;
+    RegSize_e size;
+    Datatype_t *type;
 
     if (
         root->type != AST_COMP_EQ &&
@@ -100,23 +173,64 @@ static Register generate_expr_comparison(CodeGenerator_t *gen, ASTNode_t *root)
         return generate_expr_arithmetic(gen, root);
     }
 
-    left = generate_expr(gen, root->left);
-    right = generate_expr(gen, root->right);
+    // The comparison result is a char, the operands are compared using the
+    // wider type of both
+    type = datatype_expr_type(root->left->expr_type, root->right->expr_type);
+    size = (RegSize_e)type->size;
+    if (datatype_is_float(type))
+    {
+        left = generate_expr_convert(gen, root->left, type);
+        right = generate_expr_convert(gen, root->right, type);
+        switch (root->type)
+        {
+        case AST_COMP_EQ:
+            return asm_float_comp_eq(gen, left, right, size);
+        case AST_COMP_NE:
+            return asm_float_comp_ne(gen, left, right, size);
+        case AST_COMP_GT:
+            return asm_float_comp_gt(gen, left, right, size);
+        case AST_COMP_GE:
+            return asm_float_comp_ge(gen, left, right, size);
+        case AST_COMP_LT:
+            return asm_float_comp_lt(gen, left, right, size);
+        default:
+            return asm_float_comp_le(gen, left, right, size);
+        }
+    }
+    left = generate_expr_widen(gen, root->left, size);
+    right = generate_expr_widen(gen, root->right, size);
+
+    if (datatype_is_unsigned(type))
+    {
+        switch (root->type)
+        {
+        case AST_COMP_GT:
+            return asm_comp_ugt(gen, left, right, size);
+        case AST_COMP_GE:
+            return asm_comp_uge(gen, left, right, size);
+        case AST_COMP_LT:
+            return asm_comp_ult(gen, left, right, size);
+        case AST_COMP_LE:
+            return asm_comp_ule(gen, left, right, size);
+        default:
+            break;
+        }
+    }
 
     switch (root->type)
     {
     case AST_COMP_EQ:
-        return asm_comp_eq(gen, left, right);
+        return asm_comp_eq(gen, left, right, size);
     case AST_COMP_NE:
-        return asm_comp_ne(gen, left, right);
+        return asm_comp_ne(gen, left, right, size);
     case AST_COMP_GT:
-        return asm_comp_gt(gen, left, right);
+        return asm_comp_gt(gen, left, right, size);
     case AST_COMP_GE:
-        return asm_comp_ge(gen, left, right);
+        return asm_comp_ge(gen, left, right, size);
     case AST_COMP_LT:
-        return asm_comp_lt(gen, left, right);
+        return asm_comp_lt(gen, left, right, size);
     case AST_COMP_LE:
-        return asm_comp_le(gen, left, right);
+        return asm_comp_le(gen, left, right, size);
 
     default:
         debug_print(
@@ -130,37 +244,89 @@ static Register generate_expr_comparison(CodeGenerator_t *gen, ASTNode_t *root)
 static Register generate_expr_arithmetic(CodeGenerator_t *gen, ASTNode_t *root)
 {
     Register left, right;
+    RegSize_e size = get_expr_size(root);
+    ConstValue_t value;
+
+    if (root->type != AST_OFFSET_SCALE && datatype_is_float(root->expr_type))
+        return generate_expr_float(gen, root);
+
+    // Fold arithmetic on constants, e.g. on const variables
+    if (
+        (root->type == AST_ADD ||
+         root->type == AST_SUBTRACT ||
+         root->type == AST_MULT ||
+         root->type == AST_DIV ||
+         root->type == AST_MOD) &&
+        consteval_expr(root, &value) &&
+        value.type == CONST_INT)
+        return asm_init_register(gen, value.num);
+
+    // Unsigned division and modulo by a power of two are a shift and a mask
+    if (
+        (root->type == AST_DIV || root->type == AST_MOD) &&
+        datatype_is_unsigned(root->expr_type) &&
+        consteval_expr(root->right, &value) &&
+        value.type == CONST_INT &&
+        value.num > 0 &&
+        (value.num & (value.num - 1)) == 0)
+    {
+        left = generate_expr_widen(gen, root->left, size);
+        if (root->type == AST_DIV)
+            asm_srl(gen, left, __builtin_ctzl(value.num), size);
+        else
+            asm_and(gen, left, value.num - 1, size);
+        return left;
+    }
 
     if (
         root->left &&
         root->type != AST_FUNC_CALL &&
         root->type != AST_PTRDREF &&
         root->type != AST_ARRAY_INDEX)
-        left = generate_expr(gen, root->left);
+        left = generate_expr_widen(gen, root->left, size);
 
     if (root->right && root->type != AST_ARRAY_INDEX)
-        right = generate_expr(gen, root->right);
+        right = generate_expr_widen(gen, root->right, size);
 
     switch (root->type)
     {
     case AST_ADD:
-        return asm_add(gen, left, right);
+        return asm_add(gen, left, right, size);
     case AST_SUBTRACT:
-        return asm_sub(gen, left, right);
+        return asm_sub(gen, left, right, size);
     case AST_MULT:
-        return asm_mul(gen, left, right);
+        return asm_mul(gen, left, right, size);
     case AST_DIV:
-        return asm_div(gen, left, right);
+        if (datatype_is_unsigned(root->expr_type))
+            return asm_udiv(gen, left, right, size);
+        return asm_div(gen, left, right, size);
+    case AST_MOD:
+        if (datatype_is_unsigned(root->expr_type))
+            return asm_umod(gen, left, right, size);
+        return asm_mod(gen, left, right, size);
     case AST_INT_LIT:
-        return asm_init_register(gen, root->value.num);
+        // Unsigned literals are zero extended
+        consteval_expr(root, &value);
+        return asm_init_register(gen, value.num);
     case AST_STR_LIT:
-        return asm_address_of(gen, asm_generate_string_lit(gen, root->value.str));
+        return asm_address_of(gen, asm_generate_string_lit(root->value.str));
 
     case AST_VAR:
+        // Arrays evaluate to the address of their first element
+        if (root->expr_type->array_size > 0)
+            return asm_address_of(gen, symtab_get_symbol(root->value.num)->sym_name);
+        // const scalars are used as immediates instead of being loaded
+        if (consteval_expr(root, &value) && value.type == CONST_INT)
+            return asm_init_register(gen, value.num);
         return asm_get_global_var(gen, symtab_get_symbol(root->value.num)->sym_name);
+    case AST_PARAM:
+        return asm_get_param(gen, root->value.num, size);
+    case AST_FUNC_ADDR:
+        asm_reference_function(symtab_get_symbol(root->value.num)->sym_name);
+        return asm_address_of(gen, symtab_get_symbol(root->value.num)->sym_name);
     case AST_OFFSET_SCALE:
         Register offset = asm_init_register(gen, root->value.num);
-        return asm_mul(gen, left, offset);
+        return asm_mul(gen, left, offset, size);
     case AST_PTRDREF:
         if (root->expr_type->pointer_level > 0)
             return generate_expr_ptrdref(gen, root);
@@ -184,19 +350,158 @@ static Register generate_expr_arithmetic(CodeGenerator_t *gen, ASTNode_t *root)
     }
 }
 
+static Register generate_expr_float(CodeGenerator_t *gen, ASTNode_t *root)
+{
+    RegSize_e size = get_expr_size(root);
+    ConstValue_t value;
+    Register left, right;
+
+    // Literals and constant expressions are folded, the bits are loaded
+    if (consteval_expr(root, &value) && consteval_convert(&value, root->expr_type))
+        return asm_init_float(gen, consteval_float_bits(value.fnum, size));
+
+    switch (root->type)
+    {
+    case AST_ADD:
+    case AST_SUBTRACT:
+    case AST_MULT:
+    case AST_DIV:
+        left = generate_expr_convert(gen, root->left, root->expr_type);
+        right = generate_expr_convert(gen, root->right, root->expr_type);
+        if (root->type == AST_ADD)
+            return asm_float_add(gen, left, right, size);
+        if (root->type == AST_SUBTRACT)
+            return asm_float_sub(gen, left, right, size);
+        if (root->type == AST_MULT)
+            return asm_float_mul(gen, left, right, size);
+        return asm_float_div(gen, left, right, size);
+    case AST_VAR:
+        return asm_get_float_var(gen, symtab_get_symbol(root->value.num)->sym_name);
+    case AST_PARAM:
+        return asm_get_float_param(gen, root->value.num, size);
+    case AST_PTRDREF:
+        return asm_load_float(gen, generate_expr_ptrdref(gen, root), size);
+    case AST_ARRAY_INDEX:
+        return asm_load_float(gen, generate_expr_arr_index(gen, root), size);
+
+    default:
+        debug_print(
+            SEV_ERROR,
+            "[CG] Unexpected type: %s in generate_expr_float\n",
+            NodeToString(*root));
+        exit(1);
+    }
+}
+
+// The bump of arena_alloc is inlined when the alignment is a constant power
+// of two
+static bool is_inline_arena_alloc(ASTNode_t *root, long *align)
+{
+    ConstValue_t value;
+
+    if (strcmp(symtab_get_symbol(root->value.num)->sym_name, "arena_alloc") != 0)
+        return false;
+    if (!consteval_expr(root->left->next->next, &value) || value.type != CONST_INT)
+        return false;
+    *align = value.num;
+    return value.num > 0 && value.num <= INT32_MAX && (value.num & (value.num - 1)) == 0;
+}
+
 static Register generate_expr_fcall(CodeGenerator_t *gen, ASTNode_t *root)
 {
-    Register expr = asm_NoReg;
-    if (root->left)
-        expr = generate_expr(gen, root->left);
+    long align;
+
+    if (is_inline_arena_alloc(root, &align))
+    {
+        Register arena = generate_expr(gen, root->left);
+        Register size = generate_expr_convert(gen, root->left->next, DATATYPE_LONG);
+        return asm_arena_alloc(gen, arena, size, align);
+    }
+
+    generate_func_args(gen, root);
 
     return asm_generate_func_call(
         gen,
         symtab_get_symbol(root->value.num)->sym_name,
-        expr,
+        asm_NoReg,
+        get_expr_size(root),
+        datatype_is_float(root->expr_type),
         true);
 }
 
+// The function stored by most of the stores to the pointer is guessed to be
+// the target, see symtab_call_target()
+static char *guess_call_target(ASTNode_t *callee)
+{
+    CallTargets_t *targets;
+    int target;
+
+    if (callee->type == AST_VAR)
+        targets = &symtab_get_symbol(callee->value.num)->targets;
+    else if (callee->type == AST_ARRAY_INDEX && callee->left->type == AST_VAR)
+        targets = &symtab_get_symbol(callee->left->value.num)->targets;
+    else if (callee->type == AST_PARAM)
+        targets = &LList_SymbolFuncArg_get(&((SymbolFunc_t *)symtab_get_symbol(current_func))->args, callee->value.num)->targets;
+    else
+        return NULL;
+
+    target = symtab_call_target(targets, ((SymbolFunc_t *)symtab_get_symbol(current_func))->definition);
+    return target < 0 ? NULL : symtab_get_symbol(target)->sym_name;
+}
+
+// The pointer is evaluated before the arguments and kept in a callee saved
+// register across their evaluation
+static Register generate_indirect_call(CodeGenerator_t *gen, ASTNode_t *root, bool need_return)
+{
+    Register callee = generate_expr(gen, root->right);
+    generate_func_args(gen, root);
+
+    return asm_generate_func_call(
+        gen,
+        guess_call_target(root->right),
+        callee,
+        get_expr_size(root),
+        datatype_is_float(root->expr_type),
+        need_return);
+}
+
+static Register generate_expr_atomic(CodeGenerator_t *gen, ASTNode_t *root, bool need_result)
+{
+    MemoryOrder_e order = ASTAtomicOrder(root->value.num);
+    ASTNode_t *ptr = root->left;
+    Datatype_t *type;
+    RegSize_e size;
+    Register addr, val;
+
+    if (ASTAtomicOp(root->value.num) == ATOMIC_FENCE)
+    {
+        asm_atomic_fence(gen, order);
+        return asm_NoReg;
+    }
+
+    type = datatype_deref_pointer(ptr->expr_type, 1);
+    size = (RegSize_e)type->size;
+    addr = generate_expr(gen, ptr);
+    switch (ASTAtomicOp(root->value.num))
+    {
+    case ATOMIC_LOAD:
+        return asm_atomic_load(gen, addr, size, need_result);
+    case ATOMIC_STORE:
+        asm_atomic_store(gen, addr, generate_expr_convert(gen, ptr->next, type), size, order);
+        return asm_NoReg;
+    case ATOMIC_EXCHANGE:
+        return asm_atomic_exchange(gen, addr, generate_expr_convert(gen, ptr->next, type), size, need_result);
+    case ATOMIC_COMPARE_EXCHANGE:
+        val = generate_expr(gen, ptr->next);
+        return asm_atomic_compare_exchange(
+            gen, addr, val, generate_expr_convert(gen, ptr->next->next, type), size, need_result);
+    case ATOMIC_FETCH_ADD:
+        return asm_atomic_fetch_add(gen, addr, generate_expr_convert(gen, ptr->next, type), size, need_result);
+    default:
+        return asm_atomic_fetch_or(gen, addr, generate_expr_convert(gen, ptr->next, type), size, need_result);
+    }
+}
+
 static Register generate_expr_addressof(CodeGenerator_t *gen, ASTNode_t *root)
 {
     return asm_address_of(gen, symtab_get_symbol(root->left->value.num)->sym_name);
@@ -215,10 +520,36 @@ static Register generate_expr_arr_index(CodeGenerator_t *gen, ASTNode_t *root)
 {
     Register index, base_address;
 
-    index = generate_expr(gen, root->right);
+    index = generate_expr_widen(gen, root->right, SIZE_64bit);
+    // Elements of arrays in the frame are addressed from rbp in one lea
+    if (root->left->type == AST_VAR && asm_is_local_array(symtab_get_symbol(root->left->value.num)->sym_name))
+        return asm_local_array_index(gen, symtab_get_symbol(root->left->value.num)->sym_name, index, root->value.num / 8);
     asm_sll(gen, index, (int)log2(root->value.num / 8));
-    base_address = asm_address_of(gen, symtab_get_symbol(root->left->value.num)->sym_name);
-    return asm_add(gen, base_address, index);
+    // Arrays decay to their address, pointers are indexed through their value
+    base_address = generate_expr(gen, root->left);
+    return asm_add(gen, base_address, index, SIZE_64bit);
+}
+
+// Every argument is converted to the type of its parameter, taken from the
+// pointer's type for an indirect call
+static size_t generate_func_args(CodeGenerator_t *gen, ASTNode_t *root)
+{
+    size_t arg_count = args_count(root->left);
+    size_t i = 0;
+
+    asm_reserve_call_args(gen, arg_count);
+    for (ASTNode_t *arg = root->left; arg != NULL; arg = arg->next, i++)
+    {
+        Datatype_t *param_type = root->type == AST_INDIRECT_CALL
+                                     ? root->right->expr_type->base_type->param_types[i]
+                                     : LList_SymbolFuncArg_get(&((SymbolFunc_t *)symtab_get_symbol(root->value.num))->args, i)->arg_type;
+        Register r = generate_expr_convert(gen, arg, param_type);
+        if (datatype_is_float(param_type))
+            asm_set_call_float_arg(gen, i, arg_count, r);
+        else
+            asm_set_call_arg(gen, i, arg_count, r);
+    }
+    return arg_count;
 }
 
 static void generate_statements(CodeGenerator_t *gen, ASTNode_t *root)
@@ -235,7 +566,7 @@ static void generate_statement(CodeGenerator_t *gen, ASTNode_t *root)
     switch (root->type)
     {
     case AST_VAR_DECL:
-        generate_decl_var(gen, root);
+        generate_decl_var(gen, root, false);
         break;
     case AST_ASSIGN:
         generate_stmt_assign(gen, root);
@@ -263,44 +594,218 @@ static void generate_statement(CodeGenerator_t *gen, ASTNode_t *root)
     case AST_FUNC_CALL:
         generate_stmt_fcall(gen, root);
         break;
+    case AST_INDIRECT_CALL:
+        generate_indirect_call(gen, root, false);
+        break;
+    case AST_ATOMIC:
+        generate_expr_atomic(gen, root, false);
+        break;
     default:
         debug_print(SEV_ERROR, "[CG] Unexpected node: %s", NodeToString(*root));
         exit(0);
     }
 }
 
-static void generate_decl_var(CodeGenerator_t *gen, ASTNode_t *root)
+// The value is converted to the type of the initialized variable, floating
+// point values are stored as their bits
+static bool generate_const_value(ASTNode_t *root, Datatype_t *type, ASMSymbolValue *out)
+{
+    ConstValue_t value;
+    int symbol_index;
+
+    if (!consteval_expr(root, &value) || !consteval_convert(&value, type))
+        return false;
+
+    out->num = value.num;
+    switch (value.type)
+    {
+    case CONST_INT:
+        out->type = ASM_SYMBOL_INT;
+        out->label = NULL;
+        break;
+    case CONST_FLOAT:
+        out->type = ASM_SYMBOL_INT;
+        out->num = consteval_float_bits(value.fnum, type->size);
+        out->label = NULL;
+        break;
+    case CONST_ADDR:
+        out->type = ASM_SYMBOL_ADDR;
+        out->label = value.base;
+        // Functions whose address is stored are declared like called ones
+        symbol_index = symtab_find_global_symbol(value.base);
+        if (symbol_index >= 0 && symtab_get_symbol(symbol_index)->sym_type == SYMBOL_FUNC)
+            asm_reference_function(value.base);
+        break;
+    case CONST_STR:
+        out->type = ASM_SYMBOL_ADDR;
+        out->label = asm_generate_string_lit(value.base);
+        break;
+    }
+    return true;
+}
+
+static void generate_init_list(CodeGenerator_t *gen, Symbol_t *symbol, ASTNode_t *root, Datatype_t *type, bool is_global)
+{
+    RegSize_e size = (RegSize_e)type->size;
+    ASTNode_t *elem;
+    size_t count = 0;
+
+    if (is_global)
+    {
+        for (elem = root->left; elem; elem = elem->next)
+            count++;
+
+        ASMSymbolValue *values = malloc(count * sizeof(ASMSymbolValue));
+        count = 0;
+        for (elem = root->left; elem; elem = elem->next)
+        {
+            if (!generate_const_value(elem, type, &values[count++]))
+            {
+                debug_print(
+                    SEV_ERROR,
+                    "[CG] Initializer of global %s is not a constant expression",
+                    symbol->sym_name);
+                exit(1);
+            }
+        }
+        asm_set_global_var_initial_val(symbol->sym_name, values, count);
+        free(values);
+        return;
+    }
+
+    for (elem = root->left; elem; elem = elem->next)
+    {
+        Register value = generate_expr_convert(gen, elem, type);
+        Register addr = asm_address_of(gen, symbol->sym_name);
+        if (count)
+            addr = asm_add(gen, addr, asm_init_register(gen, count * (size / 8)), SIZE_64bit);
+        if (datatype_is_float(type))
+            asm_store_float(gen, addr, value, size);
+        else
+            asm_store_mem(gen, addr, value, size);
+        count++;
+    }
+}
+
+static bool is_const_initializer(ASTNode_t *root)
+{
+    ConstValue_t value;
+
+    if (root->type != AST_INIT_LIST)
+        return consteval_expr(root, &value);
+
+    for (ASTNode_t *elem = root->left; elem; elem = elem->next)
+    {
+        if (!consteval_expr(elem, &value))
+            return false;
+    }
+    return true;
+}
+
+// Arrays declared in a function live in its stack frame, except the const
+// ones with a constant value which stay in .rodata
+static bool is_stack_array(ASTNode_t *decl)
+{
+    Symbol_t *symbol = symtab_get_symbol(decl->value.num);
+
+    if (symbol->data_type->array_size == 0)
+        return false;
+    return !datatype_deref_pointer(symbol->data_type, 1)->is_const ||
+           (decl->left != NULL && !is_const_initializer(decl->left));
+}
+
+// The frame is sized by the prologue, so every array of the function is
+// placed before its code is generated
+static void place_local_arrays(CodeGenerator_t *gen, ASTNode_t *root)
+{
+    for (; root != NULL; root = root->next)
+    {
+        if (root->type == AST_VAR_DECL && is_stack_array(root))
+        {
+            Symbol_t *symbol = symtab_get_symbol(root->value.num);
+            asm_add_local_array(
+                gen,
+                symbol->sym_name,
+                (RegSize_e)datatype_deref_pointer(symbol->data_type, 1)->size,
+                symbol->data_type->array_size);
+        }
+        place_local_arrays(gen, root->left);
+        place_local_arrays(gen, root->right);
+    }
+}
+
+static void generate_decl_var(CodeGenerator_t *gen, ASTNode_t *root, bool is_global)
 {
-    // TODO check if the variable has initial value
     Symbol_t *symbol = symtab_get_symbol(root->value.num);
+    Datatype_t *type = symbol->data_type;
+    RegSize_e size = (RegSize_e)root->expr_type->size;
+    bool is_const = symbol->data_type->is_const;
+
+    // Arrays are allocated using the size of their elements
+    if (symbol->data_type->array_size > 0)
+    {
+        type = datatype_deref_pointer(symbol->data_type, 1);
+        size = (RegSize_e)type->size;
+        is_const = type->is_const;
+    }
+
+    // Like in C a shorter initializer leaves the other elements zeroed, an
+    // array without one keeps whatever the frame held
+    if (!is_global && asm_is_local_array(symbol->sym_name))
+    {
+        if (root->left == NULL)
+            return;
+        if ((__uint32_t)args_count(root->left->left) < symbol->data_type->array_size)
+            asm_zero_local_array(gen, symbol->sym_name, (size / 8) * symbol->data_type->array_size);
+        generate_init_list(gen, symbol, root->left, type, false);
+        return;
+    }
+
     asm_add_global_var(
         gen,
         symbol->sym_name,
-        (RegSize_e)root->expr_type->size,
+        size,
         symbol->data_type->array_size);
-    if (root->left)
+
+    // const variables with a constant value never change, so they are
+    // placed in .rodata and initialized at load time like globals
+    if (is_const && (root->left == NULL || is_const_initializer(root->left)))
     {
-        if (root->left->type == AST_INT_LIT)
-        {
-            asm_set_global_var_initial_val(
-                gen,
-                symtab_get_symbol(root->value.num)->sym_name,
-                (ASMSymbolValue)root->left->value.num,
-                ASM_SYMBOL_INT);
-        }
-        else if (root->left->type == AST_STR_LIT)
+        asm_set_global_var_readonly(symbol->sym_name);
+        is_global = true;
+    }
+
+    if (root->left == NULL)
+        return;
+
+    if (root->left->type == AST_INIT_LIST)
+    {
+        generate_init_list(gen, symbol, root->left, type, is_global);
+        return;
+    }
+
+    // Globals are initialized at load time, so their initial value has to
+    // be known at compile time
+    if (is_global)
+    {
+        ASMSymbolValue value;
+        if (!generate_const_value(root->left, type, &value))
         {
-            asm_set_global_var_initial_val(
-                gen,
-                symtab_get_symbol(root->value.num)->sym_name,
-                (ASMSymbolValue)root->left->value.str,
-                ASM_SYMBOL_STR);
+            debug_print(
+                SEV_ERROR,
+                "[CG] Initializer of global %s is not a constant expression",
+                symbol->sym_name);
+            exit(1);
         }
+        asm_set_global_var_initial_val(symbol->sym_name, &value, 1);
+    }
+    else
+    {
+        Register value = generate_expr_convert(gen, root->left, type);
+        if (datatype_is_float(type))
+            asm_set_float_var(gen, symbol->sym_name, value);
         else
-        {
-            Register value = generate_expr(gen, root->left);
-            asm_set_global_var(gen, symtab_get_symbol(root->value.num)->sym_name, value);
-        }
+            asm_set_global_var(gen, symbol->sym_name, value);
     }
 }
 
@@ -404,23 +909,41 @@ static void generate_stmt_break(CodeGenerator_t *gen, ASTNode_t *root)
 static void generate_stmt_assign(CodeGenerator_t *gen, ASTNode_t *root)
 {
     Symbol_t *symbol;
-    Register i = generate_expr(gen, root->right);
+    Datatype_t *type = root->left->expr_type;
+    bool is_float = datatype_is_float(type);
+    Register i = generate_expr_convert(gen, root->right, type);
 
     switch (root->left->type)
     {
     case AST_VAR:
         symbol = symtab_get_symbol(root->left->value.num);
-        asm_set_global_var(gen, symbol->sym_name, i);
+        if (is_float)
+            asm_set_float_var(gen, symbol->sym_name, i);
+        else
+            asm_set_global_var(gen, symbol->sym_name, i);
+        break;
+
+    case AST_PARAM:
+        if (is_float)
+            asm_set_float_param(gen, root->left->value.num, i, type->size);
+        else
+            asm_set_param(gen, root->left->value.num, i);
         break;
 
     case AST_PTRDREF:
         Register expr1 = generate_expr_ptrdref(gen, root->left);
-        asm_store_mem(gen, expr1, i, root->left->expr_type->size);
+        if (is_float)
+            asm_store_float(gen, expr1, i, type->size);
+        else
+            asm_store_mem(gen, expr1, i, type->size);
         break;
 
     case AST_ARRAY_INDEX:
         Register expr2 = generate_expr_arr_index(gen, root->left);
-        asm_store_mem(gen, expr2, i, root->left->expr_type->size);
+        if (is_float)
+            asm_store_float(gen, expr2, i, type->size);
+        else
+            asm_store_mem(gen, expr2, i, type->size);
         break;
 
     default:
@@ -432,21 +955,25 @@ static void generate_stmt_assign(CodeGenerator_t *gen, ASTNode_t *root)
 
 static void generate_stmt_return(CodeGenerator_t *gen, ASTNode_t *root)
 {
-    Register i = generate_expr(gen, root->left);
-    asm_generate_func_return(gen, i, symtab_get_symbol(root->value.num)->data_type->size);
+    Datatype_t *type = symtab_get_symbol(root->value.num)->data_type;
+    Register i = generate_expr_convert(gen, root->left, type);
+    if (datatype_is_float(type))
+        asm_generate_func_return_float(gen, i);
+    else
+        asm_generate_func_return(gen, i, (RegSize_e)type->size);
     return_called_flag = true;
 }
 
 static void generate_stmt_fcall(CodeGenerator_t *gen, ASTNode_t *root)
 {
-    Register expr = asm_NoReg;
-    if (root->left)
-        expr = generate_expr(gen, root->left);
+    generate_func_args(gen, root);
 
     asm_generate_func_call(
         gen,
         symtab_get_symbol(root->value.num)->sym_name,
-        expr,
+        asm_NoReg,
+        get_expr_size(root),
+        datatype_is_float(root->expr_type),
         false);
 }
 
@@ -467,7 +994,10 @@ static void generate_decleration(CodeGenerator_t *gen, ASTNode_t *root)
         generate_decl_func(gen, root);
         break;
     case AST_VAR_DECL:
-        generate_decl_var(gen, root);
+        generate_decl_var(gen, root, true);
+        break;
+    case AST_FUNC_PROTO:
+        // Calls to it are resolved by the linker
         break;
     default:
         debug_print(SEV_ERROR, "[CG] Unexpected declaration type found");
@@ -477,8 +1007,46 @@ static void generate_decleration(CodeGenerator_t *gen, ASTNode_t *root)
 
 static void generate_decl_func(CodeGenerator_t *gen, ASTNode_t *root)
 {
+    char *name = symtab_get_symbol(root->value.num)->sym_name;
+    ASMRecord *record;
+    __uint64_t hash;
+
+    if (gen->cache == NULL)
+    {
+        generate_func_body(gen, root);
+        return;
+    }
+
+    hash = cache_hash_function(root);
+    record = cache_find(gen->cache, name, hash);
+    if (record != NULL)
+    {
+        debug_print(SEV_DEBUG, "[CG] Reusing the code of %s", name);
+        asm_replay(gen, record);
+    }
+    else
+    {
+        record = malloc(sizeof(ASMRecord));
+        asm_record_begin(gen, record, name);
+        generate_func_body(gen, root);
+        asm_record_end(gen, record);
+    }
+    cache_add(gen->cache, name, hash, record);
+}
+
+static void generate_func_body(CodeGenerator_t *gen, ASTNode_t *root)
+{
+    SymbolFunc_t *func = (SymbolFunc_t *)symtab_get_symbol(root->value.num);
+    bool *float_params = malloc((func->args.size + 1) * sizeof(bool));
+
+    for (size_t i = 0; i < func->args.size; i++)
+        float_params[i] = datatype_is_float(LList_SymbolFuncArg_get(&func->args, i)->arg_type);
+
     return_called_flag = false;
-    asm_generate_function_prologue(gen, symtab_get_symbol(root->value.num)->sym_name);
+    current_func = root->value.num;
+    place_local_arrays(gen, root->left);
+    asm_generate_function_prologue(gen, func->sym_name, func->args.size, float_params);
+    free(float_params);
     generate_statements(gen, root->left);
     if (!return_called_flag)
     {
@@ -488,16 +1056,52 @@ static void generate_decl_func(CodeGenerator_t *gen, ASTNode_t *root)
     asm_generate_function_epilogue(gen);
 }
 
-CodeGenerator_t *codegen_init(char *path)
+static CodeGenerator_t *codegen_create(FILE *file, AsmSyntax_e syntax)
 {
     CodeGenerator_t *gen = (CodeGenerator_t *)malloc(sizeof(CodeGenerator_t));
-    gen->file = fopen(path, "w");
-    // gen->file = stdout;
+    if (file == NULL)
+        exit(1);
+    gen->file = file;
+    gen->array_alignment = CODEGEN_DEFAULT_ARRAY_ALIGNMENT;
+    gen->syntax = syntax;
+    gen->cache = NULL;
+    asm_start(gen);
     return gen;
 }
 
+CodeGenerator_t *codegen_init(char *path, AsmSyntax_e syntax)
+{
+    if (strcmp(path, CODEGEN_STDOUT) == 0)
+        return codegen_init_fd(STDOUT_FILENO, "stdout", syntax);
+    return codegen_create(writer_open(path), syntax);
+}
+
+CodeGenerator_t *codegen_init_fd(int fd, const char *name, AsmSyntax_e syntax)
+{
+    return codegen_create(writer_open_fd(fd, name), syntax);
+}
+
+void codegen_enable_cache(CodeGenerator_t *gen, char *path)
+{
+    gen->cache = cache_load(path, gen->syntax, gen->array_alignment);
+}
+
 void codegen_start(CodeGenerator_t *gen, ASTNode_t *root)
 {
     generate_declerations(gen, root);
+    codegen_finish(gen);
+}
+
+void codegen_declaration(CodeGenerator_t *gen, ASTNode_t *decl)
+{
+    generate_declerations(gen, decl);
+}
+
+void codegen_finish(CodeGenerator_t *gen)
+{
     asm_wrapup(gen);
+    fclose(gen->file);
+    gen->file = NULL;
+    if (gen->cache != NULL)
+        cache_save(gen->cache);
 }
\ No newline at end of file
@@ -5,6 +5,21 @@
 
 #include <stdio.h>
 
+#define CODEGEN_DEFAULT_ARRAY_ALIGNMENT 16
+#define CODEGEN_STDOUT "-" /**< Output path standing for the standard output. */
+
+/**
+ * @brief Assembler syntax of the generated code.
+ *
+ * Both syntaxes are produced by the same instruction lowering, only the
+ * directives and the operand spelling differ.
+ */
+typedef enum
+{
+    ASM_SYNTAX_NASM, /**< NASM syntax. */
+    ASM_SYNTAX_GAS   /**< GNU as syntax, `.intel_syntax noprefix`. */
+} AsmSyntax_e;
+
 /**
  * @brief Code generator context.
  *
@@ -13,20 +28,53 @@
  */
 typedef struct
 {
-    FILE *file; /**< Pointer to the output file for generated assembly code. */
+    FILE *file;             /**< Pointer to the output file for generated assembly code. */
+    size_t array_alignment; /**< Alignment of arrays that are at least this many bytes. */
+    AsmSyntax_e syntax;     /**< Assembler syntax of the output. */
+    struct Cache *cache;    /**< Code of the previous compilation, NULL unless compiling incrementally. */
 } CodeGenerator_t;
 
 /**
  * @brief Initializes the code generator.
  *
  * Allocates and initializes a `CodeGenerator_t` object for generating assembly code.
- * Opens the specified file for writing the output.
+ * Opens the specified file for writing the output, the file is written by a
+ * background thread and only appears once the generation is finished.
  *
  * @param path Pointer to the string representing the file path where the generated
- *        assembly code will be written.
+ *        assembly code will be written, or CODEGEN_STDOUT.
+ * @param syntax Assembler syntax of the generated code.
  * @return Pointer to the initialized `CodeGenerator_t` object.
  */
-CodeGenerator_t *codegen_init(char *path);
+CodeGenerator_t *codegen_init(char *path, AsmSyntax_e syntax);
+
+/**
+ * @brief Initializes the code generator writing to an open descriptor.
+ *
+ * Same as codegen_init() for a pipe, e.g. to an assembler reading its
+ * standard input. The descriptor is closed by codegen_finish().
+ *
+ * @param fd Descriptor the generated assembly code is written to.
+ * @param name Name of the output used in error messages.
+ * @param syntax Assembler syntax of the generated code.
+ * @return Pointer to the initialized `CodeGenerator_t` object.
+ */
+CodeGenerator_t *codegen_init_fd(int fd, const char *name, AsmSyntax_e syntax);
+
+/**
+ * @brief Reuses the code of the functions that didn't change since the
+ * previous compilation.
+ *
+ * The code of every function is stored in the cache file at `path` when the
+ * output is finished, along with a fingerprint of the function. Functions
+ * whose fingerprint is found in the cache are copied from it instead of
+ * being generated, with their labels numbered again. The array alignment
+ * must be set before, a cache written with another one isn't used.
+ *
+ * @param gen Pointer to the code generator context.
+ * @param path Path of the cache file.
+ */
+void codegen_enable_cache(CodeGenerator_t *gen, char *path);
 
 /**
  * @brief Starts the code generation process.
@@ -40,4 +88,26 @@ CodeGenerator_t *codegen_init(char *path);
  */
 void codegen_start(CodeGenerator_t *gen, ASTNode_t *root);
 
+/**
+ * @brief Generates the assembly code of a single top-level declaration.
+ *
+ * Lets declarations be generated as soon as they are parsed instead of
+ * waiting for the whole program. A declaration of several variables
+ * (`int a, b;`) is passed as the head of its list.
+ *
+ * @param gen Pointer to the code generator context.
+ * @param decl Pointer to the declaration node.
+ */
+void codegen_declaration(CodeGenerator_t *gen, ASTNode_t *decl);
+
+/**
+ * @brief Finalizes the output after the last declaration.
+ *
+ * Emits the data sections and the external symbols used by the program,
+ * then closes the output file.
+ *
+ * @param gen Pointer to the code generator context.
+ */
+void codegen_finish(CodeGenerator_t *gen);
+
 #endif // _CODEGEN_H_
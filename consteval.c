@@ -0,0 +1,436 @@
+/**
+ * @file consteval.c
+ * @brief Compile time evaluation of constant expressions.
+ *
+ * This file contains the evaluator used to fold expressions whose value is
+ * known at compile time, such as the initial values of global variables.
+ *
+ * @project ToyCComp
+ */
+
+#include "consteval.h"
+#include "debug.h"
+#include "symtab.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+static long wrap_to_type(Datatype_t *type, long value)
+{
+    // int and narrower types are computed in 32-bit registers
+    if (type != NULL && type->pointer_level == 0 && type->size <= 32)
+        return datatype_is_unsigned(type) ? (long)(unsigned int)value : (long)(int)value;
+    return value;
+}
+
+static void set_int(ConstValue_t *out, long value, bool is_unsigned)
+{
+    out->type = CONST_INT;
+    out->num = value;
+    out->is_unsigned = is_unsigned;
+    out->base = NULL;
+}
+
+static double round_to_type(Datatype_t *type, double value)
+{
+    if (type != NULL && type->size == 32)
+        return (float)value;
+    return value;
+}
+
+// Both operands are converted to the floating point type of the expression
+static bool eval_float_arithmetic(ASTNode_t *root, Datatype_t *type, ConstValue_t *left, ConstValue_t *right, ConstValue_t *out)
+{
+    if (!consteval_convert(left, type) || !consteval_convert(right, type))
+        return false;
+
+    out->type = CONST_FLOAT;
+    out->base = NULL;
+    switch (root->type)
+    {
+    case AST_ADD:
+        out->fnum = left->fnum + right->fnum;
+        break;
+    case AST_SUBTRACT:
+        out->fnum = left->fnum - right->fnum;
+        break;
+    case AST_MULT:
+        out->fnum = left->fnum * right->fnum;
+        break;
+    case AST_DIV:
+        out->fnum = left->fnum / right->fnum;
+        break;
+    default:
+        return false;
+    }
+    out->fnum = round_to_type(type, out->fnum);
+    return true;
+}
+
+static void check_divisor(ConstValue_t *right)
+{
+    if (right->num == 0)
+    {
+        debug_print(SEV_ERROR, "[CONSTEVAL] Division by zero in a constant expression");
+        exit(1);
+    }
+}
+
+// The operands are converted to the unsigned type of the expression first,
+// then the arithmetic is done on unsigned longs
+static bool eval_unsigned_arithmetic(ASTNode_t *root, ConstValue_t *left, ConstValue_t *right, ConstValue_t *out)
+{
+    unsigned long a, b;
+
+    consteval_convert(left, root->expr_type);
+    consteval_convert(right, root->expr_type);
+    a = (unsigned long)left->num;
+    b = (unsigned long)right->num;
+    switch (root->type)
+    {
+    case AST_ADD:
+        a += b;
+        break;
+    case AST_SUBTRACT:
+        a -= b;
+        break;
+    case AST_MULT:
+        a *= b;
+        break;
+    case AST_DIV:
+        check_divisor(right);
+        a /= b;
+        break;
+    case AST_MOD:
+        check_divisor(right);
+        a %= b;
+        break;
+    default:
+        return false;
+    }
+    set_int(out, wrap_to_type(root->expr_type, (long)a), true);
+    return true;
+}
+
+static bool eval_arithmetic(ASTNode_t *root, ConstValue_t *left, ConstValue_t *right, ConstValue_t *out)
+{
+    if (root->expr_type != NULL && datatype_is_float(root->expr_type))
+        return eval_float_arithmetic(root, root->expr_type, left, right, out);
+
+    if (left->type == CONST_INT && right->type == CONST_INT && root->expr_type != NULL && datatype_is_unsigned(root->expr_type))
+        return eval_unsigned_arithmetic(root, left, right, out);
+
+    if (left->type == CONST_INT && right->type == CONST_INT)
+    {
+        set_int(out, 0, false);
+        switch (root->type)
+        {
+        case AST_ADD:
+            out->num = (long)((unsigned long)left->num + (unsigned long)right->num);
+            break;
+        case AST_SUBTRACT:
+            out->num = (long)((unsigned long)left->num - (unsigned long)right->num);
+            break;
+        case AST_MULT:
+            out->num = (long)((unsigned long)left->num * (unsigned long)right->num);
+            break;
+        case AST_DIV:
+            check_divisor(right);
+            if (left->num == LONG_MIN && right->num == -1)
+                out->num = LONG_MIN;
+            else
+                out->num = left->num / right->num;
+            break;
+        case AST_MOD:
+            check_divisor(right);
+            out->num = right->num == -1 ? 0 : left->num % right->num;
+            break;
+        default:
+            return false;
+        }
+        out->num = wrap_to_type(root->expr_type, out->num);
+        return true;
+    }
+
+    // Pointer arithmetic, the integer side is already scaled by AST_OFFSET_SCALE
+    if (root->type == AST_ADD && left->type != CONST_INT && right->type == CONST_INT)
+    {
+        *out = *left;
+        out->num += right->num;
+        return true;
+    }
+    if (root->type == AST_ADD && left->type == CONST_INT && right->type != CONST_INT)
+    {
+        *out = *right;
+        out->num += left->num;
+        return true;
+    }
+    if (root->type == AST_SUBTRACT && left->type != CONST_INT && right->type == CONST_INT)
+    {
+        *out = *left;
+        out->num -= right->num;
+        return true;
+    }
+    return false;
+}
+
+static bool eval_unsigned_comparison(ASTNode_t *root, unsigned long left, unsigned long right, ConstValue_t *out)
+{
+    set_int(out, 0, false);
+    switch (root->type)
+    {
+    case AST_COMP_EQ:
+        out->num = left == right;
+        break;
+    case AST_COMP_NE:
+        out->num = left != right;
+        break;
+    case AST_COMP_GT:
+        out->num = left > right;
+        break;
+    case AST_COMP_GE:
+        out->num = left >= right;
+        break;
+    case AST_COMP_LT:
+        out->num = left < right;
+        break;
+    case AST_COMP_LE:
+        out->num = left <= right;
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+static bool eval_comparison(ASTNode_t *root, ConstValue_t *left, ConstValue_t *right, ConstValue_t *out)
+{
+    Datatype_t *type = datatype_expr_type(root->left->expr_type, root->right->expr_type);
+
+    // Floating point operands are compared as doubles, NaN is unordered
+    if (datatype_is_float(type))
+    {
+        if (!consteval_convert(left, DATATYPE_DOUBLE) || !consteval_convert(right, DATATYPE_DOUBLE))
+            return false;
+        set_int(out, 0, false);
+        switch (root->type)
+        {
+        case AST_COMP_EQ:
+            out->num = left->fnum == right->fnum;
+            break;
+        case AST_COMP_NE:
+            out->num = left->fnum != right->fnum;
+            break;
+        case AST_COMP_GT:
+            out->num = left->fnum > right->fnum;
+            break;
+        case AST_COMP_GE:
+            out->num = left->fnum >= right->fnum;
+            break;
+        case AST_COMP_LT:
+            out->num = left->fnum < right->fnum;
+            break;
+        case AST_COMP_LE:
+            out->num = left->fnum <= right->fnum;
+            break;
+        default:
+            return false;
+        }
+        return true;
+    }
+
+    if (left->type != CONST_INT || right->type != CONST_INT)
+        return false;
+
+    // Both operands are converted to the common type, unsigned ones are
+    // compared as unsigned longs
+    if (datatype_is_unsigned(type))
+    {
+        consteval_convert(left, type);
+        consteval_convert(right, type);
+        return eval_unsigned_comparison(root, (unsigned long)left->num, (unsigned long)right->num, out);
+    }
+
+    set_int(out, 0, false);
+    switch (root->type)
+    {
+    case AST_COMP_EQ:
+        out->num = left->num == right->num;
+        break;
+    case AST_COMP_NE:
+        out->num = left->num != right->num;
+        break;
+    case AST_COMP_GT:
+        out->num = left->num > right->num;
+        break;
+    case AST_COMP_GE:
+        out->num = left->num >= right->num;
+        break;
+    case AST_COMP_LT:
+        out->num = left->num < right->num;
+        break;
+    case AST_COMP_LE:
+        out->num = left->num <= right->num;
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+static bool consteval_node(ASTNode_t *root, ConstValue_t *out)
+{
+    ConstValue_t left, right;
+    Symbol_t *symbol;
+
+    switch (root->type)
+    {
+    case AST_INT_LIT:
+        set_int(out, root->value.lit, false);
+        return consteval_convert(out, root->expr_type);
+
+    case AST_FLOAT_LIT:
+        out->type = CONST_FLOAT;
+        out->fnum = strtod(root->value.str, NULL);
+        out->num = 0;
+        out->base = NULL;
+        return true;
+
+    case AST_STR_LIT:
+        out->type = CONST_STR;
+        out->num = 0;
+        out->base = root->value.str;
+        return true;
+
+    case AST_VAR:
+        // Arrays are the address of their first element
+        symbol = symtab_get_symbol(root->value.num);
+        if (symbol->data_type->array_size > 0)
+        {
+            out->type = CONST_ADDR;
+            out->num = 0;
+            out->base = symbol->sym_name;
+            return true;
+        }
+
+        // Only const scalars have a value known at compile time
+        if (
+            !symbol->data_type->is_const ||
+            symbol->init_value == NULL ||
+            symbol->init_value->type == AST_INIT_LIST)
+            return false;
+        if (!consteval_expr(symbol->init_value, out))
+            return false;
+        return consteval_convert(out, symbol->data_type);
+
+    case AST_ADDRESSOF:
+        if (root->left->type != AST_VAR)
+            return false;
+        out->type = CONST_ADDR;
+        out->num = 0;
+        out->base = symtab_get_symbol(root->left->value.num)->sym_name;
+        return true;
+
+    case AST_FUNC_ADDR:
+        out->type = CONST_ADDR;
+        out->num = 0;
+        out->base = symtab_get_symbol(root->value.num)->sym_name;
+        return true;
+
+    case AST_OFFSET_SCALE:
+        if (!consteval_expr(root->left, &left) || left.type != CONST_INT)
+            return false;
+        set_int(out, left.num * root->value.num, false);
+        return true;
+
+    case AST_ADD:
+    case AST_SUBTRACT:
+    case AST_MULT:
+    case AST_DIV:
+    case AST_MOD:
+        if (!consteval_expr(root->left, &left) || !consteval_expr(root->right, &right))
+            return false;
+        return eval_arithmetic(root, &left, &right, out);
+
+    case AST_COMP_EQ:
+    case AST_COMP_NE:
+    case AST_COMP_GT:
+    case AST_COMP_GE:
+    case AST_COMP_LT:
+    case AST_COMP_LE:
+        if (!consteval_expr(root->left, &left) || !consteval_expr(root->right, &right))
+            return false;
+        return eval_comparison(root, &left, &right, out);
+
+    case AST_ATOMIC:
+        // Other threads can change the value at any time, an atomic is never
+        // folded even when its operands are constant
+        return false;
+
+    default:
+        return false;
+    }
+}
+
+// The code generators try every operand of an expression that couldn't be
+// folded, failures are remembered so a deep expression is only walked once
+bool consteval_expr(ASTNode_t *root, ConstValue_t *out)
+{
+    if (root->not_const)
+        return false;
+    if (consteval_node(root, out))
+        return true;
+    root->not_const = true;
+    return false;
+}
+
+bool consteval_convert(ConstValue_t *value, Datatype_t *type)
+{
+    if (datatype_is_float(type))
+    {
+        if (value->type == CONST_INT && value->is_unsigned)
+            value->fnum = (unsigned long)value->num;
+        else if (value->type == CONST_INT)
+            value->fnum = value->num;
+        else if (value->type != CONST_FLOAT)
+            return false;
+        value->type = CONST_FLOAT;
+        value->fnum = round_to_type(type, value->fnum);
+        return true;
+    }
+
+    // Like cvttsd2si, out of range values give the integer indefinite value.
+    // Unsigned longs also take the values up to 2^64 like the generated code
+    if (value->type == CONST_FLOAT)
+    {
+        value->type = CONST_INT;
+        if (value->fnum > -9223372036854775808.0 && value->fnum < 9223372036854775808.0)
+            value->num = (long)value->fnum;
+        else if (datatype_is_unsigned(type) && type->size == 64 && value->fnum >= 0 && value->fnum < 18446744073709551616.0)
+            value->num = (long)(unsigned long)value->fnum;
+        else
+            value->num = LONG_MIN;
+    }
+    if (value->type == CONST_INT)
+    {
+        value->num = wrap_to_type(type, value->num);
+        value->is_unsigned = datatype_is_unsigned(type);
+    }
+    return true;
+}
+
+long consteval_float_bits(double value, int size)
+{
+    if (size == 32)
+    {
+        float f = value;
+        __uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+    long bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
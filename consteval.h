@@ -0,0 +1,65 @@
+#ifndef _CONSTEVAL_H_
+#define _CONSTEVAL_H_
+
+#include "ast.h"
+
+#include <stdbool.h>
+
+typedef enum
+{
+    CONST_INT,  /**< Plain integer value. */
+    CONST_FLOAT, /**< Floating point value, float ones already rounded to float. */
+    CONST_ADDR, /**< Address of a global symbol plus a byte offset. */
+    CONST_STR   /**< Address of a string literal plus a byte offset. */
+} ConstValueType_e;
+
+/**
+ * @brief Value of an expression that is known at compile time.
+ *
+ * Addresses aren't known before linking, so they are kept as the name of
+ * the symbol (or the string literal) they point into plus a byte offset.
+ */
+typedef struct
+{
+    ConstValueType_e type;
+    long num;   /**< Integer value, or byte offset from `base` for addresses. */
+    double fnum; /**< Value of a CONST_FLOAT. */
+    bool is_unsigned; /**< `num` is an unsigned integer, it matters for the unsigned longs. */
+    char *base; /**< Symbol name or string literal the address is based on. */
+} ConstValue_t;
+
+/**
+ * @brief Evaluates an expression at compile time.
+ *
+ * Folds integer and floating point arithmetic and comparisons, const variables with a constant
+ * initializer, the address of global symbols and string literals, and
+ * pointer arithmetic on those addresses. Integer results
+ * wrap the same way the generated code would for the type of the expression,
+ * unsigned ones are kept zero extended.
+ *
+ * @param root Pointer to the root node of the expression.
+ * @param out Pointer to the value filled in on success.
+ * @return true if the expression is a constant expression, false otherwise.
+ */
+bool consteval_expr(ASTNode_t *root, ConstValue_t *out);
+
+/**
+ * @brief Converts a constant to a type, the way an assignment would.
+ *
+ * @param value Pointer to the value converted in place.
+ * @param type Type the value is converted to.
+ * @return false if the value is an address, which can't be converted to a
+ *         floating point type.
+ */
+bool consteval_convert(ConstValue_t *value, Datatype_t *type);
+
+/**
+ * @brief Bits of a floating point value stored in `size` bits.
+ *
+ * @param value Value to encode.
+ * @param size 32 for a float, 64 for a double.
+ * @return The bits of the value, zero extended.
+ */
+long consteval_float_bits(double value, int size);
+
+#endif // _CONSTEVAL_H_
@@ -1,32 +1,72 @@
 #include "datatype.h"
 #include "debug.h"
+#include "consteval.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 // Supported primative sizes are related to the arch of the machine
 // TODO: Move this to code gen
 Datatype_t __supported_primative_types[] = {
-    {"void", 0, 0, 0, NULL},
-    {"char", 8, 0, 0, NULL},
-    {"int", 32, 0, 0, NULL},
-    {"long", 64, 0, 0, NULL}};
+    {.name = "void", .size = 0},
+    {.name = "char", .size = 8},
+    {.name = "int", .size = 32},
+    {.name = "long", .size = 64},
+    {.name = "float", .size = 32, .is_float = true},
+    {.name = "double", .size = 64, .is_float = true},
+    {.name = "unsigned char", .size = 8, .is_unsigned = true},
+    {.name = "unsigned int", .size = 32, .is_unsigned = true},
+    {.name = "unsigned long", .size = 64, .is_unsigned = true}};
 
 static char *datatype_to_str(Datatype_t *type)
 {
-    char *p = malloc(sizeof(char) * (strlen(type->name) + type->pointer_level + 1));
-    strcpy(p, type->name);
-    memset(p + strlen(type->name), '*', type->pointer_level);
-    p[strlen(type->name) + type->pointer_level] = '\0';
+    bool is_const = type->pointer_level > 0 ? type->base_type->is_const : type->is_const;
+    char *prefix = is_const ? "const " : "";
+    size_t len = strlen(prefix) + strlen(type->name);
+    char *p = malloc(sizeof(char) * (len + type->pointer_level + 1));
+    strcpy(p, prefix);
+    strcat(p, type->name);
+    memset(p + len, '*', type->pointer_level);
+    p[len + type->pointer_level] = '\0';
     return p;
 }
 
+// unsigned alone is an unsigned int
+static Datatype_t *get_unsigned_type(Scanner_t *scanner)
+{
+    Token_t tok;
+
+    scanner_peek(scanner, &tok);
+    switch (tok.type)
+    {
+    case TOK_CHAR:
+        scanner_scan(scanner, &tok);
+        return &__supported_primative_types[DT_UCHAR];
+    case TOK_LONG:
+        scanner_scan(scanner, &tok);
+        return &__supported_primative_types[DT_ULONG];
+    case TOK_INT:
+        scanner_scan(scanner, &tok);
+        // fallthrough
+    default:
+        return &__supported_primative_types[DT_UINT];
+    }
+}
+
 Datatype_t *datatype_get_type(Scanner_t *scanner)
 {
     Token_t tok;
     Datatype_t *out;
+    bool is_const = false;
 
     scanner_scan(scanner, &tok);
+    if (tok.type == TOK_CONST)
+    {
+        is_const = true;
+        scanner_scan(scanner, &tok);
+    }
+
     switch (tok.type)
     {
     case TOK_CHAR:
@@ -41,6 +81,22 @@ Datatype_t *datatype_get_type(Scanner_t *scanner)
     case TOK_LONG:
         out = &__supported_primative_types[DT_LONG];
         break;
+    case TOK_FLOAT:
+        out = &__supported_primative_types[DT_FLOAT];
+        break;
+    case TOK_DOUBLE:
+        out = &__supported_primative_types[DT_DOUBLE];
+        break;
+    case TOK_UNSIGNED:
+        out = get_unsigned_type(scanner);
+        break;
+    case TOK_ENUM:
+        // Enumerations are ints, the tag only documents the intent
+        scanner_peek(scanner, &tok);
+        if (tok.type == TOK_ID)
+            scanner_scan(scanner, &tok);
+        out = &__supported_primative_types[DT_INT];
+        break;
     default:
         if (tok.type != TOK_ID)
         {
@@ -58,6 +114,11 @@ Datatype_t *datatype_get_type(Scanner_t *scanner)
         }
     }
 
+    // const qualifies the primative type, so for pointers it is the pointed
+    // to value that can't be modified
+    if (is_const)
+        out = datatype_get_const_of(out);
+
     Datatype_t *t = out;
     while (1)
     {
@@ -74,11 +135,71 @@ Datatype_t *datatype_get_type(Scanner_t *scanner)
     return t;
 }
 
+bool datatype_is_type_start(TokenType_e type)
+{
+    switch (type)
+    {
+    case TOK_CONST:
+    case TOK_CHAR:
+    case TOK_INT:
+    case TOK_VOID:
+    case TOK_LONG:
+    case TOK_FLOAT:
+    case TOK_DOUBLE:
+    case TOK_UNSIGNED:
+    case TOK_ENUM:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_long(Datatype_t *type)
+{
+    type = datatype_unqualified(type);
+    return type == DATATYPE_LONG || type == DATATYPE_ULONG;
+}
+
+// Function signatures are compared all the way down
+bool datatype_same_type(Datatype_t *left, Datatype_t *right)
+{
+    left = datatype_unqualified(left);
+    right = datatype_unqualified(right);
+    if (left == right)
+        return true;
+    if (
+        left->pointer_level != right->pointer_level ||
+        left->array_size != right->array_size ||
+        (left->base_type == NULL) != (right->base_type == NULL))
+        return false;
+    if (left->base_type != NULL)
+        return datatype_same_type(left->base_type, right->base_type);
+    if (left->return_type == NULL || right->return_type == NULL)
+        return false;
+
+    if (left->param_count != right->param_count || !datatype_same_type(left->return_type, right->return_type))
+        return false;
+    for (size_t i = 0; i < left->param_count; i++)
+    {
+        if (!datatype_same_type(left->param_types[i], right->param_types[i]))
+            return false;
+    }
+    return true;
+}
+
 void check_pointer_levels(Datatype_t *left, Datatype_t *right)
 {
     if (
-        (left->pointer_level > 0 && right == datatype_get_primative_type(DT_LONG)) ||
-        (right->pointer_level > 0 && left == datatype_get_primative_type(DT_LONG)))
+        (left->pointer_level > 0 && is_long(right)) ||
+        (right->pointer_level > 0 && is_long(left)))
+        return;
+
+    // void * converts to and from any other pointer
+    if (
+        left->pointer_level > 0 &&
+        right->pointer_level > 0 &&
+        ((left->pointer_level == 1 && datatype_unqualified(left->base_type) == DATATYPE_VOID) ||
+         (right->pointer_level == 1 && datatype_unqualified(right->base_type) == DATATYPE_VOID)))
         return;
 
     if (left->pointer_level != right->pointer_level)
@@ -96,7 +217,11 @@ void check_pointer_levels(Datatype_t *left, Datatype_t *right)
         exit(1);
     }
 
-    if (left->pointer_level > 0 && right->pointer_level > 0 && left->base_type != right->base_type)
+    if (
+        left->pointer_level > 0 &&
+        right->pointer_level > 0 &&
+        datatype_unqualified(left->base_type) != datatype_unqualified(right->base_type) &&
+        !(datatype_is_func_pointer(left) && datatype_is_func_pointer(right)))
     {
         char *t1, *t2;
         t1 = datatype_to_str(left);
@@ -115,6 +240,10 @@ void check_pointer_levels(Datatype_t *left, Datatype_t *right)
 // TODO check for items other than type size later
 Datatype_t *datatype_expr_type(Datatype_t *left, Datatype_t *right)
 {
+    // The result of an expression is never const
+    left = datatype_unqualified(left);
+    right = datatype_unqualified(right);
+
     // similar types
     if (left == right)
         return left;
@@ -130,17 +259,62 @@ Datatype_t *datatype_expr_type(Datatype_t *left, Datatype_t *right)
         exit(1);
     }
 
+    // Integers are converted to the floating point type, pointers never are
+    if (datatype_is_float(left) || datatype_is_float(right))
+    {
+        if (left->pointer_level > 0 || right->pointer_level > 0)
+        {
+            debug_print(SEV_ERROR, "[DATATYPE] Can't mix pointers and floating point values");
+            exit(1);
+        }
+        if (!datatype_is_float(right) || (datatype_is_float(left) && left->size > right->size))
+            return left;
+        return right;
+    }
+
     if (left->size > right->size)
         return left;
-    else
+    if (left->size < right->size)
         return right;
+    // Of two integers of the same size the unsigned one wins, like in C
+    return datatype_is_unsigned(left) ? left : right;
 }
 
 // TODO check for items other than type size later
-void datatype_check_assign_expr_type(Datatype_t *left, Datatype_t *right)
+void datatype_check_assign_expr_type(Datatype_t *left, ASTNode_t *value)
 {
+    Datatype_t *right = value->expr_type;
+    ConstValue_t constant;
+
     check_pointer_levels(left, right);
 
+    if (
+        left->pointer_level > 0 &&
+        right->pointer_level > 0 &&
+        right->base_type->is_const &&
+        !left->base_type->is_const)
+    {
+        char *t1, *t2;
+        t1 = datatype_to_str(right);
+        t2 = datatype_to_str(left);
+        debug_print(SEV_ERROR, "[DATATYPE] Assigning %s to %s discards the const qualifier", t1, t2);
+        free(t1);
+        free(t2);
+        exit(1);
+    }
+
+    // Calls through a function pointer trust its signature
+    if (datatype_is_func_pointer(left) && datatype_is_func_pointer(right) && !datatype_same_type(left, right))
+    {
+        char *t1, *t2;
+        t1 = datatype_to_str(right);
+        t2 = datatype_to_str(left);
+        debug_print(SEV_ERROR, "[DATATYPE] Can't assign %s to %s, the signatures differ", t1, t2);
+        free(t1);
+        free(t2);
+        exit(1);
+    }
+
     // void operations
     if (
         (left == DATATYPE_VOID && right != DATATYPE_VOID) ||
@@ -150,24 +324,124 @@ void datatype_check_assign_expr_type(Datatype_t *left, Datatype_t *right)
         exit(1);
     }
 
+    // Integers and floating point values convert to each other like in C,
+    // only the narrowing of a value of the same kind is rejected
+    if (datatype_is_float(left) != datatype_is_float(right))
+    {
+        if (left->pointer_level > 0 || right->pointer_level > 0)
+        {
+            debug_print(SEV_ERROR, "[DATATYPE] Can't assign %s to %s", right->name, left->name);
+            exit(1);
+        }
+        return;
+    }
+
     if (left->size < right->size)
     {
+        if (datatype_is_float(left) && consteval_expr(value, &constant) && constant.type == CONST_FLOAT)
+            return;
         debug_print(SEV_ERROR, "[DATATYPE] Can't assign %s to %s", right->name, left->name);
         exit(1);
     }
 }
 
+// Size in bytes of a value of the type, arrays count all their elements
+long datatype_size_of(Datatype_t *type)
+{
+    if (type->array_size > 0)
+    {
+        long elem_size = type->pointer_level > 1 ? 8 : type->base_type->size / 8;
+        return type->array_size * elem_size;
+    }
+    return type->size / 8;
+}
+
 Datatype_t *datatype_get_primative_type(Datatype_Primative_e type)
 {
     return &__supported_primative_types[type];
 }
 
+Datatype_t *datatype_get_const_of(Datatype_t *type)
+{
+    Datatype_t *out;
+
+    if (type->is_const)
+        return type;
+    out = malloc(sizeof(Datatype_t));
+    *out = *type;
+    out->is_const = true;
+    return out;
+}
+
+// Functions have no size, only pointers to them are values. The name spells
+// the signature, e.g. `int (int, long)`
+Datatype_t *datatype_get_func_type(Datatype_t *return_type, Datatype_t **param_types, size_t param_count)
+{
+    Datatype_t *out = calloc(1, sizeof(Datatype_t));
+    char *ret = datatype_to_str(return_type);
+    char *params[param_count ? param_count : 1];
+    size_t len = strlen(ret) + 4;
+
+    if (param_count > UINT8_MAX)
+    {
+        debug_print(SEV_ERROR, "[DATATYPE] Function types take at most %d parameters", UINT8_MAX);
+        exit(1);
+    }
+    for (size_t i = 0; i < param_count; i++)
+    {
+        params[i] = datatype_to_str(param_types[i]);
+        len += strlen(params[i]) + 2;
+    }
+    out->name = malloc(len);
+    strcpy(out->name, ret);
+    free(ret);
+    strcat(out->name, " (");
+    for (size_t i = 0; i < param_count; i++)
+    {
+        strcat(out->name, params[i]);
+        if (i + 1 < param_count)
+            strcat(out->name, ", ");
+        free(params[i]);
+    }
+    strcat(out->name, ")");
+
+    out->return_type = return_type;
+    out->param_types = param_types;
+    out->param_count = param_count;
+    return out;
+}
+
+bool datatype_is_func_pointer(Datatype_t *type)
+{
+    return type->pointer_level == 1 && type->array_size == 0 && type->base_type->return_type != NULL;
+}
+
+Datatype_t *datatype_unqualified(Datatype_t *type)
+{
+    if (!type->is_const || type->pointer_level > 0)
+        return type;
+
+    for (int i = DT_VOID; i <= DT_ULONG; i++)
+    {
+        if (strcmp(__supported_primative_types[i].name, type->name) == 0)
+            return &__supported_primative_types[i];
+    }
+    return type;
+}
+
 Datatype_t *datatype_get_pointer_of(Datatype_t *type)
 {
     Datatype_t *out = malloc(sizeof(Datatype_t));
     out->name = type->name;
     out->size = 64; // pointer size is always 8 bytes
     out->pointer_level = type->pointer_level + 1;
+    out->array_size = 0;
+    out->is_const = false;
+    out->is_float = false;
+    out->is_unsigned = false;
+    out->return_type = NULL;
+    out->param_types = NULL;
+    out->param_count = 0;
     if (type->base_type == NULL)
         out->base_type = type;
     else
@@ -179,6 +453,11 @@ Datatype_t *datatype_deref_pointer(Datatype_t *type, __uint8_t derefrence_level)
 {
     Datatype_t *out = malloc(sizeof(Datatype_t));
     out->name = type->name;
+    out->array_size = 0;
+    out->is_const = false;
+    out->return_type = NULL;
+    out->param_types = NULL;
+    out->param_count = 0;
     if (type->pointer_level == 0)
     {
         debug_print(SEV_ERROR, "[DATATYPE] Can't defrence %s", datatype_to_str(type));
@@ -199,11 +478,26 @@ Datatype_t *datatype_deref_pointer(Datatype_t *type, __uint8_t derefrence_level)
     {
         out->size = type->base_type->size;
         out->base_type = NULL;
+        out->is_const = type->base_type->is_const;
+        out->is_float = type->base_type->is_float;
+        out->is_unsigned = type->base_type->is_unsigned;
     }
     else
     {
         out->size = 64; // pointer size is always 8 bytes
         out->base_type = type->base_type;
+        out->is_float = false;
+        out->is_unsigned = false;
     }
     return out;
-}
\ No newline at end of file
+}
+
+bool datatype_is_float(Datatype_t *type)
+{
+    return type->is_float && type->pointer_level == 0;
+}
+
+bool datatype_is_unsigned(Datatype_t *type)
+{
+    return type->is_unsigned && type->pointer_level == 0;
+}
@@ -6,6 +6,8 @@
 
 #include "scanner.h"
 
+typedef struct ASTNode_t ASTNode_t;
+
 typedef struct Datatype_t Datatype_t;
 struct Datatype_t
 {
@@ -14,6 +16,12 @@ struct Datatype_t
     __int8_t pointer_level;
     __uint32_t array_size;
     Datatype_t *base_type;
+    bool is_const;
+    bool is_float;    /**< float or double, not set on pointers to them. */
+    bool is_unsigned; /**< unsigned integer, not set on pointers to them. */
+    Datatype_t *return_type;  /**< Returned type of a function type, NULL for other types. */
+    Datatype_t **param_types; /**< Parameter types of a function type. */
+    __uint8_t param_count;
 };
 
 typedef enum
@@ -21,7 +29,12 @@ typedef enum
     DT_VOID,
     DT_CHAR,
     DT_INT,
-    DT_LONG
+    DT_LONG,
+    DT_FLOAT,
+    DT_DOUBLE,
+    DT_UCHAR,
+    DT_UINT,
+    DT_ULONG
 } Datatype_Primative_e;
 
 extern Datatype_t __supported_primative_types[];
@@ -30,11 +43,32 @@ extern Datatype_t __supported_primative_types[];
 #define DATATYPE_CHAR (&__supported_primative_types[1])
 #define DATATYPE_INT (&__supported_primative_types[2])
 #define DATATYPE_LONG (&__supported_primative_types[3])
+#define DATATYPE_FLOAT (&__supported_primative_types[4])
+#define DATATYPE_DOUBLE (&__supported_primative_types[5])
+#define DATATYPE_UCHAR (&__supported_primative_types[6])
+#define DATATYPE_UINT (&__supported_primative_types[7])
+#define DATATYPE_ULONG (&__supported_primative_types[8])
 
 Datatype_t *datatype_get_type(Scanner_t *scanner);
+bool datatype_is_type_start(TokenType_e type);
 Datatype_t *datatype_get_primative_type(Datatype_Primative_e type);
 Datatype_t *datatype_expr_type(Datatype_t *left, Datatype_t *right);
-void datatype_check_assign_expr_type(Datatype_t *left, Datatype_t *right);
+/**
+ * @brief Checks that a value can be stored in a variable of type `left`,
+ *        exits with an error otherwise.
+ *
+ * A double constant expression may be stored in a float, it is rounded like
+ * in C.
+ */
+void datatype_check_assign_expr_type(Datatype_t *left, ASTNode_t *value);
 Datatype_t *datatype_deref_pointer(Datatype_t *type, __uint8_t derefrence_level);
 Datatype_t *datatype_get_pointer_of(Datatype_t *type);
+Datatype_t *datatype_get_const_of(Datatype_t *type);
+Datatype_t *datatype_get_func_type(Datatype_t *return_type, Datatype_t **param_types, size_t param_count);
+bool datatype_is_func_pointer(Datatype_t *type);
+bool datatype_same_type(Datatype_t *left, Datatype_t *right);
+Datatype_t *datatype_unqualified(Datatype_t *type);
+bool datatype_is_float(Datatype_t *type);
+bool datatype_is_unsigned(Datatype_t *type);
+long datatype_size_of(Datatype_t *type);
 #endif
\ No newline at end of file
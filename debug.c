@@ -61,8 +61,10 @@ static void ast_print_recursive(ASTNode_t *node, int depth, int is_last)
         print_branches(depth, is_last);
 
         printf("%s", NodeToString(*node));
-        if (node->type == AST_INT_LIT)
-            printf(": %d", node->value.num);
+        if (node->type == AST_INT_LIT && datatype_is_unsigned(node->expr_type))
+            printf(": %luu", (unsigned long)node->value.lit);
+        else if (node->type == AST_INT_LIT)
+            printf(": %ld", node->value.lit);
         printf("\n");
 
         if (node->left || node->right)
@@ -6,16 +6,45 @@
 #include "datatype.h"
 #include "llist_definitions.h"
 
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
+/**
+ * @brief Token range of a top-level declaration found by the pre-pass of the
+ *        parallel parser.
+ */
+typedef struct
+{
+    size_t start; /**< First token of the declaration. */
+    size_t body;  /**< First token of the function body, 0 for variables. */
+    size_t end;   /**< One past the last token of the declaration. */
+    int symbol;   /**< Symbol of the function, once its signature is parsed. */
+    int position; /**< Position of the declaration, see symtab_set_position(). */
+    ASTNode_t *node;
+} TopLevelDecl_t;
+
+typedef struct
+{
+    Token_t *tokens;
+    TopLevelDecl_t *decls;
+    size_t decls_count;
+    atomic_size_t next_decl;
+} ParallelParser_t;
+
 static void decl_id(Scanner_t *scanner, Token_t *tok);
 static ASTNode_t *decl_function(Scanner_t *scanner);
+static ASTNode_t *decl_extern(Scanner_t *scanner);
+static int decl_function_signature(Scanner_t *scanner, bool definition);
+static ASTNode_t *decl_function_body(Scanner_t *scanner, int symbol_index);
 
 static void *args_decl(Scanner_t *scanner, LList_t *args_list);
 
-int decl_current_func = DECL_NO_FUNC;
+_Thread_local int decl_current_func = DECL_NO_FUNC;
 
 static void decl_id(Scanner_t *scanner, Token_t *tok)
 {
@@ -29,61 +58,159 @@ static void decl_id(Scanner_t *scanner, Token_t *tok)
     }
 }
 
-ASTNode_t *decl_declarations(Scanner_t *scanner)
+ASTNode_t *decl_declaration(Scanner_t *scanner)
 {
-    ASTNode_t *root = NULL;
-    ASTNode_t *head = NULL;
-    ASTNode_t *current = NULL;
+    Token_t tok;
     TokenType_e type;
 
-    bool need_to_flatten = false;
-
     if (scanner == NULL)
         return NULL;
 
+    // Top-level declarations are numbered in file order
+    symtab_set_position(symtab_get_position() + 1);
+
+    scanner_peek(scanner, &tok);
+    if (tok.type == TOK_EXTERN)
+        return decl_extern(scanner);
+
+    // Enumerations only add symbols, the next declaration is returned instead
+    if (decl_enum(scanner))
+        return decl_declaration(scanner);
+
     while (1)
     {
-        while (1)
+        type = scanner_cache_tok(scanner);
+        if (
+            type == TOK_SEMICOLON ||
+            type == TOK_EMPTY ||
+            type == TOK_LPAREN ||
+            type == TOK_EOF ||
+            type == TOK_COMMA ||
+            type == TOK_ASSIGN ||
+            type == TOK_LBRACKET)
+            break;
+    }
+
+    // '(' followed by '*' starts the declarator of a function pointer
+    if (type == TOK_LPAREN)
+    {
+        Token_t next;
+        scanner_peek_at(scanner, &next, scanner->buffer_size);
+        if (next.type == TOK_STAR)
+            type = TOK_STAR;
+    }
+
+    switch (type)
+    {
+    case TOK_EOF:
+        return NULL;
+    case TOK_LPAREN:
+        return decl_function(scanner);
+    default:
+        return decl_var(scanner);
+    }
+}
+
+bool decl_enum(Scanner_t *scanner)
+{
+    Token_t tok;
+    long value = 0;
+    int symbol_index;
+
+    scanner_peek(scanner, &tok);
+    if (tok.type != TOK_ENUM)
+        return false;
+    scanner_peek_at(scanner, &tok, 1);
+    if (tok.type == TOK_ID)
+        scanner_peek_at(scanner, &tok, 2);
+    if (tok.type != TOK_LBRACE)
+        return false;
+
+    // The tag isn't kept, enumerations are ints
+    do
+        scanner_scan(scanner, &tok);
+    while (tok.type != TOK_LBRACE);
+    scanner_peek(scanner, &tok);
+    while (tok.type != TOK_RBRACE)
+    {
+        decl_id(scanner, &tok);
+        symbol_index = symtab_add_global_symbol(
+            tok.value.str_value,
+            SYMBOL_ENUM,
+            datatype_get_const_of(DATATYPE_INT));
+
+        scanner_peek(scanner, &tok);
+        if (tok.type == TOK_ASSIGN)
         {
-            type = scanner_cache_tok(scanner);
-            if (
-                type == TOK_SEMICOLON ||
-                type == TOK_EMPTY ||
-                type == TOK_LPAREN ||
-                type == TOK_EOF ||
-                type == TOK_COMMA ||
-                type == TOK_ASSIGN)
-                break;
+            scanner_scan(scanner, &tok);
+            value = expr_int_constant(scanner, symtab_get_symbol(symbol_index)->sym_name);
+        }
+        if (value < INT_MIN || value > INT_MAX)
+        {
+            debug_print(
+                SEV_ERROR,
+                "[DECL] Value of %s doesn't fit an int",
+                symtab_get_symbol(symbol_index)->sym_name);
+            exit(1);
         }
 
-        if (type == TOK_EOF)
-            break;
+        symtab_get_symbol(symbol_index)->init_value =
+            ast_create_leaf_node(AST_INT_LIT, (ASTNodeValue)value);
+        symtab_get_symbol(symbol_index)->init_value->expr_type = DATATYPE_INT;
+        value++;
 
-        switch (type)
-        {
-        case TOK_LPAREN:
-            current = decl_function(scanner);
-            break;
-        default:
-            current = decl_var(scanner);
-            need_to_flatten = true;
+        scanner_peek(scanner, &tok);
+        if (tok.type != TOK_COMMA)
             break;
-        }
+        scanner_scan(scanner, &tok);
+        scanner_peek(scanner, &tok);
+    }
+    scanner_match(scanner, TOK_RBRACE);
+    scanner_match(scanner, TOK_SEMICOLON);
+    return true;
+}
 
+static void forget_local_init_values(ASTNode_t *node)
+{
+    while (node != NULL)
+    {
+        if (node->type == AST_VAR_DECL)
+            symtab_get_symbol(node->value.num)->init_value = NULL;
+        forget_local_init_values(node->left);
+        forget_local_init_values(node->right);
+        node = node->next;
+    }
+}
+
+void decl_free(ASTNode_t *decl)
+{
+    // Global variables stay alive, const globals keep pointing to their
+    // initializers so later uses can still be folded
+    if (decl->type != AST_FUNC_DECL)
+        return;
+
+    // Uses of const locals after this point are read from memory instead
+    forget_local_init_values(decl->left);
+    ast_free(decl);
+}
+
+ASTNode_t *decl_declarations(Scanner_t *scanner)
+{
+    ASTNode_t *root = NULL;
+    ASTNode_t *head = NULL;
+    ASTNode_t *current = NULL;
+
+    while ((current = decl_declaration(scanner)) != NULL)
+    {
         if (root == NULL)
             root = current;
         if (head != NULL)
             head->next = current;
-        head = current;
 
         // Move the list tail to the last item in the var decl in case of any
         // This will handle multiple var declarations in the same line
         // int a, b, c;
-        if (need_to_flatten)
-        {
-            head = ast_flatten(head);
-            need_to_flatten = false;
-        }
+        head = ast_flatten(current);
     }
     return root;
 }
@@ -92,26 +219,103 @@ ASTNode_t *decl_declarations(Scanner_t *scanner)
 // TODO: Create symbol table for each function
 // TODO: Create a visualization code for SymbolTables
 static ASTNode_t *decl_function(Scanner_t *scanner)
+{
+    return decl_function_body(scanner, decl_function_signature(scanner, true));
+}
+
+// Only functions can be extern, they are resolved when the program is linked
+static ASTNode_t *decl_extern(Scanner_t *scanner)
+{
+    ASTNode_t *proto;
+    int symbol_index;
+
+    scanner_match(scanner, TOK_EXTERN);
+    symbol_index = decl_function_signature(scanner, false);
+    scanner_match(scanner, TOK_SEMICOLON);
+
+    proto = ast_create_leaf_node(AST_FUNC_PROTO, (ASTNodeValue)symbol_index);
+    proto->expr_type = symtab_get_symbol(symbol_index)->data_type;
+    return proto;
+}
+
+// A function may be declared several times but defined once, the later
+// declarations must repeat the signature and reuse the symbol. The names of
+// the parameters are the ones of the definition
+static void decl_redeclare_function(int symbol_index, char *name, Datatype_t *return_type, LList_t *args, bool definition)
+{
+    SymbolFunc_t *func = (SymbolFunc_t *)symtab_get_symbol(symbol_index);
+    SymbolFuncArg_t *arg;
+
+    if (func->sym_type != SYMBOL_FUNC || (definition && func->defined))
+    {
+        debug_print(SEV_ERROR, "[DECL] Redefining symbol %s", name);
+        exit(1);
+    }
+    if (!datatype_same_type(func->data_type, return_type) || func->args.size != args->size)
+    {
+        debug_print(SEV_ERROR, "[DECL] Conflicting declarations of %s", name);
+        exit(1);
+    }
+    for (size_t i = 0; i < args->size; i++)
+    {
+        if (!datatype_same_type(LList_SymbolFuncArg_get(&func->args, i)->arg_type, LList_SymbolFuncArg_get(args, i)->arg_type))
+        {
+            debug_print(SEV_ERROR, "[DECL] Conflicting declarations of %s", name);
+            exit(1);
+        }
+    }
+
+    while (args->size > 0)
+    {
+        arg = LList_SymbolFuncArg_pop(args);
+        if (definition)
+            LList_SymbolFuncArg_get(&func->args, args->size)->arg_name = arg->arg_name;
+        else
+            free(arg->arg_name);
+        free(arg);
+    }
+}
+
+static int decl_function_signature(Scanner_t *scanner, bool definition)
 {
     Token_t tok;
-    ASTNode_t *stmts;
-    ASTNode_t *func;
     Datatype_t *return_type;
+    LList_t args;
     int symbol_index;
 
     return_type = datatype_get_type(scanner);
     decl_id(scanner, &tok);
 
-    symbol_index = symtab_add_global_symbol(
-        tok.value.str_value,
-        SYMBOL_FUNC,
-        return_type);
-    decl_current_func = symbol_index;
-
+    LList_init(&args);
     scanner_match(scanner, TOK_LPAREN);
-    args_decl(scanner, &((SymbolFunc_t *)symtab_get_symbol(symbol_index))->args);
+    args_decl(scanner, &args);
     scanner_match(scanner, TOK_RPAREN);
 
+    symbol_index = symtab_find_global_symbol(tok.value.str_value);
+    if (symbol_index < 0)
+    {
+        symbol_index = symtab_add_global_symbol(
+            tok.value.str_value,
+            SYMBOL_FUNC,
+            return_type);
+        ((SymbolFunc_t *)symtab_get_symbol(symbol_index))->args = args;
+    }
+    else
+    {
+        decl_redeclare_function(symbol_index, tok.value.str_value, return_type, &args, definition);
+    }
+    ((SymbolFunc_t *)symtab_get_symbol(symbol_index))->defined |= definition;
+    if (definition)
+        ((SymbolFunc_t *)symtab_get_symbol(symbol_index))->definition = symtab_get_position();
+    return symbol_index;
+}
+
+static ASTNode_t *decl_function_body(Scanner_t *scanner, int symbol_index)
+{
+    ASTNode_t *stmts;
+    ASTNode_t *func;
+
+    decl_current_func = symbol_index;
     stmts = stmt_block(scanner);
     decl_current_func = DECL_NO_FUNC;
 
@@ -120,10 +324,205 @@ static ASTNode_t *decl_function(Scanner_t *scanner)
         stmts,
         NULL,
         (ASTNodeValue)symbol_index);
-    func->expr_type = return_type;
+    func->expr_type = symtab_get_symbol(symbol_index)->data_type;
     return func;
 }
 
+// Splits the tokens into top-level declarations. A declaration is a function
+// when '(' comes before any of '=', ',', '[', '{' or ';' and isn't followed by
+// the '*' of a function pointer, its body then runs up to the '}' closing its
+// first '{'. Anything else ends at the first ';' outside braces
+static size_t find_top_level_decls(Token_t *tokens, size_t count, TopLevelDecl_t **out)
+{
+    size_t capacity = 64;
+    size_t decls_count = 0;
+    TopLevelDecl_t *decls = malloc(capacity * sizeof(TopLevelDecl_t));
+    size_t i = 0;
+
+    while (i < count)
+    {
+        TopLevelDecl_t decl = {.start = i, .body = 0};
+        int depth = 0;
+
+        while (
+            i < count &&
+            tokens[i].type != TOK_LPAREN &&
+            tokens[i].type != TOK_ASSIGN &&
+            tokens[i].type != TOK_COMMA &&
+            tokens[i].type != TOK_LBRACKET &&
+            tokens[i].type != TOK_LBRACE &&
+            tokens[i].type != TOK_SEMICOLON)
+            i++;
+
+        if (i < count && tokens[i].type == TOK_LPAREN && !(i + 1 < count && tokens[i + 1].type == TOK_STAR))
+        {
+            while (i < count && tokens[i].type != TOK_LBRACE && tokens[i].type != TOK_SEMICOLON)
+                i++;
+            if (i < count && tokens[i].type == TOK_LBRACE)
+                decl.body = i;
+        }
+
+        for (; i < count; i++)
+        {
+            if (tokens[i].type == TOK_LBRACE)
+                depth++;
+            else if (tokens[i].type == TOK_RBRACE && --depth == 0 && decl.body != 0)
+                break;
+            else if (tokens[i].type == TOK_SEMICOLON && depth == 0 && decl.body == 0)
+                break;
+        }
+        decl.end = i < count ? i + 1 : count;
+        i = decl.end;
+
+        if (decls_count == capacity)
+        {
+            capacity *= 2;
+            decls = realloc(decls, capacity * sizeof(TopLevelDecl_t));
+        }
+        decls[decls_count++] = decl;
+    }
+
+    *out = decls;
+    return decls_count;
+}
+
+static void *parse_function_bodies(void *arg)
+{
+    ParallelParser_t *parser = (ParallelParser_t *)arg;
+    size_t i;
+
+    while ((i = atomic_fetch_add(&parser->next_decl, 1)) < parser->decls_count)
+    {
+        TopLevelDecl_t *decl = &parser->decls[i];
+        if (decl->body == 0)
+            continue;
+
+        Scanner_t *body = scanner_init_from_tokens(&parser->tokens[decl->body], decl->end - decl->body);
+        symtab_set_position(decl->position);
+        decl->node = decl_function_body(body, decl->symbol);
+        free(body);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Parses the top-level declarations of a pre-lexed file on `jobs` threads.
+ *
+ * A pre-pass splits the tokens into top-level declarations. Global variables
+ * and function signatures are then parsed in order, so every global symbol
+ * is known before any function body is parsed. Function bodies, the bulk of
+ * the work, are parsed concurrently. Only the locals declared in bodies are
+ * added to the symbol table from then on, under its lock. Symbols record
+ * the position of their declaration, so a body still can't use the globals
+ * declared after it.
+ *
+ * Falls back to decl_declarations() when the scanner lexes on demand.
+ */
+ASTNode_t *decl_declarations_parallel(Scanner_t *scanner, size_t jobs)
+{
+    ParallelParser_t parser;
+    ASTNode_t *root = NULL;
+    ASTNode_t *head = NULL;
+
+    if (scanner == NULL || scanner->tokens == NULL || jobs < 2)
+        return decl_declarations(scanner);
+
+    parser.tokens = scanner->tokens;
+    parser.decls_count = find_top_level_decls(scanner->tokens, scanner->tokens_count, &parser.decls);
+    atomic_init(&parser.next_decl, 0);
+
+    for (size_t i = 0; i < parser.decls_count; i++)
+    {
+        TopLevelDecl_t *decl = &parser.decls[i];
+        Scanner_t *view;
+
+        if (decl->body == 0)
+        {
+            view = scanner_init_from_tokens(&parser.tokens[decl->start], decl->end - decl->start);
+            decl->node = decl_declaration(view);
+        }
+        else
+        {
+            view = scanner_init_from_tokens(&parser.tokens[decl->start], decl->body - decl->start);
+            symtab_set_position(symtab_get_position() + 1);
+            decl->symbol = decl_function_signature(view, true);
+            scanner_match(view, TOK_EOF);
+        }
+        decl->position = symtab_get_position();
+        free(view);
+    }
+
+    pthread_t *threads = malloc(jobs * sizeof(pthread_t));
+    for (size_t i = 1; i < jobs; i++)
+    {
+        if (pthread_create(&threads[i], NULL, parse_function_bodies, &parser) != 0)
+        {
+            debug_print(SEV_ERROR, "[DECL] Couldn't start a parser thread");
+            exit(1);
+        }
+    }
+    parse_function_bodies(&parser);
+    for (size_t i = 1; i < jobs; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+
+    for (size_t i = 0; i < parser.decls_count; i++)
+    {
+        if (parser.decls[i].node == NULL)
+            continue;
+        if (root == NULL)
+            root = parser.decls[i].node;
+        if (head != NULL)
+            head->next = parser.decls[i].node;
+        head = ast_flatten(parser.decls[i].node);
+    }
+    free(parser.decls);
+    return root;
+}
+
+// Size of an array declarator, `[size]`, 0 when it is left out to be taken
+// from the initializer. Returns false when no array is declared
+static bool decl_array_size(Scanner_t *scanner, char *name, long *size)
+{
+    Token_t tok;
+
+    scanner_peek(scanner, &tok);
+    if (tok.type != TOK_LBRACKET)
+        return false;
+
+    scanner_scan(scanner, &tok);
+    scanner_peek(scanner, &tok);
+    *size = 0;
+    if (tok.type != TOK_RBRACKET)
+    {
+        *size = expr_int_constant(scanner, name);
+        if (*size <= 0 || *size > UINT32_MAX)
+        {
+            debug_print(SEV_ERROR, "[DECL] Array %s has an invalid size %ld", name, *size);
+            exit(1);
+        }
+    }
+    scanner_match(scanner, TOK_RBRACKET);
+    return true;
+}
+
+// Parameter list of a function pointer type, the names are only documentation
+static Datatype_t *decl_func_type(Scanner_t *scanner, Datatype_t *return_type)
+{
+    LList_t params;
+    Datatype_t **param_types;
+
+    LList_SymbolFuncArg_init(&params);
+    scanner_match(scanner, TOK_LPAREN);
+    args_decl(scanner, &params);
+    scanner_match(scanner, TOK_RPAREN);
+
+    param_types = malloc((params.size ? params.size : 1) * sizeof(Datatype_t *));
+    for (size_t i = 0; i < params.size; i++)
+        param_types[i] = LList_SymbolFuncArg_get(&params, i)->arg_type;
+    return datatype_get_func_type(return_type, param_types, params.size);
+}
+
 ASTNode_t *decl_var(Scanner_t *scanner)
 {
     Datatype_t *var_type;
@@ -138,15 +537,53 @@ ASTNode_t *decl_var(Scanner_t *scanner)
 
     while (1)
     {
-        decl_id(scanner, &tok);
+        Datatype_t *elem_type = var_type;
+        Datatype_t *type;
+        char *name;
+        bool is_array;
+        long array_size;
+
+        // Function pointers are declared as `(*name)(params)`, arrays of them
+        // as `(*name[size])(params)`
+        scanner_peek(scanner, &tok);
+        if (tok.type == TOK_LPAREN)
+        {
+            scanner_match(scanner, TOK_LPAREN);
+            scanner_match(scanner, TOK_STAR);
+            decl_id(scanner, &tok);
+            name = tok.value.str_value;
+            is_array = decl_array_size(scanner, name, &array_size);
+            scanner_match(scanner, TOK_RPAREN);
+            elem_type = datatype_get_pointer_of(decl_func_type(scanner, var_type));
+        }
+        else
+        {
+            decl_id(scanner, &tok);
+            name = tok.value.str_value;
+            is_array = decl_array_size(scanner, name, &array_size);
+        }
 
-        symbol_index = symtab_add_global_symbol(
-            tok.value.str_value,
-            SYMBOL_VAR,
-            var_type);
+        type = elem_type;
+        if (is_array)
+        {
+            type = datatype_get_pointer_of(elem_type);
+            type->array_size = array_size;
+        }
+
+        symbol_index = symtab_add_global_symbol(name, SYMBOL_VAR, type);
+        // Local arrays live in the frame, scalars are static
+        if (decl_current_func != DECL_NO_FUNC && !is_array && symtab_mark_func_locals(decl_current_func))
+        {
+            debug_print(
+                SEV_ERROR,
+                "[DECL] %s is run by parallel_for, its threads would share the local %s",
+                symtab_get_symbol(decl_current_func)->sym_name,
+                name);
+            exit(1);
+        }
 
         current_var = ast_create_leaf_node(AST_VAR_DECL, (ASTNodeValue)symbol_index);
-        current_var->expr_type = var_type;
+        current_var->expr_type = type;
 
         if (var_list_head == NULL)
             var_list_head = current_var;
@@ -157,35 +594,49 @@ ASTNode_t *decl_var(Scanner_t *scanner)
         var_list_tail = current_var;
 
         scanner_peek(scanner, &tok);
-        if (tok.type == TOK_ASSIGN)
+        if (tok.type == TOK_ASSIGN && !is_array)
         {
             scanner_scan(scanner, &tok);
             current_var->left = expr_expression(scanner);
-            datatype_check_assign_expr_type(
-                symtab_get_symbol(symbol_index)->data_type,
-                current_var->left->expr_type);
+            current_var->left->parent = current_var;
+            datatype_check_assign_expr_type(type, current_var->left);
+            if (datatype_is_func_pointer(type))
+                symtab_vote_call_target(&symtab_get_symbol(symbol_index)->targets, current_var->left);
+
+            // Keep the value of const variables so their uses can be folded
+            if (type->is_const)
+                symtab_get_symbol(symbol_index)->init_value = current_var->left;
             scanner_peek(scanner, &tok);
         }
-        else if (tok.type == TOK_LBRACKET)
+        else if (tok.type == TOK_ASSIGN)
         {
+            __uint32_t elems_count;
+
             scanner_scan(scanner, &tok);
-            scanner_scan(scanner, &tok);
-            if (tok.type == TOK_INTLIT)
+            current_var->left = expr_init_list(scanner, elem_type);
+            current_var->left->parent = current_var;
+            current_var->left->expr_type = type;
+            if (elem_type->is_const)
+                symtab_get_symbol(symbol_index)->init_value = current_var->left;
+            for (ASTNode_t *elem = current_var->left->left; elem && datatype_is_func_pointer(elem_type); elem = elem->next)
+                symtab_vote_call_target(&symtab_get_symbol(symbol_index)->targets, elem);
+
+            // The array size can be left out and taken from the initializer
+            elems_count = args_count(current_var->left->left);
+            if (type->array_size == 0)
+                type->array_size = elems_count;
+            else if (elems_count > type->array_size)
             {
-                Datatype_t *array_dt = datatype_get_pointer_of(var_type);
-                array_dt->array_size = tok.value.int_value;
-                current_var->expr_type = array_dt;
-                symtab_get_symbol(symbol_index)->data_type = array_dt;
-            }
-            else
-            {
-                debug_print(
-                    SEV_ERROR,
-                    "[DATATYPE] Expected an integer literal, found %s",
-                    TokToString(tok));
+                debug_print(SEV_ERROR, "[DECL] Too many initializers for array %s", name);
                 exit(1);
             }
-            scanner_match(scanner, TOK_RBRACKET);
+            scanner_peek(scanner, &tok);
+        }
+
+        if (is_array && type->array_size == 0)
+        {
+            debug_print(SEV_ERROR, "[DECL] Array %s has no size", name);
+            exit(1);
         }
 
         if (tok.type == TOK_COMMA)
@@ -231,6 +682,7 @@ static void *args_decl(Scanner_t *scanner, LList_t *args_list)
 {
     Token_t tok;
     Datatype_t *type;
+    char *name;
 
     while (true)
     {
@@ -239,13 +691,39 @@ static void *args_decl(Scanner_t *scanner, LList_t *args_list)
             break;
 
         type = datatype_get_type(scanner);
-        scanner_scan(scanner, &tok);
-        if (tok.type != TOK_ID)
+
+        // Names are optional, prototypes often leave them out
+        name = "";
+        scanner_peek(scanner, &tok);
+        if (tok.type == TOK_RPAREN && type == DATATYPE_VOID && args_list->size == 0)
+            break;
+        if (tok.type == TOK_LPAREN)
         {
-            debug_print(SEV_ERROR, "[DECL] Expected an identifier, found %s", TokToString(tok));
+            // Function pointer, `(*name)(params)`
+            scanner_match(scanner, TOK_LPAREN);
+            scanner_match(scanner, TOK_STAR);
+            scanner_peek(scanner, &tok);
+            if (tok.type == TOK_ID)
+            {
+                scanner_scan(scanner, &tok);
+                name = tok.value.str_value;
+            }
+            scanner_match(scanner, TOK_RPAREN);
+            type = datatype_get_pointer_of(decl_func_type(scanner, type));
         }
-        SymbolFuncArg_t *argument = (SymbolFuncArg_t *)malloc(sizeof(SymbolFuncArg_t));
-        argument->arg_name = strdup(tok.value.str_value);
+        else if (tok.type != TOK_COMMA && tok.type != TOK_RPAREN)
+        {
+            scanner_scan(scanner, &tok);
+            if (tok.type != TOK_ID)
+            {
+                debug_print(SEV_ERROR, "[DECL] Expected an identifier, found %s", TokToString(tok));
+                exit(1);
+            }
+            name = tok.value.str_value;
+        }
+
+        SymbolFuncArg_t *argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+        argument->arg_name = strdup(name);
         argument->arg_type = type;
         LList_SymbolFuncArg_append(args_list, argument);
 
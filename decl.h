@@ -4,10 +4,20 @@
 #include "ast.h"
 #include "scanner.h"
 
+#include <stdbool.h>
+
 #define DECL_NO_FUNC -1
 
 ASTNode_t *decl_declarations(Scanner_t *scanner);
+ASTNode_t *decl_declarations_parallel(Scanner_t *scanner, size_t jobs);
+ASTNode_t *decl_declaration(Scanner_t *scanner);
+// Releases the nodes of a top-level declaration once its code is generated,
+// the symbols it added are kept
+void decl_free(ASTNode_t *decl);
 ASTNode_t *decl_var(Scanner_t *scanner);
+// Parses `enum [tag] { ... };` when it comes next and adds its enumerators,
+// returns false without consuming anything otherwise
+bool decl_enum(Scanner_t *scanner);
 
 // TODO: Move this to utils/common
 ASTNode_t *args(Scanner_t *scanner);
@@ -17,11 +17,47 @@
 #include "symtab.h"
 #include "datatype.h"
 #include "decl.h"
+#include "consteval.h"
 #include "llist_definitions.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+// Atomic builtins, the `_explicit` variants take the memory orders
+static const struct
+{
+    char *name;
+    AtomicOp_e op;
+    int operands; /**< Operands after the pointer. */
+    bool is_explicit;
+} atomic_builtins[] = {
+    {"atomic_load", ATOMIC_LOAD, 0, false},
+    {"atomic_load_explicit", ATOMIC_LOAD, 0, true},
+    {"atomic_store", ATOMIC_STORE, 1, false},
+    {"atomic_store_explicit", ATOMIC_STORE, 1, true},
+    {"atomic_exchange", ATOMIC_EXCHANGE, 1, false},
+    {"atomic_exchange_explicit", ATOMIC_EXCHANGE, 1, true},
+    {"atomic_compare_exchange_strong", ATOMIC_COMPARE_EXCHANGE, 2, false},
+    {"atomic_compare_exchange_strong_explicit", ATOMIC_COMPARE_EXCHANGE, 2, true},
+    {"atomic_fetch_add", ATOMIC_FETCH_ADD, 1, false},
+    {"atomic_fetch_add_explicit", ATOMIC_FETCH_ADD, 1, true},
+    {"atomic_fetch_or", ATOMIC_FETCH_OR, 1, false},
+    {"atomic_fetch_or_explicit", ATOMIC_FETCH_OR, 1, true},
+    {"atomic_thread_fence", ATOMIC_FENCE, 0, true}};
+
+extern _Thread_local int decl_current_func;
+
+static char *memory_orders[] = {
+    [MEMORY_ORDER_RELAXED] = "memory_order_relaxed",
+    [MEMORY_ORDER_CONSUME] = "memory_order_consume",
+    [MEMORY_ORDER_ACQUIRE] = "memory_order_acquire",
+    [MEMORY_ORDER_RELEASE] = "memory_order_release",
+    [MEMORY_ORDER_ACQ_REL] = "memory_order_acq_rel",
+    [MEMORY_ORDER_SEQ_CST] = "memory_order_seq_cst"};
 
 static ASTNode_type_e get_node_type(TokenType_e type);
 
@@ -31,16 +67,22 @@ static ASTNode_t *expr_multiplicative_expression(Scanner_t *scanner);
 static ASTNode_t *expr_lval(Scanner_t *scanner);
 static ASTNode_t *expr_val(Scanner_t *scanner);
 static ASTNode_t *expr_val_intlit(Scanner_t *scanner);
+static ASTNode_t *expr_int_lit(int value);
+static ASTNode_t *expr_sizeof(Scanner_t *scanner);
 static ASTNode_t *expr_val_strlit(Scanner_t *scanner);
+static ASTNode_t *expr_val_floatlit(Scanner_t *scanner);
 static ASTNode_t *expr_val_var(Scanner_t *scanner);
 static ASTNode_t *expr_val_var_index(Scanner_t *scanner);
 static ASTNode_t *expr_dref_ptr(Scanner_t *scanner);
 static ASTNode_t *expr_address_of(Scanner_t *scanner);
 static ASTNode_t *expr_val_expr(Scanner_t *scanner);
 static ASTNode_t *expr_func_call(Scanner_t *scanner);
+static ASTNode_t *expr_call_pointer(Scanner_t *scanner, ASTNode_t *callee);
+static ASTNode_t *expr_atomic(Scanner_t *scanner, int builtin);
 
 ASTNode_t *expr_assignment(Scanner_t *scanner);
 ASTNode_t *expr_expression(Scanner_t *scanner);
+ASTNode_t *expr_init_list(Scanner_t *scanner, Datatype_t *elem_type);
 
 static ASTNode_type_e get_node_type(TokenType_e type)
 {
@@ -54,6 +96,8 @@ static ASTNode_type_e get_node_type(TokenType_e type)
         return AST_MULT;
     case TOK_SLASH:
         return AST_DIV;
+    case TOK_PERCENT:
+        return AST_MOD;
     case TOK_GT:
         return AST_COMP_GT;
     case TOK_GE:
@@ -110,17 +154,25 @@ static ASTNode_t *expr_val(Scanner_t *scanner)
     switch (token.type)
     {
     case TOK_INTLIT:
+    case TOK_UINTLIT:
+    case TOK_LONGLIT:
+    case TOK_ULONGLIT:
         return expr_val_intlit(scanner);
     case TOK_STRLIT:
         return expr_val_strlit(scanner);
+    case TOK_FLOATLIT:
+    case TOK_DOUBLELIT:
+        return expr_val_floatlit(scanner);
     // case TOK_ID:
     //     return expr_val_var(scanner);
     case TOK_LPAREN:
-        return expr_val_expr(scanner);
+        return expr_call_pointer(scanner, expr_val_expr(scanner));
     case TOK_AMPER:
         return expr_address_of(scanner);
+    case TOK_SIZEOF:
+        return expr_sizeof(scanner);
     default:
-        return expr_lval(scanner);
+        return expr_call_pointer(scanner, expr_lval(scanner));
         // debug_print(SEV_ERROR, "[EXPR] Expected a number or id token, got %s", TokToString(token));
         // exit(1);
     }
@@ -134,14 +186,23 @@ static ASTNode_t *expr_val_intlit(Scanner_t *scanner)
     ASTNode_t *node;
     scanner_scan(scanner, &token);
 
-    if (0 <= token.value.int_value && token.value.int_value < 256)
-        datatype = datatype_get_primative_type(DT_CHAR);
-    else if (token.value.int_value >= 256)
-        datatype = datatype_get_primative_type(DT_INT);
-    else
+    // Unsigned literals keep their bits, the node value is read back through
+    // an unsigned type. Small int literals are chars, an 'l' suffix always
+    // makes a long
+    switch (token.type)
     {
-        debug_print(SEV_ERROR, "[EXPR] Signed numbers aren't supported yet!!");
-        exit(1);
+    case TOK_UINTLIT:
+        datatype = token.value.int_value < 256 ? DATATYPE_UCHAR : DATATYPE_UINT;
+        break;
+    case TOK_LONGLIT:
+        datatype = DATATYPE_LONG;
+        break;
+    case TOK_ULONGLIT:
+        datatype = DATATYPE_ULONG;
+        break;
+    default:
+        datatype = token.value.int_value < 256 ? DATATYPE_CHAR : DATATYPE_INT;
+        break;
     }
 
     node = ast_create_leaf_node(AST_INT_LIT, (ASTNodeValue)token.value.int_value);
@@ -149,6 +210,60 @@ static ASTNode_t *expr_val_intlit(Scanner_t *scanner)
     return node;
 }
 
+// Literal of a value known while parsing, typed like an integer literal
+static ASTNode_t *expr_int_lit(int value)
+{
+    ASTNode_t *node = ast_create_leaf_node(AST_INT_LIT, (ASTNodeValue)(long)value);
+    node->expr_type = 0 <= value && value < 256 ? DATATYPE_CHAR : DATATYPE_INT;
+    return node;
+}
+
+// sizeof is folded while parsing, the operand of `sizeof expr` is only parsed
+// for its type and never evaluated
+static ASTNode_t *expr_sizeof(Scanner_t *scanner)
+{
+    Token_t token, next;
+    ASTNode_t *operand;
+    long size;
+
+    scanner_match(scanner, TOK_SIZEOF);
+    scanner_peek(scanner, &token);
+    scanner_peek_at(scanner, &next, 1);
+    if (token.type == TOK_LPAREN && datatype_is_type_start(next.type))
+    {
+        scanner_match(scanner, TOK_LPAREN);
+        size = datatype_size_of(datatype_get_type(scanner));
+        scanner_match(scanner, TOK_RPAREN);
+    }
+    else
+    {
+        operand = expr_val(scanner);
+        size = datatype_size_of(operand->expr_type);
+        ast_free(operand);
+    }
+
+    if (size == 0 || size > INT_MAX)
+    {
+        debug_print(SEV_ERROR, "[EXPR] sizeof of a type without a usable size");
+        exit(1);
+    }
+    return expr_int_lit(size);
+}
+
+long expr_int_constant(Scanner_t *scanner, const char *what)
+{
+    ConstValue_t value;
+    ASTNode_t *expr = expr_comparison_expression(scanner);
+
+    if (!consteval_expr(expr, &value) || value.type != CONST_INT)
+    {
+        debug_print(SEV_ERROR, "[EXPR] Expected an integer constant expression for %s", what);
+        exit(1);
+    }
+    ast_free(expr);
+    return value.num;
+}
+
 static ASTNode_t *expr_val_strlit(Scanner_t *scanner)
 {
     Token_t token;
@@ -160,22 +275,92 @@ static ASTNode_t *expr_val_strlit(Scanner_t *scanner)
     return node;
 }
 
+// The value is kept spelled in hexadecimal, which is exact, float literals
+// are rounded to float first
+static ASTNode_t *expr_val_floatlit(Scanner_t *scanner)
+{
+    Token_t token;
+    ASTNode_t *node;
+    double value;
+    char buffer[64];
+
+    scanner_scan(scanner, &token);
+    value = strtod(token.value.str_value, NULL);
+    if (token.type == TOK_FLOATLIT)
+        value = (float)value;
+    snprintf(buffer, sizeof(buffer), "%a", value);
+
+    node = ast_create_leaf_node(AST_FLOAT_LIT, (ASTNodeValue)strdup(buffer));
+    node->expr_type = token.type == TOK_FLOATLIT ? DATATYPE_FLOAT : DATATYPE_DOUBLE;
+    return node;
+}
+
+static Datatype_t *expr_func_type(int symbol_index)
+{
+    SymbolFunc_t *func = (SymbolFunc_t *)symtab_get_symbol(symbol_index);
+    Datatype_t **param_types = malloc((func->args.size ? func->args.size : 1) * sizeof(Datatype_t *));
+
+    for (size_t i = 0; i < func->args.size; i++)
+        param_types[i] = LList_SymbolFuncArg_get(&func->args, i)->arg_type;
+    return datatype_get_func_type(func->data_type, param_types, func->args.size);
+}
+
 static ASTNode_t *expr_val_var(Scanner_t *scanner)
 {
     Token_t token;
     ASTNode_t *expr;
     scanner_peek(scanner, &token);
 
+    for (size_t i = 0; i < sizeof(atomic_builtins) / sizeof(atomic_builtins[0]); i++)
+    {
+        if (strcmp(token.value.str_value, atomic_builtins[i].name) == 0)
+            return expr_atomic(scanner, i);
+    }
+
+    // Parameters shadow the globals with the same name
+    if (decl_current_func != DECL_NO_FUNC)
+    {
+        LList_t *params = &((SymbolFunc_t *)symtab_get_symbol(decl_current_func))->args;
+        for (size_t i = 0; i < params->size; i++)
+        {
+            SymbolFuncArg_t *param = LList_SymbolFuncArg_get(params, i);
+            if (strcmp(param->arg_name, token.value.str_value) == 0)
+            {
+                scanner_match(scanner, TOK_ID);
+                expr = ast_create_leaf_node(AST_PARAM, (ASTNodeValue)(int)i);
+                expr->expr_type = param->arg_type;
+                return expr;
+            }
+        }
+    }
+
     int var_symbol_index = symtab_find_global_symbol(token.value.str_value);
-    if (var_symbol_index < 0)
+    if (var_symbol_index < 0 || symtab_declared_later(var_symbol_index))
     {
         debug_print(SEV_ERROR, "[EXPR] %s is not defined before", token.value.str_value);
         exit(1);
     }
 
+    // Enumerators are replaced by their value, later stages only see a literal
+    if (symtab_get_symbol(var_symbol_index)->sym_type == SYMBOL_ENUM)
+    {
+        scanner_match(scanner, TOK_ID);
+        return expr_int_lit(symtab_get_symbol(var_symbol_index)->init_value->value.num);
+    }
+
     if (symtab_get_symbol(var_symbol_index)->sym_type == SYMBOL_FUNC)
     {
-        expr = expr_func_call(scanner);
+        while (scanner->buffer_size < 2 && scanner_cache_tok(scanner) != TOK_EOF)
+            ;
+        scanner_peek_at(scanner, &token, 1);
+        if (token.type == TOK_LPAREN)
+            return expr_func_call(scanner);
+
+        // A function used as a value is its address
+        scanner_match(scanner, TOK_ID);
+        expr = ast_create_leaf_node(AST_FUNC_ADDR, (ASTNodeValue)var_symbol_index);
+        expr->expr_type = datatype_get_pointer_of(expr_func_type(var_symbol_index));
+        return expr;
     }
     else
     {
@@ -197,6 +382,11 @@ static ASTNode_t *expr_val_var_index(Scanner_t *scanner)
     scanner_match(scanner, TOK_LBRACKET);
     index = expr_comparison_expression(scanner);
     scanner_match(scanner, TOK_RBRACKET);
+    if (datatype_is_float(index->expr_type))
+    {
+        debug_print(SEV_ERROR, "[EXPR] Array index must be an integer");
+        exit(1);
+    }
 
     dt = datatype_deref_pointer(var->expr_type, 1);
     expr = ast_create_node(
@@ -226,6 +416,10 @@ static ASTNode_t *expr_dref_ptr(Scanner_t *scanner)
     expr = var;
     for (int i = 0; i < dref_level; i++)
     {
+        // A dereferenced function pointer names the function, which is
+        // used as its address again
+        if (datatype_is_func_pointer(expr->expr_type))
+            continue;
         type = datatype_deref_pointer(expr->expr_type, 1);
         expr = ast_create_node(AST_PTRDREF, expr, NULL, (ASTNodeValue)0);
         expr->expr_type = type;
@@ -240,6 +434,13 @@ static ASTNode_t *expr_address_of(Scanner_t *scanner)
 
     scanner_match(scanner, TOK_AMPER);
     var = expr_val_var(scanner);
+    if (var->type == AST_FUNC_ADDR)
+        return var;
+    if (var->type != AST_VAR)
+    {
+        debug_print(SEV_ERROR, "[EXPR] Can only take the address of a variable");
+        exit(1);
+    }
     out = ast_create_node(AST_ADDRESSOF, var, NULL, (ASTNodeValue)0);
     out->expr_type = datatype_get_pointer_of(var->expr_type);
     return out;
@@ -267,7 +468,7 @@ static ASTNode_t *expr_multiplicative_expression(Scanner_t *scanner)
     while (1)
     {
         scanner_peek(scanner, &token);
-        if (token.type == TOK_STAR || token.type == TOK_SLASH)
+        if (token.type == TOK_STAR || token.type == TOK_SLASH || token.type == TOK_PERCENT)
         {
             scanner_scan(scanner, &token);
             type = get_node_type(token.type);
@@ -278,6 +479,11 @@ static ASTNode_t *expr_multiplicative_expression(Scanner_t *scanner)
                 exit(1);
             }
             expr_type = datatype_expr_type(left->expr_type, right->expr_type);
+            if (type == AST_MOD && datatype_is_float(expr_type))
+            {
+                debug_print(SEV_ERROR, "[EXPR] The operands of %% must be integers");
+                exit(1);
+            }
             left = ast_create_node(type, left, right, (ASTNodeValue)0);
             left->expr_type = expr_type;
         }
@@ -378,6 +584,38 @@ static ASTNode_t *expr_comparison_expression(Scanner_t *scanner)
         return left;
 }
 
+// The kernel of parallel_for is called with the index of each iteration
+static void expr_check_parallel_kernel(ASTNode_t *fn)
+{
+    LList_t *params;
+    Datatype_t *type;
+
+    if (fn->type != AST_FUNC_ADDR)
+    {
+        debug_print(SEV_ERROR, "[EXPR] parallel_for expects the name of a function");
+        exit(1);
+    }
+    params = &((SymbolFunc_t *)symtab_get_symbol(fn->value.num))->args;
+    type = params->size == 1 ? LList_SymbolFuncArg_get(params, 0)->arg_type : NULL;
+    if (type == NULL || type->pointer_level > 0 || type->array_size > 0 || type->size == 0 || type->is_float)
+    {
+        debug_print(
+            SEV_ERROR,
+            "[EXPR] %s must take a single integer parameter to be run by parallel_for",
+            symtab_get_symbol(fn->value.num)->sym_name);
+        exit(1);
+    }
+    // Scalar locals are static, every thread running the kernel would share them
+    if (symtab_mark_parallel_kernel(fn->value.num))
+    {
+        debug_print(
+            SEV_ERROR,
+            "[EXPR] %s declares scalar locals, which parallel_for threads would share",
+            symtab_get_symbol(fn->value.num)->sym_name);
+        exit(1);
+    }
+}
+
 static ASTNode_t *expr_func_call(Scanner_t *scanner)
 {
     Token_t tok;
@@ -387,7 +625,7 @@ static ASTNode_t *expr_func_call(Scanner_t *scanner)
 
     scanner_scan(scanner, &tok);
     symbol_index = symtab_find_global_symbol(tok.value.str_value);
-    if (symbol_index == -1)
+    if (symbol_index == -1 || symtab_declared_later(symbol_index))
     {
         debug_print(
             SEV_ERROR,
@@ -425,10 +663,15 @@ static ASTNode_t *expr_func_call(Scanner_t *scanner)
     for (ASTNode_t *actual_arg = func_args; actual_arg; actual_arg = actual_arg->next)
     {
         SymbolFuncArg_t *formal_arg = LList_SymbolFuncArg_get(&((SymbolFunc_t *)func_symbol)->args, counter);
-        datatype_check_assign_expr_type(formal_arg->arg_type, actual_arg->expr_type);
+        datatype_check_assign_expr_type(formal_arg->arg_type, actual_arg);
+        if (datatype_is_func_pointer(formal_arg->arg_type))
+            symtab_vote_call_target(&formal_arg->targets, actual_arg);
         counter++;
     }
 
+    if (strcmp(func_symbol->sym_name, "parallel_for") == 0)
+        expr_check_parallel_kernel(func_args->next->next);
+
     func_call = ast_create_node(
         AST_FUNC_CALL,
         func_args,
@@ -438,6 +681,147 @@ static ASTNode_t *expr_func_call(Scanner_t *scanner)
     return func_call;
 }
 
+// A function pointer followed by arguments is called through
+static ASTNode_t *expr_call_pointer(Scanner_t *scanner, ASTNode_t *callee)
+{
+    Token_t tok;
+    Datatype_t *func;
+    ASTNode_t *call_args;
+    ASTNode_t *call;
+    size_t i = 0;
+
+    scanner_peek(scanner, &tok);
+    if (tok.type != TOK_LPAREN || !datatype_is_func_pointer(callee->expr_type))
+        return callee;
+
+    func = callee->expr_type->base_type;
+    scanner_match(scanner, TOK_LPAREN);
+    call_args = args(scanner);
+    scanner_match(scanner, TOK_RPAREN);
+
+    if (args_count(call_args) != func->param_count)
+    {
+        debug_print(
+            SEV_ERROR,
+            "[EXPR] Expected number of args for a call through %s is %d, found %d",
+            func->name,
+            func->param_count,
+            args_count(call_args));
+        exit(1);
+    }
+    for (ASTNode_t *actual_arg = call_args; actual_arg; actual_arg = actual_arg->next, i++)
+        datatype_check_assign_expr_type(func->param_types[i], actual_arg);
+
+    call = ast_create_node(AST_INDIRECT_CALL, call_args, callee, (ASTNodeValue)0);
+    call->expr_type = func->return_type;
+    return call;
+}
+
+static MemoryOrder_e expr_memory_order(Scanner_t *scanner)
+{
+    Token_t tok;
+
+    scanner_scan(scanner, &tok);
+    for (int i = 0; tok.type == TOK_ID && i <= MEMORY_ORDER_SEQ_CST; i++)
+    {
+        if (strcmp(tok.value.str_value, memory_orders[i]) == 0)
+            return (MemoryOrder_e)i;
+    }
+    debug_print(SEV_ERROR, "[EXPR] Expected a memory order, found %s", TokToString(tok));
+    exit(1);
+}
+
+// Atomics are lowered in place instead of being called, the code generators
+// must not move memory accesses across them
+static ASTNode_t *expr_atomic(Scanner_t *scanner, int builtin)
+{
+    Token_t tok;
+    AtomicOp_e op = atomic_builtins[builtin].op;
+    char *name = atomic_builtins[builtin].name;
+    MemoryOrder_e order = MEMORY_ORDER_SEQ_CST;
+    MemoryOrder_e failure_order = MEMORY_ORDER_SEQ_CST;
+    ASTNode_t *ptr = NULL;
+    ASTNode_t *tail = NULL;
+    ASTNode_t *atomic;
+    Datatype_t *value_type = NULL;
+
+    scanner_scan(scanner, &tok);
+    scanner_match(scanner, TOK_LPAREN);
+
+    if (op != ATOMIC_FENCE)
+    {
+        ptr = tail = expr_expression(scanner);
+        if (ptr->expr_type->pointer_level == 0)
+        {
+            debug_print(SEV_ERROR, "[EXPR] %s expects a pointer to the atomic object", name);
+            exit(1);
+        }
+        if (op != ATOMIC_LOAD && ptr->expr_type->base_type->is_const && ptr->expr_type->pointer_level == 1)
+        {
+            debug_print(SEV_ERROR, "[EXPR] Can't assign to a const value");
+            exit(1);
+        }
+        value_type = datatype_deref_pointer(ptr->expr_type, 1);
+        if (datatype_is_float(value_type))
+        {
+            debug_print(SEV_ERROR, "[EXPR] %s doesn't support floating point objects", name);
+            exit(1);
+        }
+    }
+
+    for (int i = 0; i < atomic_builtins[builtin].operands; i++)
+    {
+        scanner_match(scanner, TOK_COMMA);
+        tail->next = expr_expression(scanner);
+        tail = tail->next;
+
+        // The expected value of a compare-exchange is passed by pointer, it
+        // is updated when the exchange fails
+        if (op == ATOMIC_COMPARE_EXCHANGE && i == 0)
+            datatype_check_assign_expr_type(ptr->expr_type, tail);
+        else
+            datatype_check_assign_expr_type(value_type, tail);
+    }
+
+    if (atomic_builtins[builtin].is_explicit)
+    {
+        if (op != ATOMIC_FENCE)
+            scanner_match(scanner, TOK_COMMA);
+        order = expr_memory_order(scanner);
+        if (op == ATOMIC_COMPARE_EXCHANGE)
+        {
+            scanner_match(scanner, TOK_COMMA);
+            failure_order = expr_memory_order(scanner);
+        }
+    }
+    scanner_match(scanner, TOK_RPAREN);
+
+    if (
+        (op == ATOMIC_LOAD && (order == MEMORY_ORDER_RELEASE || order == MEMORY_ORDER_ACQ_REL)) ||
+        (op == ATOMIC_STORE && order != MEMORY_ORDER_RELAXED && order != MEMORY_ORDER_RELEASE && order != MEMORY_ORDER_SEQ_CST) ||
+        (failure_order == MEMORY_ORDER_RELEASE || failure_order == MEMORY_ORDER_ACQ_REL))
+    {
+        debug_print(SEV_ERROR, "[EXPR] Invalid memory order for %s", name);
+        exit(1);
+    }
+
+    atomic = ast_create_node(AST_ATOMIC, ptr, NULL, (ASTNodeValue)ASTAtomicValue(op, order));
+    switch (op)
+    {
+    case ATOMIC_STORE:
+    case ATOMIC_FENCE:
+        atomic->expr_type = DATATYPE_VOID;
+        break;
+    case ATOMIC_COMPARE_EXCHANGE:
+        atomic->expr_type = DATATYPE_INT;
+        break;
+    default:
+        atomic->expr_type = value_type;
+        break;
+    }
+    return atomic;
+}
+
 ASTNode_t *expr_assignment(Scanner_t *scanner)
 {
     Token_t tok;
@@ -446,6 +830,11 @@ ASTNode_t *expr_assignment(Scanner_t *scanner)
     ASTNode_t *expr;
 
     var = expr_lval(scanner);
+    if (var->expr_type->is_const || var->type == AST_INT_LIT)
+    {
+        debug_print(SEV_ERROR, "[EXPR] Can't assign to a const value");
+        exit(1);
+    }
     scanner_match(scanner, TOK_ASSIGN);
     val = expr_expression(scanner);
 
@@ -454,11 +843,49 @@ ASTNode_t *expr_assignment(Scanner_t *scanner)
         var,
         val,
         (ASTNodeValue)0);
-    datatype_check_assign_expr_type(var->expr_type, val->expr_type);
+    datatype_check_assign_expr_type(var->expr_type, val);
     expr->expr_type = var->expr_type;
+
+    // Stores to function pointer variables and arrays pick the target
+    // guessed for the calls through them
+    if (datatype_is_func_pointer(var->expr_type) && var->type == AST_VAR)
+        symtab_vote_call_target(&symtab_get_symbol(var->value.num)->targets, val);
+    else if (datatype_is_func_pointer(var->expr_type) && var->type == AST_ARRAY_INDEX && var->left->type == AST_VAR)
+        symtab_vote_call_target(&symtab_get_symbol(var->left->value.num)->targets, val);
     return expr;
 }
 
+ASTNode_t *expr_init_list(Scanner_t *scanner, Datatype_t *elem_type)
+{
+    Token_t tok;
+    ASTNode_t *elems = NULL;
+    ASTNode_t *tail = NULL;
+    ASTNode_t *elem;
+
+    scanner_match(scanner, TOK_LBRACE);
+    scanner_peek(scanner, &tok);
+    while (tok.type != TOK_RBRACE)
+    {
+        elem = expr_comparison_expression(scanner);
+        datatype_check_assign_expr_type(elem_type, elem);
+
+        if (elems == NULL)
+            elems = elem;
+        else
+            tail->next = elem;
+        tail = elem;
+
+        scanner_peek(scanner, &tok);
+        if (tok.type != TOK_COMMA)
+            break;
+        scanner_scan(scanner, &tok);
+        scanner_peek(scanner, &tok);
+    }
+    scanner_match(scanner, TOK_RBRACE);
+
+    return ast_create_node(AST_INIT_LIST, elems, NULL, (ASTNodeValue)0);
+}
+
 ASTNode_t *expr_expression(Scanner_t *scanner)
 {
     Token_t tok;
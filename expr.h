@@ -7,5 +7,8 @@
 
 ASTNode_t *expr_expression(Scanner_t *scanner);
 ASTNode_t *expr_assignment(Scanner_t *scanner);
+ASTNode_t *expr_init_list(Scanner_t *scanner, Datatype_t *elem_type);
+// Parses an expression that must fold to an integer, `what` names it in the error
+long expr_int_constant(Scanner_t *scanner, const char *what);
 
 #endif
@@ -0,0 +1,129 @@
+/**
+ * @file arena.c
+ * @brief Runtime of the arena builtins, a bump allocator over mmap.
+ *
+ * An arena hands out memory by bumping a pointer through large blocks mapped
+ * with mmap, nothing is freed one object at a time. arena_reset() releases
+ * every object at once and keeps the first block for the next round. The
+ * compiler inlines the bump of arena_alloc(), this file is only called when
+ * the current block is full.
+ *
+ * @project ToyCComp
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define ARENA_HUGE_PAGE (2 * 1024 * 1024)
+#define ARENA_MIN_BLOCK (64 * 1024)
+
+typedef struct ArenaBlock_t ArenaBlock_t;
+struct ArenaBlock_t
+{
+    ArenaBlock_t *prev;
+    size_t size; /**< Bytes mapped, this header included. */
+};
+
+// The generated code reads next and end at offsets 0 and 8, see
+// asm_arena_alloc()
+typedef struct
+{
+    char *next; /**< First free byte of the current block. */
+    char *end;  /**< End of the current block. */
+    ArenaBlock_t *block;
+    ArenaBlock_t *first;
+    size_t block_size;
+} Arena_t;
+
+// Blocks of at least a huge page are aligned to one and the kernel is asked
+// to back them with huge pages, a bump allocator touches its memory in order
+// so a single TLB entry covers 512 times more of it
+static ArenaBlock_t *map_block(size_t size)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t align = size >= ARENA_HUGE_PAGE ? ARENA_HUGE_PAGE : page;
+    char *start, *aligned;
+    size_t mapped;
+
+    size = (size + align - 1) / align * align;
+    mapped = align > page ? size + align : size;
+    start = mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (start == MAP_FAILED)
+        return NULL;
+
+    aligned = (char *)(((uintptr_t)start + align - 1) / align * align);
+    if (aligned > start)
+        munmap(start, aligned - start);
+    if (aligned + size < start + mapped)
+        munmap(aligned + size, start + mapped - (aligned + size));
+#ifdef MADV_HUGEPAGE
+    if (align > page)
+        madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+
+    ((ArenaBlock_t *)aligned)->prev = NULL;
+    ((ArenaBlock_t *)aligned)->size = size;
+    return (ArenaBlock_t *)aligned;
+}
+
+static void use_block(Arena_t *arena, ArenaBlock_t *block, char *next)
+{
+    arena->block = block;
+    arena->next = next;
+    arena->end = (char *)block + block->size;
+}
+
+void *arena_new(long capacity)
+{
+    size_t size = capacity > ARENA_MIN_BLOCK ? (size_t)capacity : ARENA_MIN_BLOCK;
+    ArenaBlock_t *block = map_block(size + sizeof(ArenaBlock_t) + sizeof(Arena_t));
+    Arena_t *arena;
+
+    if (block == NULL)
+        return NULL;
+    arena = (Arena_t *)(block + 1);
+    arena->first = block;
+    arena->block_size = size;
+    use_block(arena, block, (char *)(arena + 1));
+    return arena;
+}
+
+void *arena_alloc(Arena_t *arena, long size, long align)
+{
+    uintptr_t start;
+    ArenaBlock_t *block;
+
+    if (align < 1)
+        align = 1;
+    start = ((uintptr_t)arena->next + align - 1) / align * align;
+    if (start + size <= (uintptr_t)arena->end)
+    {
+        arena->next = (char *)start + size;
+        return (void *)start;
+    }
+
+    // Objects bigger than a block get a block of their own
+    block = map_block((size_t)size + align + sizeof(ArenaBlock_t) > arena->block_size
+                          ? (size_t)size + align + sizeof(ArenaBlock_t)
+                          : arena->block_size);
+    if (block == NULL)
+        return NULL;
+    block->prev = arena->block;
+    use_block(arena, block, (char *)(block + 1));
+    return arena_alloc(arena, size, align);
+}
+
+void arena_reset(Arena_t *arena)
+{
+    ArenaBlock_t *block = arena->block;
+
+    while (block != arena->first)
+    {
+        ArenaBlock_t *prev = block->prev;
+        munmap(block, block->size);
+        block = prev;
+    }
+    use_block(arena, arena->first, (char *)(arena + 1));
+}
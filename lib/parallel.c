@@ -0,0 +1,200 @@
+/**
+ * @file parallel.c
+ * @brief Runtime of the parallel_for builtin, a work-stealing thread pool.
+ *
+ * The iterations are split evenly between the threads, every thread takes
+ * small chunks from the front of its own range and, once it is empty, steals
+ * the back half of the range of another thread. The threads are started on
+ * the first call and wait for the next loop between calls.
+ *
+ * @project ToyCComp
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define PARALLEL_MAX_THREADS 64
+#define PARALLEL_CHUNKS_PER_THREAD 8 /**< Chunks a range is taken in, for the balancing. */
+#define PARALLEL_CACHE_LINE 64
+
+typedef void (*Kernel_t)(long);
+
+// Iterations [next, end) left to a thread, the owner takes from the front and
+// thieves from the back. Each range has its own cache line so that taking a
+// chunk doesn't invalidate the ranges of the other threads
+typedef struct
+{
+    pthread_mutex_t lock;
+    long next;
+    long end;
+} __attribute__((aligned(PARALLEL_CACHE_LINE))) Range_t;
+
+static Range_t ranges[PARALLEL_MAX_THREADS];
+static int thread_count = 1;
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+// Guards the loop the workers are running, a new generation starts a loop
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_ready = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t work_done = PTHREAD_COND_INITIALIZER;
+static unsigned long generation = 0;
+static int busy_workers = 0;
+static Kernel_t kernel;
+static long chunk;
+
+// The pool runs one loop at a time, the other ones run on their own thread
+static pthread_mutex_t loop_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local int in_loop = 0;
+
+static int steal(int self)
+{
+    for (int i = 1; i < thread_count; i++)
+    {
+        Range_t *victim = &ranges[(self + i) % thread_count];
+        long lo, hi;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->end - victim->next < 2)
+        {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+        hi = victim->end;
+        lo = victim->next + (hi - victim->next) / 2;
+        victim->end = lo;
+        pthread_mutex_unlock(&victim->lock);
+
+        pthread_mutex_lock(&ranges[self].lock);
+        ranges[self].next = lo;
+        ranges[self].end = hi;
+        pthread_mutex_unlock(&ranges[self].lock);
+        return 1;
+    }
+    return 0;
+}
+
+// Only the owner adds iterations to its range, a thread is done once its
+// range is empty and there is nothing left to steal
+static int take_chunk(int self, long *lo, long *hi)
+{
+    Range_t *range = &ranges[self];
+
+    do
+    {
+        pthread_mutex_lock(&range->lock);
+        if (range->next < range->end)
+        {
+            *lo = range->next;
+            *hi = range->end - range->next > chunk ? range->next + chunk : range->end;
+            range->next = *hi;
+            pthread_mutex_unlock(&range->lock);
+            return 1;
+        }
+        pthread_mutex_unlock(&range->lock);
+    } while (steal(self));
+    return 0;
+}
+
+static void run_ranges(int self)
+{
+    long lo, hi;
+
+    while (take_chunk(self, &lo, &hi))
+    {
+        for (long i = lo; i < hi; i++)
+            kernel(i);
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    int self = (int)(long)arg;
+    unsigned long seen = 0;
+
+    // Loops started by a kernel run sequentially on the worker
+    in_loop = 1;
+    for (;;)
+    {
+        pthread_mutex_lock(&pool_lock);
+        while (generation == seen)
+            pthread_cond_wait(&work_ready, &pool_lock);
+        seen = generation;
+        pthread_mutex_unlock(&pool_lock);
+
+        run_ranges(self);
+
+        pthread_mutex_lock(&pool_lock);
+        if (--busy_workers == 0)
+            pthread_cond_signal(&work_done);
+        pthread_mutex_unlock(&pool_lock);
+    }
+    return NULL;
+}
+
+// One thread per online CPU unless PARALLEL_FOR_THREADS says otherwise, the
+// thread calling parallel_for is the first one
+static void pool_init(void)
+{
+    char *env = getenv("PARALLEL_FOR_THREADS");
+    long count = env != NULL ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_attr_t attr;
+
+    if (count < 1)
+        count = 1;
+    if (count > PARALLEL_MAX_THREADS)
+        count = PARALLEL_MAX_THREADS;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    for (int i = 0; i < PARALLEL_MAX_THREADS; i++)
+        pthread_mutex_init(&ranges[i].lock, NULL);
+    for (thread_count = 1; thread_count < count; thread_count++)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, &attr, worker_main, (void *)(long)thread_count) != 0)
+            break;
+    }
+    pthread_attr_destroy(&attr);
+}
+
+void parallel_for(long lo, long hi, Kernel_t fn)
+{
+    long n = hi - lo;
+
+    if (n <= 0)
+        return;
+    pthread_once(&pool_once, pool_init);
+    if (in_loop || n < thread_count || thread_count == 1 || pthread_mutex_trylock(&loop_lock) != 0)
+    {
+        for (long i = lo; i < hi; i++)
+            fn(i);
+        return;
+    }
+
+    for (int i = 0; i < thread_count; i++)
+    {
+        ranges[i].next = lo + n * i / thread_count;
+        ranges[i].end = lo + n * (i + 1) / thread_count;
+    }
+    chunk = n / ((long)thread_count * PARALLEL_CHUNKS_PER_THREAD);
+    if (chunk < 1)
+        chunk = 1;
+    kernel = fn;
+
+    pthread_mutex_lock(&pool_lock);
+    busy_workers = thread_count - 1;
+    generation++;
+    pthread_cond_broadcast(&work_ready);
+    pthread_mutex_unlock(&pool_lock);
+
+    in_loop = 1;
+    run_ranges(0);
+    in_loop = 0;
+
+    pthread_mutex_lock(&pool_lock);
+    while (busy_workers > 0)
+        pthread_cond_wait(&work_done, &pool_lock);
+    pthread_mutex_unlock(&pool_lock);
+    pthread_mutex_unlock(&loop_lock);
+}
@@ -18,4 +18,9 @@ void print_str(char *i)
 void print_ln(char *i)
 {
     printf("%s\n", i);
-}
\ No newline at end of file
+}
+
+void print_double(double i)
+{
+    printf("%g\n", i);
+}
@@ -1,33 +1,340 @@
 #include "scanner.h"
+#include "preproc.h"
+#include "astfile.h"
+#include "bytecode.h"
 #include "debug.h"
 #include "ast.h"
 #include "decl.h"
 #include "codegen.h"
 #include "symtab.h"
+#include "pipeline.h"
+#include "vm.h"
 
+#include <signal.h>
+#include <spawn.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+static void usage(char *prog)
+{
+    debug_print(
+        SEV_ERROR,
+        "Usage: %s [-a <array_alignment>] [-f nasm | -f gas] [-I <include_dir>] [-j <threads>] [-p | -s] [-i] [-t <tree_output>] [-c] [-o <output> | -o -] [-r] <inputfile>",
+        prog);
+    exit(1);
+}
+
+// NASM reads its input once per pass, so it can't be fed through a pipe,
+// the assembly is written to a file next to the object and removed after
+static void assemble(char *asm_path, char *obj_path)
+{
+    char *args[] = {"nasm", "-f", "elf64", "-o", obj_path, asm_path, NULL};
+    pid_t pid;
+    int status;
+
+    if (posix_spawnp(&pid, args[0], NULL, NULL, args, environ) != 0)
+    {
+        debug_print(SEV_ERROR, "Couldn't run %s", args[0]);
+        unlink(asm_path);
+        exit(1);
+    }
+    waitpid(pid, &status, 0);
+    unlink(asm_path);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        debug_print(SEV_ERROR, "%s failed to assemble %s", args[0], obj_path);
+        exit(1);
+    }
+}
+
+static char *pending_obj_path = NULL;
+static pid_t pending_as_pid;
+
+static void remove_pending_obj(void)
+{
+    if (pending_obj_path == NULL)
+        return;
+    // as may still be writing the object
+    kill(pending_as_pid, SIGKILL);
+    waitpid(pending_as_pid, NULL, 0);
+    unlink(pending_obj_path);
+}
+
+// GNU as reads its input once, so it assembles while the code is being
+// generated. It writes to a temporary object that is only renamed once the
+// compilation succeeded, a failed compilation would hand it partial input
+static CodeGenerator_t *start_gas(char *obj_path, pid_t *pid)
+{
+    posix_spawn_file_actions_t actions;
+    int fds[2];
+    char *args[] = {"as", "--64", "-o", NULL, NULL};
+
+    pending_obj_path = malloc(strlen(obj_path) + 32);
+    sprintf(pending_obj_path, "%s.%d.tmp", obj_path, getpid());
+    args[3] = pending_obj_path;
+    atexit(remove_pending_obj);
+
+    if (pipe(fds) != 0)
+    {
+        debug_print(SEV_ERROR, "Couldn't create a pipe to %s", args[0]);
+        exit(1);
+    }
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[0], STDIN_FILENO);
+    posix_spawn_file_actions_addclose(&actions, fds[0]);
+    posix_spawn_file_actions_addclose(&actions, fds[1]);
+    if (posix_spawnp(pid, args[0], &actions, NULL, args, environ) != 0)
+    {
+        debug_print(SEV_ERROR, "Couldn't run %s", args[0]);
+        exit(1);
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[0]);
+    pending_as_pid = *pid;
+
+    return codegen_init_fd(fds[1], args[0], ASM_SYNTAX_GAS);
+}
+
+static void finish_gas(char *obj_path, pid_t pid)
+{
+    int status;
+
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        unlink(pending_obj_path);
+        pending_obj_path = NULL;
+        debug_print(SEV_ERROR, "as failed to assemble %s", obj_path);
+        exit(1);
+    }
+    if (rename(pending_obj_path, obj_path) != 0)
+    {
+        debug_print(SEV_ERROR, "Couldn't create %s", obj_path);
+        exit(1);
+    }
+    pending_obj_path = NULL;
+}
 
 int main(int argc, char *argv[])
 {
+    size_t array_alignment = CODEGEN_DEFAULT_ARRAY_ALIGNMENT;
+    bool pipelined = false;
+    bool streaming = false;
+    bool assemble_output = false;
+    bool incremental = false;
+    bool run = false;
+    AsmSyntax_e syntax = ASM_SYNTAX_NASM;
+    pid_t as_pid;
+    char *output_path = NULL;
+    char *tree_path = NULL;
+    char *asm_path;
+    size_t jobs = 1;
+    int opt;
+
     init_debugging();
-    if (argc < 2)
+    while ((opt = getopt(argc, argv, "a:cf:iI:j:o:prst:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'a':
+            // Arrays of at least this many bytes are aligned to it, e.g.
+            // 64 to keep lookup tables from straddling cache lines
+            array_alignment = strtoul(optarg, NULL, 10);
+            if (array_alignment == 0 || (array_alignment & (array_alignment - 1)) != 0)
+            {
+                debug_print(SEV_ERROR, "Array alignment must be a power of two");
+                exit(1);
+            }
+            break;
+        case 'c':
+            // Produce an object file instead of assembly
+            assemble_output = true;
+            break;
+        case 'f':
+            // GNU as is a lot faster than NASM on large files
+            if (strcmp(optarg, "nasm") == 0)
+                syntax = ASM_SYNTAX_NASM;
+            else if (strcmp(optarg, "gas") == 0)
+                syntax = ASM_SYNTAX_GAS;
+            else
+                usage(argv[0]);
+            break;
+        case 'i':
+            // Keep the code of every function next to the output and only
+            // generate the functions that changed on the next compilation
+            incremental = true;
+            break;
+        case 'I':
+            preproc_add_include_dir(optarg);
+            break;
+        case 'j':
+            // Large files are split in chunks lexed on this many threads,
+            // then function bodies are parsed on this many threads
+            jobs = strtoul(optarg, NULL, 10);
+            if (jobs == 0)
+            {
+                debug_print(SEV_ERROR, "Number of threads must be positive");
+                exit(1);
+            }
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        case 'p':
+            // Lex, parse and generate code on separate threads
+            pipelined = true;
+            break;
+        case 'r':
+            // Run the program in the bytecode interpreter, nothing is
+            // assembled or linked
+            run = true;
+            break;
+        case 's':
+            // Generate every declaration right after parsing it and release
+            // it, memory stays flat no matter how big the file is
+            streaming = true;
+            break;
+        case 't':
+            // Save the parsed tree, it is compiled later by passing the
+            // file instead of the source
+            tree_path = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (optind >= argc)
+        usage(argv[0]);
+
+    if (run && (pipelined || streaming || incremental || assemble_output || output_path != NULL))
     {
-        debug_print(SEV_ERROR, "Usage: %s <inputfile>", argv[0]);
+        debug_print(SEV_ERROR, "-r runs the program, it can't be combined with -p, -s, -i, -c or -o");
         exit(1);
     }
 
+    if (output_path == NULL)
+        output_path = assemble_output ? "out.o" : "out.s";
+    asm_path = output_path;
+    if (assemble_output && strcmp(output_path, CODEGEN_STDOUT) == 0)
+    {
+        debug_print(SEV_ERROR, "Object files can't be written to the standard output");
+        exit(1);
+    }
+    if (assemble_output && syntax == ASM_SYNTAX_NASM)
+    {
+        asm_path = malloc(strlen(output_path) + 32);
+        sprintf(asm_path, "%s.%d.s", output_path, getpid());
+    }
+
+    if (incremental && strcmp(output_path, CODEGEN_STDOUT) == 0)
+    {
+        debug_print(SEV_ERROR, "Incremental compilation needs an output file");
+        exit(1);
+    }
+
+    if (tree_path != NULL && (pipelined || streaming))
+    {
+        debug_print(SEV_ERROR, "The tree is never complete with -p or -s, it can't be saved");
+        exit(1);
+    }
+
+    // The AST is printed unless the standard output carries the assembly
+    bool print_ast = strcmp(asm_path, CODEGEN_STDOUT) != 0;
+
     symtab_init_global_symtab();
-    Scanner_t *scanner = scanner_init(argv[1]);
-    ASTNode_t *root = decl_declarations(scanner);
-    if (root == NULL)
+    bool from_tree = astfile_probe(argv[optind]);
+    Scanner_t *scanner = NULL;
+    if (!from_tree)
+    {
+        scanner = preproc_init(argv[optind], jobs);
+        if (scanner == NULL)
+            exit(1);
+    }
+
+    if (run)
+    {
+        ASTNode_t *root;
+        if (from_tree)
+        {
+            AstFile_t *tree = astfile_open(argv[optind]);
+            if (tree == NULL)
+                exit(1);
+            root = astfile_load(tree);
+        }
+        else
+        {
+            root = decl_declarations_parallel(scanner, jobs);
+            if (tree_path != NULL && !astfile_write(tree_path, root))
+                exit(1);
+        }
+        // The standard output belongs to the program
+        return vm_run(bytecode_compile(root));
+    }
+
+    CodeGenerator_t *generator;
+    if (assemble_output && syntax == ASM_SYNTAX_GAS)
+        generator = start_gas(output_path, &as_pid);
+    else
+        generator = codegen_init(asm_path, syntax);
+    generator->array_alignment = array_alignment;
+    if (incremental)
+    {
+        char *cache_path = malloc(strlen(output_path) + 8);
+        sprintf(cache_path, "%s.cache", output_path);
+        codegen_enable_cache(generator, cache_path);
+    }
+
+    if (from_tree)
+    {
+        // Parsed by a previous run with -t
+        AstFile_t *tree = astfile_open(argv[optind]);
+        if (tree == NULL)
+            exit(1);
+        ASTNode_t *root = astfile_load(tree);
+        if (print_ast)
+            ast_print(root);
+        codegen_start(generator, root);
+    }
+    else if (pipelined)
+    {
+        pipeline_compile(scanner, generator, print_ast);
+    }
+    else if (streaming)
+    {
+        ASTNode_t *decl;
+        while ((decl = decl_declaration(scanner)) != NULL)
+        {
+            if (print_ast)
+                ast_print(decl);
+            codegen_declaration(generator, decl);
+            decl_free(decl);
+        }
+        codegen_finish(generator);
+    }
+    else
     {
-        debug_print(SEV_ERROR, "Couldn't create root node");
+        ASTNode_t *root = decl_declarations_parallel(scanner, jobs);
+        if (root == NULL)
+        {
+            debug_print(SEV_ERROR, "Couldn't create root node");
+        }
+        if (tree_path != NULL && !astfile_write(tree_path, root))
+            exit(1);
+        if (print_ast)
+            ast_print(root);
+        codegen_start(generator, root);
     }
-    ast_print(root);
 
-    CodeGenerator_t *generator = codegen_init("out.s");
-    codegen_start(generator, root);
+    if (assemble_output && syntax == ASM_SYNTAX_GAS)
+        finish_gas(output_path, as_pid);
+    else if (assemble_output)
+        assemble(asm_path, output_path);
 
     return 0;
 }
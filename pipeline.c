@@ -0,0 +1,78 @@
+/**
+ * @file pipeline.c
+ * @brief Pipelined compilation driver.
+ *
+ * Runs the lexer, the parser and the code generator concurrently, connected
+ * by single-producer/single-consumer queues.
+ *
+ * @project ToyCComp
+ */
+
+#include "pipeline.h"
+#include "debug.h"
+#include "decl.h"
+#include "ringbuf.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    Scanner_t *scanner;
+    RingBuffer_t *tokens;
+    RingBuffer_t *decls;
+} PipelineContext_t;
+
+static void *lexer_thread(void *arg)
+{
+    PipelineContext_t *ctx = (PipelineContext_t *)arg;
+    scanner_lex_to_queue(ctx->scanner, ctx->tokens);
+    return NULL;
+}
+
+static void *parser_thread(void *arg)
+{
+    PipelineContext_t *ctx = (PipelineContext_t *)arg;
+    Scanner_t *scanner = scanner_init_from_queue(ctx->tokens);
+    ASTNode_t *decl;
+
+    while ((decl = decl_declaration(scanner)) != NULL)
+        ringbuf_push(ctx->decls, decl);
+
+    // NULL tells the code generator there are no more declarations
+    ringbuf_push(ctx->decls, NULL);
+    return NULL;
+}
+
+void pipeline_compile(Scanner_t *scanner, CodeGenerator_t *gen, bool print_ast)
+{
+    RingBuffer_t tokens, decls;
+    PipelineContext_t ctx = {scanner, &tokens, &decls};
+    pthread_t lexer, parser;
+    ASTNode_t *decl;
+
+    ringbuf_init(&tokens, PIPELINE_TOKEN_QUEUE_SIZE);
+    ringbuf_init(&decls, PIPELINE_DECL_QUEUE_SIZE);
+
+    if (
+        pthread_create(&lexer, NULL, lexer_thread, &ctx) != 0 ||
+        pthread_create(&parser, NULL, parser_thread, &ctx) != 0)
+    {
+        debug_print(SEV_ERROR, "[PIPELINE] Couldn't start the compilation threads");
+        exit(1);
+    }
+
+    while ((decl = ringbuf_pop(&decls)) != NULL)
+    {
+        if (print_ast)
+            ast_print(decl);
+        codegen_declaration(gen, decl);
+        decl_free(decl);
+    }
+    codegen_finish(gen);
+
+    pthread_join(parser, NULL);
+    pthread_join(lexer, NULL);
+    ringbuf_free(&tokens);
+    ringbuf_free(&decls);
+}
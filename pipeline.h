@@ -0,0 +1,30 @@
+#ifndef _PIPELINE_H_
+#define _PIPELINE_H_
+
+#include "codegen.h"
+#include "scanner.h"
+
+#include <stdbool.h>
+
+#define PIPELINE_TOKEN_QUEUE_SIZE 64
+#define PIPELINE_DECL_QUEUE_SIZE 64
+
+/**
+ * @brief Compiles a file with lexing, parsing and code generation overlapped.
+ *
+ * The lexer runs on its own thread and hands blocks of tokens to the parser
+ * thread, which hands every top-level declaration to the code generator
+ * running on the calling thread as soon as it is parsed. Both hand-offs go
+ * through lock-free single-producer/single-consumer ring buffers.
+ *
+ * The symbols a declaration refers to are all added before the declaration
+ * is queued, so the code generator only reads symbols the parser is done with.
+ * Function bodies are released as soon as their code is generated.
+ *
+ * @param scanner Pointer to the scanner of the input file.
+ * @param gen Pointer to the code generator context.
+ * @param print_ast Prints the AST of every declaration before generating it.
+ */
+void pipeline_compile(Scanner_t *scanner, CodeGenerator_t *gen, bool print_ast);
+
+#endif // _PIPELINE_H_
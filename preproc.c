@@ -0,0 +1,682 @@
+/**
+ * @file preproc.c
+ * @brief Preprocessor working on the tokens produced by the scanner.
+ *
+ * Files are lexed into token arrays that are kept for the whole process.
+ * Directives are read from those arrays and macros are expanded by pushing
+ * the tokens of their body on a stack of token arrays read by the parser.
+ *
+ * @project ToyCComp
+ */
+
+#include "preproc.h"
+#include "debug.h"
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PREPROC_READ_SIZE 65536
+
+typedef struct PPMacro PPMacro_t;
+struct PPMacro
+{
+    char *name;
+    bool function_like;
+    char **params;
+    size_t param_count;
+    Token_t *body;
+    size_t body_count;
+    bool expanding; /**< Set while the expansion is being read, it isn't expanded again. */
+    PPMacro_t *next;
+};
+
+typedef struct PPFile PPFile_t;
+struct PPFile
+{
+    char *path; /**< Canonical path of the file. */
+    Token_t *tokens;
+    size_t count;
+    char *guard; /**< Macro guarding the whole file, NULL if there is none. */
+    bool once;   /**< The file has `#pragma once`. */
+    PPFile_t *next;
+};
+
+typedef struct
+{
+    Token_t *tokens;
+    size_t count;
+    size_t pos;
+    PPMacro_t *macro; /**< Macro expanded by this frame, NULL for files and arguments. */
+    PPFile_t *file;   /**< File read by this frame, directives are only read from files. */
+    size_t cond_base; /**< Depth of the conditional stack when the file was entered. */
+} PPFrame_t;
+
+typedef struct
+{
+    bool active;     /**< Tokens are kept. */
+    bool taken;      /**< A branch of this conditional was already kept. */
+    bool seen_else;
+} PPCond_t;
+
+typedef struct
+{
+    PPMacro_t *macros[PREPROC_MACRO_BUCKETS];
+    PPFrame_t *frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    PPCond_t *conds;
+    size_t cond_count;
+    size_t cond_capacity;
+    PPFile_t **included;
+    size_t included_count;
+    Token_t pushback;
+    bool has_pushback;
+    Token_t *out;
+    size_t out_count;
+    size_t out_capacity;
+} PP_t;
+
+// Lexed files are shared by every compilation of the process
+static PPFile_t *files[PREPROC_FILE_BUCKETS];
+static pthread_mutex_t files_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static char **include_dirs = NULL;
+static size_t include_dirs_count = 0;
+
+static void expand(PP_t *pp, size_t stop_depth, Token_t **out, size_t *out_count, size_t *out_capacity);
+
+static __uint32_t name_hash(const char *name)
+{
+    // FNV-1a
+    __uint32_t hash = 2166136261u;
+    for (; *name; name++)
+    {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void append_token(Token_t **tokens, size_t *count, size_t *capacity, Token_t *tok)
+{
+    if (*count == *capacity)
+    {
+        *capacity = *capacity ? *capacity * 2 : 64;
+        *tokens = realloc(*tokens, *capacity * sizeof(Token_t));
+    }
+    scanner_copy_tok(&(*tokens)[(*count)++], tok);
+}
+
+static bool has_directives(char *file_path)
+{
+    char *buffer = malloc(PREPROC_READ_SIZE);
+    FILE *file = fopen(file_path, "r");
+    bool found = false;
+    size_t len;
+
+    if (file == NULL)
+    {
+        free(buffer);
+        return false;
+    }
+    while (!found && (len = fread(buffer, 1, PREPROC_READ_SIZE, file)) > 0)
+        found = memchr(buffer, '#', len) != NULL;
+    fclose(file);
+    free(buffer);
+    return found;
+}
+
+// A directive is a '#' starting a line, it ends with the line
+static bool is_directive(Token_t *tokens, size_t pos)
+{
+    return tokens[pos].type == TOK_HASH && (pos == 0 || tokens[pos - 1].row != tokens[pos].row);
+}
+
+static size_t line_end(Token_t *tokens, size_t count, size_t pos)
+{
+    size_t end = pos + 1;
+    while (end < count && tokens[end].row == tokens[pos].row)
+        end++;
+    return end;
+}
+
+static char *directive_name(Token_t *tok)
+{
+    // `if` and `else` are keywords for the scanner
+    if (tok->type == TOK_IF)
+        return "if";
+    if (tok->type == TOK_ELSE)
+        return "else";
+    if (tok->type == TOK_ID)
+        return tok->value.str_value;
+    return "";
+}
+
+static bool is_word(Token_t *tok, char *word)
+{
+    return tok->type == TOK_ID && strcmp(tok->value.str_value, word) == 0;
+}
+
+static bool is_conditional(char *name)
+{
+    return strcmp(name, "if") == 0 || strcmp(name, "ifdef") == 0 || strcmp(name, "ifndef") == 0;
+}
+
+// Finds `#ifndef X` / `#define X` opening the file with the matching
+// `#endif` closing it, and `#pragma once`
+static void detect_guard(PPFile_t *file)
+{
+    Token_t *t = file->tokens;
+    size_t count = file->count;
+    size_t depth = 0;
+    size_t end;
+
+    for (size_t pos = 0; pos < count; pos = end)
+    {
+        end = line_end(t, count, pos);
+        if (!is_directive(t, pos) || end - pos < 2)
+            continue;
+        if (is_word(&t[pos + 1], "pragma") && end - pos == 3 && is_word(&t[pos + 2], "once"))
+            file->once = true;
+    }
+
+    if (
+        count < 6 ||
+        line_end(t, count, 0) != 3 || !is_directive(t, 0) || !is_word(&t[1], "ifndef") || t[2].type != TOK_ID ||
+        line_end(t, count, 3) != 6 || !is_directive(t, 3) || !is_word(&t[4], "define") ||
+        !is_word(&t[5], t[2].value.str_value))
+        return;
+
+    for (size_t pos = 0; pos < count; pos = end)
+    {
+        end = line_end(t, count, pos);
+        if (!is_directive(t, pos) || end - pos < 2)
+            continue;
+        if (is_conditional(directive_name(&t[pos + 1])))
+            depth++;
+        else if (is_word(&t[pos + 1], "endif") && --depth == 0)
+        {
+            if (end == count)
+                file->guard = t[2].value.str_value;
+            return;
+        }
+    }
+}
+
+static PPFile_t *load_file(char *path, size_t jobs)
+{
+    char *canonical = realpath(path, NULL);
+    PPFile_t *file;
+
+    if (canonical == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&files_lock);
+    PPFile_t **bucket = &files[name_hash(canonical) % PREPROC_FILE_BUCKETS];
+    for (file = *bucket; file != NULL; file = file->next)
+    {
+        if (strcmp(file->path, canonical) == 0)
+        {
+            pthread_mutex_unlock(&files_lock);
+            free(canonical);
+            return file;
+        }
+    }
+
+    file = calloc(1, sizeof(PPFile_t));
+    file->path = canonical;
+    file->tokens = scanner_lex_file(canonical, jobs, &file->count);
+    if (file->tokens == NULL)
+    {
+        pthread_mutex_unlock(&files_lock);
+        free(canonical);
+        free(file);
+        return NULL;
+    }
+    detect_guard(file);
+    file->next = *bucket;
+    *bucket = file;
+    pthread_mutex_unlock(&files_lock);
+    return file;
+}
+
+static PPMacro_t **find_macro_slot(PP_t *pp, char *name)
+{
+    PPMacro_t **slot = &pp->macros[name_hash(name) % PREPROC_MACRO_BUCKETS];
+    while (*slot != NULL && strcmp((*slot)->name, name) != 0)
+        slot = &(*slot)->next;
+    return slot;
+}
+
+static PPMacro_t *find_macro(PP_t *pp, char *name)
+{
+    return *find_macro_slot(pp, name);
+}
+
+static void push_frame(PP_t *pp, Token_t *tokens, size_t count, PPMacro_t *macro, PPFile_t *file)
+{
+    if (pp->frame_count == pp->frame_capacity)
+    {
+        pp->frame_capacity = pp->frame_capacity ? pp->frame_capacity * 2 : 16;
+        pp->frames = realloc(pp->frames, pp->frame_capacity * sizeof(PPFrame_t));
+    }
+    PPFrame_t *frame = &pp->frames[pp->frame_count++];
+    frame->tokens = tokens;
+    frame->count = count;
+    frame->pos = 0;
+    frame->macro = macro;
+    frame->file = file;
+    frame->cond_base = pp->cond_count;
+    if (macro != NULL)
+        macro->expanding = true;
+}
+
+static void pop_frame(PP_t *pp)
+{
+    PPFrame_t *frame = &pp->frames[--pp->frame_count];
+
+    if (frame->file != NULL && pp->cond_count != frame->cond_base)
+    {
+        debug_print(SEV_ERROR, "[PREPROC] Missing #endif at the end of %s", frame->file->path);
+        exit(1);
+    }
+    // Macro expansions and arguments own their tokens, files are cached
+    if (frame->file == NULL)
+        free(frame->tokens);
+    if (frame->macro != NULL)
+        frame->macro->expanding = false;
+}
+
+static bool cond_active(PP_t *pp)
+{
+    return pp->cond_count == 0 || pp->conds[pp->cond_count - 1].active;
+}
+
+static void push_cond(PP_t *pp, bool value)
+{
+    if (pp->cond_count == pp->cond_capacity)
+    {
+        pp->cond_capacity = pp->cond_capacity ? pp->cond_capacity * 2 : 16;
+        pp->conds = realloc(pp->conds, pp->cond_capacity * sizeof(PPCond_t));
+    }
+    bool parent_active = cond_active(pp);
+    pp->conds[pp->cond_count].active = parent_active && value;
+    pp->conds[pp->cond_count].taken = !parent_active || value;
+    pp->conds[pp->cond_count].seen_else = false;
+    pp->cond_count++;
+}
+
+static void directive_error(Token_t *tok, char *message, char *arg)
+{
+    debug_print(SEV_ERROR, "[PREPROC] Line %u: %s%s", tok->row, message, arg);
+    exit(1);
+}
+
+static void define_macro(PP_t *pp, Token_t *line, size_t len)
+{
+    PPMacro_t *macro = calloc(1, sizeof(PPMacro_t));
+    size_t pos = 3;
+
+    if (len < 3 || line[2].type != TOK_ID)
+        directive_error(&line[0], "Macro names must be identifiers", "");
+    macro->name = line[2].value.str_value;
+
+    // `F(` is a function-like macro, `F (` is an object-like one
+    if (
+        len > 3 && line[3].type == TOK_LPAREN &&
+        line[3].col == line[2].col + strlen(macro->name))
+    {
+        macro->function_like = true;
+        macro->params = malloc(len * sizeof(char *));
+        for (pos = 4; pos < len && line[pos].type != TOK_RPAREN; pos++)
+        {
+            if (line[pos].type != TOK_ID)
+                directive_error(&line[0], "Expected a parameter name in the definition of ", macro->name);
+            macro->params[macro->param_count++] = line[pos].value.str_value;
+            if (pos + 1 < len && line[pos + 1].type == TOK_COMMA)
+                pos++;
+            else if (pos + 1 < len && line[pos + 1].type != TOK_RPAREN)
+                directive_error(&line[0], "Expected ',' or ')' in the definition of ", macro->name);
+        }
+        if (pos == len)
+            directive_error(&line[0], "Missing ')' in the definition of ", macro->name);
+        pos++;
+    }
+
+    macro->body_count = len - pos;
+    macro->body = malloc((macro->body_count ? macro->body_count : 1) * sizeof(Token_t));
+    memcpy(macro->body, &line[pos], macro->body_count * sizeof(Token_t));
+
+    PPMacro_t **slot = find_macro_slot(pp, macro->name);
+    if (*slot != NULL)
+    {
+        debug_print(SEV_DEBUG, "[PREPROC] Redefining %s", macro->name);
+        macro->next = (*slot)->next;
+    }
+    *slot = macro;
+}
+
+static void undef_macro(PP_t *pp, Token_t *line, size_t len)
+{
+    if (len < 3 || line[2].type != TOK_ID)
+        directive_error(&line[0], "Macro names must be identifiers", "");
+    PPMacro_t **slot = find_macro_slot(pp, line[2].value.str_value);
+    if (*slot != NULL)
+        *slot = (*slot)->next;
+}
+
+static bool was_included(PP_t *pp, PPFile_t *file)
+{
+    for (size_t i = 0; i < pp->included_count; i++)
+    {
+        if (pp->included[i] == file)
+            return true;
+    }
+    return false;
+}
+
+static PPFile_t *find_include(PPFile_t *from, char *name)
+{
+    char path[PATH_MAX];
+    PPFile_t *file;
+    char *slash = strrchr(from->path, '/');
+
+    // Next to the including file first, then the include directories
+    snprintf(path, sizeof(path), "%.*s/%s", (int)(slash - from->path), from->path, name);
+    if (name[0] == '/')
+        snprintf(path, sizeof(path), "%s", name);
+    if ((file = load_file(path, 1)) != NULL)
+        return file;
+
+    for (size_t i = 0; i < include_dirs_count && name[0] != '/'; i++)
+    {
+        snprintf(path, sizeof(path), "%s/%s", include_dirs[i], name);
+        if ((file = load_file(path, 1)) != NULL)
+            return file;
+    }
+    return NULL;
+}
+
+static void include_file(PP_t *pp, PPFile_t *from, Token_t *line, size_t len)
+{
+    size_t depth = 0;
+    PPFile_t *file;
+
+    if (len != 3 || line[2].type != TOK_STRLIT)
+        directive_error(&line[0], "Expected #include \"file\"", "");
+    file = find_include(from, line[2].value.str_value);
+    if (file == NULL)
+        directive_error(&line[0], "Couldn't find included file ", line[2].value.str_value);
+
+    // Guarded files are skipped without reading their tokens again
+    if ((file->once && was_included(pp, file)) || (file->guard != NULL && find_macro(pp, file->guard) != NULL))
+        return;
+
+    for (size_t i = 0; i < pp->frame_count; i++)
+        depth += pp->frames[i].file != NULL;
+    if (depth >= PREPROC_MAX_INCLUDE_DEPTH)
+        directive_error(&line[0], "Too many nested includes in ", file->path);
+
+    if (!was_included(pp, file))
+    {
+        pp->included = realloc(pp->included, (pp->included_count + 1) * sizeof(PPFile_t *));
+        pp->included[pp->included_count++] = file;
+    }
+    push_frame(pp, file->tokens, file->count, NULL, file);
+}
+
+static void handle_directive(PP_t *pp, PPFrame_t *frame)
+{
+    size_t end = line_end(frame->tokens, frame->count, frame->pos);
+    Token_t *line = &frame->tokens[frame->pos];
+    size_t len = end - frame->pos;
+    PPFile_t *file = frame->file;
+    char *name;
+
+    // The frame may move when an include pushes a new one
+    frame->pos = end;
+    if (len == 1)
+        return;
+    name = directive_name(&line[1]);
+
+    if (strcmp(name, "ifdef") == 0 || strcmp(name, "ifndef") == 0)
+    {
+        if (len != 3 || line[2].type != TOK_ID)
+            directive_error(&line[0], "Expected a macro name after #", name);
+        push_cond(pp, (find_macro(pp, line[2].value.str_value) != NULL) == (name[2] == 'd'));
+    }
+    else if (strcmp(name, "else") == 0)
+    {
+        if (pp->cond_count == pp->frames[pp->frame_count - 1].cond_base)
+            directive_error(&line[0], "#else without #ifdef", "");
+        PPCond_t *cond = &pp->conds[pp->cond_count - 1];
+        if (cond->seen_else)
+            directive_error(&line[0], "Duplicate #else", "");
+        cond->seen_else = true;
+        cond->active = !cond->taken;
+        cond->taken = true;
+    }
+    else if (strcmp(name, "endif") == 0)
+    {
+        if (pp->cond_count == pp->frames[pp->frame_count - 1].cond_base)
+            directive_error(&line[0], "#endif without #ifdef", "");
+        pp->cond_count--;
+    }
+    else if (!cond_active(pp))
+    {
+        // Nested conditionals are still tracked to find the matching #endif
+        if (is_conditional(name))
+            push_cond(pp, false);
+    }
+    else if (strcmp(name, "define") == 0)
+        define_macro(pp, line, len);
+    else if (strcmp(name, "undef") == 0)
+        undef_macro(pp, line, len);
+    else if (strcmp(name, "include") == 0)
+        include_file(pp, file, line, len);
+    else if (strcmp(name, "pragma") == 0)
+    {
+        // `#pragma once` is found when the file is loaded, others are ignored
+    }
+    else
+        directive_error(&line[0], "Unsupported directive #", name);
+}
+
+static bool next_token(PP_t *pp, size_t stop_depth, Token_t *tok)
+{
+    if (pp->has_pushback)
+    {
+        pp->has_pushback = false;
+        scanner_copy_tok(tok, &pp->pushback);
+        return true;
+    }
+
+    while (pp->frame_count > stop_depth)
+    {
+        PPFrame_t *frame = &pp->frames[pp->frame_count - 1];
+        if (frame->pos == frame->count)
+        {
+            pop_frame(pp);
+            continue;
+        }
+        if (frame->file != NULL && is_directive(frame->tokens, frame->pos))
+        {
+            handle_directive(pp, frame);
+            continue;
+        }
+        if (!cond_active(pp))
+        {
+            frame->pos++;
+            continue;
+        }
+        scanner_copy_tok(tok, &frame->tokens[frame->pos++]);
+        return true;
+    }
+    return false;
+}
+
+// Reads the arguments of a function-like macro, the '(' is already read
+static size_t read_args(PP_t *pp, PPMacro_t *macro, Token_t *call, Token_t **args, size_t *counts)
+{
+    size_t capacities[macro->param_count + 1];
+    size_t arg = 0;
+    int depth = 0;
+    Token_t tok;
+
+    memset(capacities, 0, sizeof(capacities));
+    for (size_t i = 0; i <= macro->param_count; i++)
+    {
+        args[i] = NULL;
+        counts[i] = 0;
+    }
+
+    while (true)
+    {
+        if (!next_token(pp, 0, &tok))
+            directive_error(call, "Unterminated call of macro ", macro->name);
+        if (tok.type == TOK_RPAREN && depth == 0)
+            break;
+        if (tok.type == TOK_COMMA && depth == 0)
+        {
+            if (++arg >= macro->param_count)
+                directive_error(call, "Too many arguments for macro ", macro->name);
+            continue;
+        }
+        if (tok.type == TOK_LPAREN)
+            depth++;
+        else if (tok.type == TOK_RPAREN)
+            depth--;
+        append_token(&args[arg], &counts[arg], &capacities[arg], &tok);
+    }
+
+    // `F()` passes no argument at all to a macro without parameters
+    if (arg + 1 != macro->param_count && !(macro->param_count == 0 && counts[0] == 0))
+        directive_error(call, "Wrong number of arguments for macro ", macro->name);
+    return arg + 1;
+}
+
+static void expand_macro(PP_t *pp, PPMacro_t *macro, Token_t *call)
+{
+    Token_t *tokens = NULL;
+    size_t count = 0, capacity = 0;
+    size_t nargs = macro->param_count ? macro->param_count : 1;
+    Token_t *args[nargs];
+    size_t counts[nargs];
+
+    if (macro->function_like)
+    {
+        read_args(pp, macro, call, args, counts);
+
+        // Arguments are fully expanded on their own before being substituted
+        for (size_t i = 0; i < macro->param_count; i++)
+        {
+            Token_t *expanded = NULL;
+            size_t expanded_count = 0, expanded_capacity = 0;
+            size_t depth = pp->frame_count;
+
+            push_frame(pp, args[i], counts[i], NULL, NULL);
+            expand(pp, depth, &expanded, &expanded_count, &expanded_capacity);
+            args[i] = expanded;
+            counts[i] = expanded_count;
+        }
+    }
+
+    for (size_t i = 0; i < macro->body_count; i++)
+    {
+        Token_t *tok = &macro->body[i];
+        size_t param = macro->param_count;
+
+        if (macro->function_like && tok->type == TOK_ID)
+        {
+            for (param = 0; param < macro->param_count; param++)
+            {
+                if (strcmp(macro->params[param], tok->value.str_value) == 0)
+                    break;
+            }
+        }
+        if (param < macro->param_count)
+        {
+            for (size_t j = 0; j < counts[param]; j++)
+                append_token(&tokens, &count, &capacity, &args[param][j]);
+        }
+        else
+            append_token(&tokens, &count, &capacity, tok);
+    }
+
+    // Expanded tokens are reported at the location of the macro
+    for (size_t i = 0; i < count; i++)
+    {
+        tokens[i].row = call->row;
+        tokens[i].col = call->col;
+    }
+    for (size_t i = 0; macro->function_like && i < macro->param_count; i++)
+        free(args[i]);
+    push_frame(pp, tokens, count, macro, NULL);
+}
+
+static void expand(PP_t *pp, size_t stop_depth, Token_t **out, size_t *out_count, size_t *out_capacity)
+{
+    PPMacro_t *macro;
+    Token_t tok, next;
+
+    while (next_token(pp, stop_depth, &tok))
+    {
+        if (tok.type == TOK_ID && (macro = find_macro(pp, tok.value.str_value)) != NULL && !macro->expanding)
+        {
+            if (!macro->function_like)
+            {
+                expand_macro(pp, macro, &tok);
+                continue;
+            }
+            // A function-like macro name not followed by '(' is kept as is
+            if (next_token(pp, stop_depth, &next))
+            {
+                if (next.type == TOK_LPAREN)
+                {
+                    expand_macro(pp, macro, &tok);
+                    continue;
+                }
+                scanner_copy_tok(&pp->pushback, &next);
+                pp->has_pushback = true;
+            }
+        }
+        append_token(out, out_count, out_capacity, &tok);
+    }
+}
+
+void preproc_add_include_dir(char *dir)
+{
+    include_dirs = realloc(include_dirs, (include_dirs_count + 1) * sizeof(char *));
+    include_dirs[include_dirs_count++] = dir;
+}
+
+Scanner_t *preproc_init(char *file_path, size_t jobs)
+{
+    PP_t *pp;
+    PPFile_t *file;
+
+    if (!has_directives(file_path))
+        return jobs > 1 ? scanner_init_parallel(file_path, jobs) : scanner_init(file_path);
+
+    file = load_file(file_path, jobs);
+    if (file == NULL)
+    {
+        debug_print(SEV_ERROR, "File %s is not found", file_path);
+        return NULL;
+    }
+
+    pp = calloc(1, sizeof(PP_t));
+    pp->included = malloc(sizeof(PPFile_t *));
+    pp->included[pp->included_count++] = file;
+    push_frame(pp, file->tokens, file->count, NULL, file);
+    expand(pp, 0, &pp->out, &pp->out_count, &pp->out_capacity);
+
+    Scanner_t *scanner = scanner_init_from_tokens(pp->out, pp->out_count);
+    free(pp->frames);
+    free(pp->conds);
+    free(pp->included);
+    free(pp);
+    return scanner;
+}
@@ -0,0 +1,47 @@
+#ifndef _PREPROC_H_
+#define _PREPROC_H_
+
+#include "scanner.h"
+
+#define PREPROC_MAX_INCLUDE_DEPTH 64
+#define PREPROC_MACRO_BUCKETS 1024
+#define PREPROC_FILE_BUCKETS 256
+
+/**
+ * @brief Adds a directory searched for `#include "..."` files.
+ *
+ * Included files are first looked up next to the file including them, then
+ * in the directories added here, in order.
+ *
+ * @param dir Path of the directory.
+ */
+void preproc_add_include_dir(char *dir);
+
+/**
+ * @brief Creates a scanner serving the preprocessed tokens of a file.
+ *
+ * Handles `#include "file"`, object-like and function-like `#define`,
+ * `#undef`, `#ifdef`, `#ifndef`, `#else`, `#endif` and `#pragma once`.
+ * Directives must start a line and end with it.
+ *
+ * Macros are expanded on tokens, never on text: a macro is replaced by the
+ * tokens of its body, with the parameters of a function-like macro replaced
+ * by the fully expanded tokens of the arguments. A macro isn't expanded again
+ * inside its own expansion.
+ *
+ * Every file is lexed once per process and its tokens are kept, later
+ * compilations including it again reuse them. A header with an include
+ * guard (`#ifndef X` / `#define X` ... `#endif` around the whole file) or
+ * `#pragma once` is skipped without looking at its tokens when it is
+ * included again.
+ *
+ * Files without any `#` are served by a regular scanner, as if the
+ * preprocessor wasn't there.
+ *
+ * @param file_path Path of the file to compile.
+ * @param jobs Number of threads used to lex the file.
+ * @return The scanner, or NULL if the file is missing.
+ */
+Scanner_t *preproc_init(char *file_path, size_t jobs);
+
+#endif // _PREPROC_H_
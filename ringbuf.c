@@ -0,0 +1,51 @@
+#include "ringbuf.h"
+
+#include <sched.h>
+
+static size_t round_up_pow2(size_t n)
+{
+    size_t out = 1;
+    while (out < n)
+        out <<= 1;
+    return out;
+}
+
+void ringbuf_init(RingBuffer_t *ring, size_t capacity)
+{
+    ring->capacity = round_up_pow2(capacity);
+    ring->slots = calloc(ring->capacity, sizeof(void *));
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+}
+
+// Blocks while the ring is full
+void ringbuf_push(RingBuffer_t *ring, void *item)
+{
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    while (tail - atomic_load_explicit(&ring->head, memory_order_acquire) == ring->capacity)
+        sched_yield();
+
+    ring->slots[tail & (ring->capacity - 1)] = item;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+// Blocks while the ring is empty
+void *ringbuf_pop(RingBuffer_t *ring)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    void *item;
+
+    while (atomic_load_explicit(&ring->tail, memory_order_acquire) == head)
+        sched_yield();
+
+    item = ring->slots[head & (ring->capacity - 1)];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return item;
+}
+
+void ringbuf_free(RingBuffer_t *ring)
+{
+    free(ring->slots);
+    ring->slots = NULL;
+}
@@ -0,0 +1,29 @@
+#ifndef _RINGBUF_H_
+#define _RINGBUF_H_
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#define RINGBUF_CACHE_LINE 64
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring buffer of pointers.
+ *
+ * Exactly one thread may push and exactly one thread may pop. The head and
+ * tail live on separate cache lines so the two threads don't keep stealing
+ * the same line from each other.
+ */
+typedef struct
+{
+    void **slots;
+    size_t capacity; /**< Number of slots, always a power of two. */
+    _Alignas(RINGBUF_CACHE_LINE) atomic_size_t head; /**< Next slot to pop, owned by the consumer. */
+    _Alignas(RINGBUF_CACHE_LINE) atomic_size_t tail; /**< Next slot to push, owned by the producer. */
+} RingBuffer_t;
+
+void ringbuf_init(RingBuffer_t *ring, size_t capacity);
+void ringbuf_push(RingBuffer_t *ring, void *item);
+void *ringbuf_pop(RingBuffer_t *ring);
+void ringbuf_free(RingBuffer_t *ring);
+
+#endif
@@ -4,24 +4,29 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <string.h>
+#include <unistd.h>
 
 static void scanner_putback(Scanner_t *scanner, Token_t *tok);
 
-static int chrpos(char *s, int c)
-{
-    char *p;
-    p = strchr(s, c);
-    return (p ? p - s : -1);
-}
-
 static bool file_exists(const char *filename)
 {
     struct stat buffer;
     return (stat(filename, &buffer) == 0);
 }
 
+static char read_char(Scanner_t *scanner)
+{
+    if (scanner->src != NULL)
+        return scanner->src_pos < scanner->src_len ? scanner->src[scanner->src_pos++] : EOF;
+    return fgetc(scanner->file);
+}
+
 static void skip_ws(Scanner_t *scanner)
 {
     char out;
@@ -34,7 +39,7 @@ static void skip_ws(Scanner_t *scanner)
         }
         else
         {
-            out = fgetc(scanner->file);
+            out = read_char(scanner);
             scanner->current_col_number++;
         }
         if (out == '\n')
@@ -56,34 +61,108 @@ static char next(Scanner_t *scanner)
         scanner->putback_char = 0;
         return out;
     }
-    out = fgetc(scanner->file);
+    out = read_char(scanner);
     scanner->current_col_number++;
 
     return out;
 }
 
-static int scan_number(Scanner_t *scanner)
+static char scan_digits(Scanner_t *scanner, char *buffer, size_t *len)
 {
-    int t;
-    char c;
-    int out = 0;
+    char c = next(scanner);
 
-    while (true)
+    while (isdigit(c))
     {
-        c = next(scanner);
-        t = chrpos("0123456789", c);
-        if (t < 0)
+        if (*len == SCANNER_MAX_NUMBER_LENGTH)
         {
+            debug_print(SEV_ERROR, "[SCANNER] Number literal is too long");
+            exit(1);
+        }
+        buffer[(*len)++] = c;
+        c = next(scanner);
+    }
+    return c;
+}
+
+// A fraction or an exponent makes a double literal, float ones end with 'f'
+static void scan_number(Scanner_t *scanner, Token_t *tok)
+{
+    char buffer[SCANNER_MAX_NUMBER_LENGTH + 1];
+    size_t len = 0;
+    unsigned long out = 0;
+    bool is_unsigned = false;
+    bool is_long = false;
+    char c = scan_digits(scanner, buffer, &len);
+
+    tok->type = TOK_INTLIT;
+    if (c == '.')
+    {
+        tok->type = TOK_DOUBLELIT;
+        buffer[len++] = c;
+        c = scan_digits(scanner, buffer, &len);
+    }
+    if (c == 'e' || c == 'E')
+    {
+        tok->type = TOK_DOUBLELIT;
+        buffer[len++] = c;
+        c = next(scanner);
+        if (c == '+' || c == '-')
+            buffer[len++] = c;
+        else
             scanner->putback_char = c;
-            break;
+        c = scan_digits(scanner, buffer, &len);
+    }
+    if (tok->type == TOK_DOUBLELIT && (c == 'f' || c == 'F'))
+    {
+        tok->type = TOK_FLOATLIT;
+        c = next(scanner);
+    }
+    // 'u' and 'l' in either order, 'll' is the same as 'l'
+    while (tok->type == TOK_INTLIT)
+    {
+        if (!is_unsigned && (c == 'u' || c == 'U'))
+            is_unsigned = true;
+        else if (!is_long && (c == 'l' || c == 'L'))
+        {
+            is_long = true;
+            char l = c;
+            if ((c = next(scanner)) != l)
+                continue;
         }
         else
+            break;
+        c = next(scanner);
+    }
+    scanner->putback_char = c;
+    buffer[len] = '\0';
+
+    if (tok->type == TOK_DOUBLELIT || tok->type == TOK_FLOATLIT)
+    {
+        tok->value.str_value = strdup(buffer);
+        return;
+    }
+    for (size_t i = 0; i < len; i++)
+    {
+        int digit = buffer[i] - '0';
+        if (out > (ULONG_MAX - digit) / 10)
         {
-            out = out * 10 + t;
+            debug_print(SEV_ERROR, "[SCANNER] Integer literal %s is too large", buffer);
+            exit(1);
         }
+        out = out * 10 + digit;
     }
 
-    return out;
+    // The literal gets the first type its suffix allows that can hold it,
+    // like gcc does a decimal literal past LONG_MAX is an unsigned long
+    if (out > LONG_MAX)
+        is_unsigned = is_long = true;
+    else if (out > (is_unsigned ? UINT_MAX : INT_MAX))
+        is_long = true;
+    if (is_long)
+        tok->type = is_unsigned ? TOK_ULONGLIT : TOK_LONGLIT;
+    else if (is_unsigned)
+        tok->type = TOK_UINTLIT;
+    tok->value.int_value = (long)out;
 }
 
 static char scan_char(Scanner_t *scanner)
@@ -131,16 +210,44 @@ static char *scan_str(Scanner_t *scanner)
     next(scanner);
     while (true)
     {
-        i = scan_char(scanner);
+        // Only an unescaped quote ends the literal
+        i = next(scanner);
         if (i == '\"')
             break;
-        buff[index] = i;
+        scanner->putback_char = i;
+        buff[index] = scan_char(scanner);
         index++;
     }
     buff[index] = '\0';
     return buff;
 }
 
+// Returns the single copy of the identifier kept by the scanner, so
+// identifiers repeated all over a file don't allocate every time
+static char *intern_id(Scanner_t *scanner, char *id)
+{
+    // FNV-1a
+    __uint32_t hash = 2166136261u;
+    for (char *c = id; *c; c++)
+    {
+        hash ^= (unsigned char)*c;
+        hash *= 16777619u;
+    }
+
+    ScannerId_t **bucket = &scanner->ids[hash % SCANNER_ID_BUCKETS];
+    for (ScannerId_t *entry = *bucket; entry != NULL; entry = entry->next)
+    {
+        if (strcmp(entry->id, id) == 0)
+            return entry->id;
+    }
+
+    ScannerId_t *entry = malloc(sizeof(ScannerId_t));
+    entry->id = strdup(id);
+    entry->next = *bucket;
+    *bucket = entry;
+    return entry->id;
+}
+
 static char *scan_id(Scanner_t *scanner)
 {
     char c;
@@ -162,7 +269,7 @@ static char *scan_id(Scanner_t *scanner)
             break;
         }
     }
-    return strdup(buffer);
+    return intern_id(scanner, buffer);
 }
 
 static TokenType_e check_keyword(char *id)
@@ -174,13 +281,20 @@ static TokenType_e check_keyword(char *id)
     } keyword_map[] = {
         {"break", TOK_BREAK},
         {"char", TOK_CHAR},
+        {"const", TOK_CONST},
         {"do", TOK_DO},
+        {"double", TOK_DOUBLE},
         {"else", TOK_ELSE},
+        {"enum", TOK_ENUM},
+        {"extern", TOK_EXTERN},
+        {"float", TOK_FLOAT},
         {"for", TOK_FOR},
         {"if", TOK_IF},
         {"int", TOK_INT},
         {"long", TOK_LONG},
         {"return", TOK_RETURN},
+        {"sizeof", TOK_SIZEOF},
+        {"unsigned", TOK_UNSIGNED},
         {"void", TOK_VOID},
         {"while", TOK_WHILE}};
 
@@ -198,14 +312,20 @@ static TokenType_e check_keyword(char *id)
     return TOK_ID;
 }
 
-Scanner_t *scanner_init(char *file_path)
+static Scanner_t *scanner_create(void)
 {
     Scanner_t *scanner = (Scanner_t *)calloc(1, sizeof(Scanner_t));
     scanner->current_line_number = 1;
     scanner->current_col_number = 1;
     scanner->buffer_head = 0;
-    scanner->buffer_tail = 1;
+    scanner->buffer_tail = 0;
     scanner->buffer_size = 0;
+    return scanner;
+}
+
+Scanner_t *scanner_init(char *file_path)
+{
+    Scanner_t *scanner = scanner_create();
 
     if (file_exists(file_path))
     {
@@ -219,18 +339,18 @@ Scanner_t *scanner_init(char *file_path)
     }
 }
 
-static bool __scanner_scan(Scanner_t *scanner, Token_t *tok, bool ignore_cache)
+Scanner_t *scanner_init_from_queue(RingBuffer_t *queue)
 {
-    if (!ignore_cache && scanner->buffer_size > 0)
-    {
-        scanner_copy_tok(tok, &scanner->putback_tok_buffer[scanner->buffer_head]);
-        scanner->buffer_head = (scanner->buffer_head + 1) % MAX_PUTBACK_BUFFER_SIZE;
-        scanner->buffer_size--;
-        debug_print(SEV_DEBUG, "Token %s", TokToString(*tok));
-        return true;
-    }
+    Scanner_t *scanner = scanner_create();
+    scanner->token_queue = queue;
+    return scanner;
+}
 
+static bool lex_token(Scanner_t *scanner, Token_t *tok)
+{
     skip_ws(scanner);
+    tok->row = scanner->current_line_number;
+    tok->col = scanner->current_col_number;
     char t = next(scanner);
     switch (t)
     {
@@ -249,6 +369,9 @@ static bool __scanner_scan(Scanner_t *scanner, Token_t *tok, bool ignore_cache)
     case '/':
         tok->type = TOK_SLASH;
         break;
+    case '%':
+        tok->type = TOK_PERCENT;
+        break;
     case ';':
         tok->type = TOK_SEMICOLON;
         break;
@@ -276,6 +399,9 @@ static bool __scanner_scan(Scanner_t *scanner, Token_t *tok, bool ignore_cache)
     case '&':
         tok->type = TOK_AMPER;
         break;
+    case '#':
+        tok->type = TOK_HASH;
+        break;
     case '>':
         t = next(scanner);
         if (t == '=')
@@ -330,8 +456,7 @@ static bool __scanner_scan(Scanner_t *scanner, Token_t *tok, bool ignore_cache)
         if (isdigit(t))
         {
             scanner->putback_char = t;
-            tok->type = TOK_INTLIT;
-            tok->value.int_value = scan_number(scanner);
+            scan_number(scanner, tok);
         }
         else if (isalpha(t) || t == '_')
         {
@@ -351,10 +476,274 @@ static bool __scanner_scan(Scanner_t *scanner, Token_t *tok, bool ignore_cache)
         }
         break;
     }
-    debug_print(SEV_DEBUG, "Token %s", TokToString(*tok));
     return true;
 }
 
+static bool dequeue_token(Scanner_t *scanner, Token_t *tok)
+{
+    if (scanner->token_block == NULL)
+    {
+        scanner->token_block = ringbuf_pop(scanner->token_queue);
+        scanner->token_block_index = 0;
+    }
+
+    scanner_copy_tok(tok, &scanner->token_block->tokens[scanner->token_block_index]);
+
+    // The last block ends with TOK_EOF, keep returning it once reached
+    if (tok->type == TOK_EOF)
+        return false;
+
+    if (++scanner->token_block_index == scanner->token_block->count)
+    {
+        free(scanner->token_block);
+        scanner->token_block = NULL;
+    }
+    return true;
+}
+
+/**
+ * @brief Creates a scanner serving the given tokens, followed by TOK_EOF.
+ *
+ * The tokens aren't copied, several scanners can serve different ranges of
+ * the same token array at the same time.
+ */
+Scanner_t *scanner_init_from_tokens(Token_t *tokens, size_t count)
+{
+    Scanner_t *scanner = scanner_create();
+    scanner->tokens = tokens;
+    scanner->tokens_count = count;
+    return scanner;
+}
+
+typedef struct
+{
+    Scanner_t scanner;
+    CodeLocation start; /**< Location of the first character of the chunk. */
+    Token_t *tokens;
+    size_t count;
+} LexChunk_t;
+
+static void *lex_chunk(void *arg)
+{
+    LexChunk_t *chunk = (LexChunk_t *)arg;
+    size_t capacity = 1024;
+
+    // Chunks start right after a newline, only the row has to be adjusted
+    chunk->scanner.current_line_number = UnpackRow(chunk->start);
+    chunk->scanner.current_col_number = UnpackCol(chunk->start);
+
+    chunk->tokens = malloc(capacity * sizeof(Token_t));
+    chunk->count = 0;
+    while (true)
+    {
+        if (chunk->count == capacity)
+        {
+            capacity *= 2;
+            chunk->tokens = realloc(chunk->tokens, capacity * sizeof(Token_t));
+        }
+        if (!lex_token(&chunk->scanner, &chunk->tokens[chunk->count]))
+            break;
+        chunk->count++;
+    }
+    return NULL;
+}
+
+// Splits `src` into at most `max_chunks` chunks of roughly equal size. A chunk
+// may only end at a newline that is outside string and char literals, so
+// every chunk can be lexed on its own
+static size_t split_chunks(const char *src, size_t len, LexChunk_t *chunks, size_t max_chunks)
+{
+    size_t target = len / max_chunks;
+    size_t count = 1;
+    __uint32_t row = 1;
+    char quote = 0;
+
+    chunks[0].scanner.src = src;
+    chunks[0].start = PackLocation(1, 1);
+
+    for (size_t i = 0; i < len; i++)
+    {
+        if (quote)
+        {
+            if (src[i] == '\\')
+                i++;
+            else if (src[i] == quote)
+                quote = 0;
+            continue;
+        }
+
+        if (src[i] == '"' || src[i] == '\'')
+            quote = src[i];
+        else if (src[i] == '\n')
+        {
+            row++;
+            if (count < max_chunks && i + 1 >= count * target && i + 1 < len)
+            {
+                chunks[count].scanner.src = src + i + 1;
+                chunks[count].start = PackLocation(row, 1);
+                count++;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const char *end = i + 1 < count ? chunks[i + 1].scanner.src : src + len;
+        chunks[i].scanner.src_len = end - chunks[i].scanner.src;
+    }
+    return count;
+}
+
+/**
+ * @brief Lexes a whole file up front, splitting large files between threads.
+ *
+ * The file is split into chunks of at least SCANNER_MIN_CHUNK_SIZE bytes,
+ * each lexed on its own thread, and the per-chunk tokens are concatenated.
+ * Returns the tokens, without a final TOK_EOF, or NULL if the file is missing.
+ */
+Token_t *scanner_lex_file(char *file_path, size_t jobs, size_t *count)
+{
+    struct stat st;
+    char *src = NULL;
+    int fd;
+
+    fd = open(file_path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        debug_print(SEV_ERROR, "File %s is not found", file_path);
+        return NULL;
+    }
+    if (st.st_size > 0)
+    {
+        src = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (src == MAP_FAILED)
+        {
+            debug_print(SEV_ERROR, "[SCANNER] Couldn't map %s", file_path);
+            exit(1);
+        }
+    }
+    close(fd);
+
+    if (jobs > (size_t)st.st_size / SCANNER_MIN_CHUNK_SIZE)
+        jobs = (size_t)st.st_size / SCANNER_MIN_CHUNK_SIZE;
+    if (jobs == 0)
+        jobs = 1;
+
+    LexChunk_t *chunks = calloc(jobs, sizeof(LexChunk_t));
+    pthread_t *threads = malloc(jobs * sizeof(pthread_t));
+    size_t chunks_count = split_chunks(src, st.st_size, chunks, jobs);
+    size_t tokens_count = 0;
+
+    for (size_t i = 1; i < chunks_count; i++)
+    {
+        if (pthread_create(&threads[i], NULL, lex_chunk, &chunks[i]) != 0)
+        {
+            debug_print(SEV_ERROR, "[SCANNER] Couldn't start a lexer thread");
+            exit(1);
+        }
+    }
+    lex_chunk(&chunks[0]);
+    for (size_t i = 1; i < chunks_count; i++)
+        pthread_join(threads[i], NULL);
+
+    for (size_t i = 0; i < chunks_count; i++)
+        tokens_count += chunks[i].count;
+
+    Token_t *tokens = malloc((tokens_count ? tokens_count : 1) * sizeof(Token_t));
+    tokens_count = 0;
+    for (size_t i = 0; i < chunks_count; i++)
+    {
+        memcpy(&tokens[tokens_count], chunks[i].tokens, chunks[i].count * sizeof(Token_t));
+        tokens_count += chunks[i].count;
+        free(chunks[i].tokens);
+    }
+
+    if (src != NULL)
+        munmap(src, st.st_size);
+    free(threads);
+    free(chunks);
+    *count = tokens_count;
+    return tokens;
+}
+
+/**
+ * @brief Creates a scanner serving the tokens of a file lexed up front with
+ * scanner_lex_file().
+ */
+Scanner_t *scanner_init_parallel(char *file_path, size_t jobs)
+{
+    size_t count;
+    Token_t *tokens = scanner_lex_file(file_path, jobs, &count);
+
+    if (tokens == NULL)
+        return NULL;
+    return scanner_init_from_tokens(tokens, count);
+}
+
+static bool next_array_token(Scanner_t *scanner, Token_t *tok)
+{
+    if (scanner->tokens_index == scanner->tokens_count)
+    {
+        tok->type = TOK_EOF;
+        tok->row = scanner->tokens_count ? scanner->tokens[scanner->tokens_count - 1].row : 1;
+        tok->col = 0;
+        return false;
+    }
+    scanner_copy_tok(tok, &scanner->tokens[scanner->tokens_index++]);
+    return true;
+}
+
+static bool fetch_token(Scanner_t *scanner, Token_t *tok)
+{
+    if (scanner->tokens != NULL)
+        return next_array_token(scanner, tok);
+    if (scanner->token_queue != NULL)
+        return dequeue_token(scanner, tok);
+    return lex_token(scanner, tok);
+}
+
+/**
+ * @brief Lexes the whole file into blocks of tokens pushed to `queue`.
+ *
+ * Meant to run on its own thread while another scanner created with
+ * scanner_init_from_queue() consumes the blocks. The last block pushed ends
+ * with a TOK_EOF token.
+ */
+void scanner_lex_to_queue(Scanner_t *scanner, RingBuffer_t *queue)
+{
+    TokenBlock_t *block = malloc(sizeof(TokenBlock_t));
+    block->count = 0;
+
+    while (fetch_token(scanner, &block->tokens[block->count++]))
+    {
+        if (block->count == TOKEN_BLOCK_SIZE)
+        {
+            ringbuf_push(queue, block);
+            block = malloc(sizeof(TokenBlock_t));
+            block->count = 0;
+        }
+    }
+    ringbuf_push(queue, block);
+}
+
+static bool __scanner_scan(Scanner_t *scanner, Token_t *tok, bool ignore_cache)
+{
+    bool out;
+
+    if (!ignore_cache && scanner->buffer_size > 0)
+    {
+        scanner_copy_tok(tok, &scanner->putback_tok_buffer[scanner->buffer_head]);
+        scanner->buffer_head = (scanner->buffer_head + 1) % scanner->buffer_capacity;
+        scanner->buffer_size--;
+        debug_print(SEV_DEBUG, "Token %s", TokToString(*tok));
+        return true;
+    }
+
+    out = fetch_token(scanner, tok);
+    debug_print(SEV_DEBUG, "Token %s", TokToString(*tok));
+    return out;
+}
+
 bool scanner_scan(Scanner_t *scanner, Token_t *tok)
 {
     return __scanner_scan(scanner, tok, false);
@@ -367,7 +756,7 @@ bool scanner_match(Scanner_t *scanner, TokenType_e what)
     debug_print(
         SEV_DEBUG,
         "line %d: Matching type: %s, found type: %s",
-        scanner->current_line_number,
+        t.row,
         TokTypeToString(what),
         TokToString(t));
     if (t.type == what)
@@ -375,7 +764,7 @@ bool scanner_match(Scanner_t *scanner, TokenType_e what)
     debug_print(
         SEV_ERROR,
         "line %d: Expected token: %s, found token: %s",
-        scanner->current_line_number,
+        t.row,
         TokTypeToString(what),
         TokToString(t));
     exit(1);
@@ -384,8 +773,22 @@ bool scanner_match(Scanner_t *scanner, TokenType_e what)
 
 static void scanner_putback(Scanner_t *scanner, Token_t *tok)
 {
-    scanner_copy_tok(&scanner->putback_tok_buffer[scanner->buffer_tail - 1], tok);
-    scanner->buffer_tail = (scanner->buffer_tail + 1) % MAX_PUTBACK_BUFFER_SIZE;
+    // expr_expression() looks ahead to the end of the statement, so a long
+    // statement can need any number of tokens
+    if (scanner->buffer_size == scanner->buffer_capacity)
+    {
+        int capacity = scanner->buffer_capacity ? scanner->buffer_capacity * 2 : PUTBACK_BUFFER_INITIAL_SIZE;
+        Token_t *buffer = malloc(capacity * sizeof(Token_t));
+        for (int i = 0; i < scanner->buffer_size; i++)
+            scanner_copy_tok(&buffer[i], &scanner->putback_tok_buffer[(scanner->buffer_head + i) % scanner->buffer_capacity]);
+        free(scanner->putback_tok_buffer);
+        scanner->putback_tok_buffer = buffer;
+        scanner->buffer_capacity = capacity;
+        scanner->buffer_head = 0;
+        scanner->buffer_tail = scanner->buffer_size;
+    }
+    scanner_copy_tok(&scanner->putback_tok_buffer[scanner->buffer_tail], tok);
+    scanner->buffer_tail = (scanner->buffer_tail + 1) % scanner->buffer_capacity;
     scanner->buffer_size++;
 }
 
@@ -408,13 +811,15 @@ void scanner_peek_at(Scanner_t *scanner, Token_t *tok, size_t index)
     {
         scanner_cache_tok(scanner);
     }
-    scanner_copy_tok(tok, &scanner->putback_tok_buffer[scanner->buffer_head + index]);
+    scanner_copy_tok(tok, &scanner->putback_tok_buffer[(scanner->buffer_head + index) % scanner->buffer_capacity]);
 }
 
 void scanner_copy_tok(Token_t *dest, Token_t *src)
 {
     dest->type = src->type;
     dest->value = src->value;
+    dest->row = src->row;
+    dest->col = src->col;
 }
 
 TokenType_e scanner_cache_tok(Scanner_t *scanner)
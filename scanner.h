@@ -2,9 +2,16 @@
 #define _SCANNER_H_
 
 #include "stdio.h"
+#include "ringbuf.h"
 #include <stdbool.h>
 
-#define MAX_PUTBACK_BUFFER_SIZE 255
+#define PUTBACK_BUFFER_INITIAL_SIZE 256
+#define TOKEN_BLOCK_SIZE 256
+#define SCANNER_ID_BUCKETS 1024
+#define SCANNER_MAX_NUMBER_LENGTH 64
+#ifndef SCANNER_MIN_CHUNK_SIZE
+#define SCANNER_MIN_CHUNK_SIZE (1 << 20) /**< Smallest chunk worth lexing on its own thread. */
+#endif
 typedef enum
 {
     TOK_EMPTY, /** Empty token, default value. */
@@ -14,6 +21,7 @@ typedef enum
     TOK_MINUS, /** '-' operator. */
     TOK_STAR,  /** '*' operator. */
     TOK_SLASH, /** '/' operator. */
+    TOK_PERCENT, /** '%' operator. */
 
     TOK_GT, /** '>' operator. */
     TOK_GE, /** '>=' operator. */
@@ -27,11 +35,22 @@ typedef enum
     TOK_INTLIT, /** Integer literal. */
     TOK_STRLIT, /** String literal. */
     TOK_ID,     /** Identifier. */
-
-    TOK_INT,  /** 'int' keyword. */
-    TOK_CHAR, /** 'int' keyword. */
-    TOK_VOID, /** 'void' keyword. */
-    TOK_LONG, /** 'void' keyword. */
+    TOK_FLOATLIT,  /** float literal, with an 'f' suffix, spelled in str_value. */
+    TOK_DOUBLELIT, /** double literal, spelled in str_value. */
+    TOK_UINTLIT,   /** Integer literal with a 'u' suffix that fits an unsigned int. */
+    TOK_LONGLIT,   /** Integer literal with an 'l' suffix or too large for an int. */
+    TOK_ULONGLIT,  /** Integer literal with a 'ul' suffix or too large for a long, its bits in int_value. */
+
+    TOK_INT,   /** 'int' keyword. */
+    TOK_CHAR,  /** 'int' keyword. */
+    TOK_VOID,  /** 'void' keyword. */
+    TOK_LONG,  /** 'void' keyword. */
+    TOK_FLOAT,  /** 'float' keyword. */
+    TOK_DOUBLE, /** 'double' keyword. */
+    TOK_UNSIGNED, /** 'unsigned' keyword. */
+    TOK_ENUM,   /** 'enum' keyword. */
+    TOK_CONST,  /** 'const' qualifier. */
+    TOK_EXTERN, /** 'extern' storage class. */
 
     TOK_IF,     /** 'if' keyword. */
     TOK_ELSE,   /** 'else' keyword. */
@@ -40,6 +59,7 @@ typedef enum
     TOK_DO,     /** 'do' keyword. */
     TOK_FOR,    /** 'for'  keyword. */
     TOK_RETURN, /** 'return'  keyword. */
+    TOK_SIZEOF, /** 'sizeof' operator. */
 
     TOK_SEMICOLON, /** ';' token. */
     TOK_COMMA,     /** ',' token. */
@@ -49,7 +69,8 @@ typedef enum
     TOK_RBRACE,    /** '}' token. */
     TOK_LBRACKET,  /** ']' token. */
     TOK_RBRACKET,  /** ']' token. */
-    TOK_ASSIGN     /** '=' assignment operator. */
+    TOK_ASSIGN,    /** '=' assignment operator. */
+    TOK_HASH       /** '#' starting a preprocessor directive. */
 } TokenType_e;
 
 typedef struct
@@ -57,7 +78,7 @@ typedef struct
     TokenType_e type; /** Type of the token. */
     union
     {
-        int int_value;   /** Integer value for numeric literals. */
+        long int_value;  /** Integer value for numeric literals. */
         char *str_value; /** String value for identifiers or keywords. */
     } value;
     __uint32_t row; /** Line number where the token was found. */
@@ -71,6 +92,7 @@ static char *__token_names[] = {
     "TOK_MINUS",
     "TOK_STAR",
     "TOK_SLASH",
+    "TOK_PERCENT",
     "TOK_GT",
     "TOK_GE",
     "TOK_LT",
@@ -81,10 +103,21 @@ static char *__token_names[] = {
     "TOK_INTLIT",
     "TOK_STRLIT",
     "TOK_ID",
+    "TOK_FLOATLIT",
+    "TOK_DOUBLELIT",
+    "TOK_UINTLIT",
+    "TOK_LONGLIT",
+    "TOK_ULONGLIT",
     "TOK_INT",
     "TOK_CHAR",
     "TOK_VOID",
     "TOK_LONG",
+    "TOK_FLOAT",
+    "TOK_DOUBLE",
+    "TOK_UNSIGNED",
+    "TOK_ENUM",
+    "TOK_CONST",
+    "TOK_EXTERN",
     "TOK_IF",
     "TOK_ELSE",
     "TOK_WHILE",
@@ -92,36 +125,74 @@ static char *__token_names[] = {
     "TOK_DO",
     "TOK_FOR",
     "TOK_RETURN",
+    "TOK_SIZEOF",
     "TOK_SEMICOLON",
+    "TOK_COMMA",
     "TOK_LPAREN",
     "TOK_RPAREN",
     "TOK_LBRACE",
     "TOK_RBRACE",
     "TOK_LBRACKET",
     "TOK_RBRACKET",
-    "TOK_ASSIGN"};
+    "TOK_ASSIGN",
+    "TOK_HASH"};
 
 #define TokToString(tok) __token_names[(tok).type]          /** Convert token to string. */
 #define TokTypeToString(tok_type) __token_names[(tok_type)] /** Convert token type to string. */
 
+/**
+ * @brief Batch of tokens handed from the lexer thread to the parser thread.
+ *
+ * Tokens are passed in blocks rather than one by one so the queue is touched
+ * once per TOKEN_BLOCK_SIZE tokens instead of once per token.
+ */
+typedef struct
+{
+    Token_t tokens[TOKEN_BLOCK_SIZE];
+    size_t count;
+} TokenBlock_t;
+
 typedef __uint64_t CodeLocation;
 #define PackLocation(row, col) ((CodeLocation)row << 32) | (__uint32_t)col
 #define UnpackRow(loc) (int)(loc >> 32)
 #define UnpackCol(loc) (int)(loc & 0xFFFFFFFF)
 
+typedef struct ScannerId ScannerId_t;
+struct ScannerId
+{
+    char *id;
+    ScannerId_t *next;
+};
+
 typedef struct
 {
     FILE *file;
-    Token_t putback_tok_buffer[MAX_PUTBACK_BUFFER_SIZE];
+    const char *src;  /**< Source text when lexing from memory instead of `file`. */
+    size_t src_len;
+    size_t src_pos;
+    Token_t *putback_tok_buffer; /**< Ring of looked ahead tokens, grows when a statement needs more lookahead. */
+    int buffer_capacity;
     int buffer_head;
     int buffer_tail;
     int buffer_size;
     char putback_char;
     __uint32_t current_line_number;
     __uint32_t current_col_number;
+    RingBuffer_t *token_queue;  /**< Source of tokens when lexing runs on another thread, NULL otherwise. */
+    TokenBlock_t *token_block;  /**< Block currently being consumed from `token_queue`. */
+    size_t token_block_index;   /**< Next token to consume in `token_block`. */
+    Token_t *tokens;            /**< Pre-lexed tokens, NULL when lexing on demand. */
+    size_t tokens_count;        /**< Number of tokens in `tokens`, TOK_EOF is returned past them. */
+    size_t tokens_index;        /**< Next token to consume in `tokens`. */
+    ScannerId_t *ids[SCANNER_ID_BUCKETS]; /**< Identifiers seen so far, each one is allocated once. */
 } Scanner_t;
 
 Scanner_t *scanner_init(char *file_path);
+Scanner_t *scanner_init_from_queue(RingBuffer_t *queue);
+Scanner_t *scanner_init_parallel(char *file_path, size_t jobs);
+Scanner_t *scanner_init_from_tokens(Token_t *tokens, size_t count);
+Token_t *scanner_lex_file(char *file_path, size_t jobs, size_t *count);
+void scanner_lex_to_queue(Scanner_t *scanner, RingBuffer_t *queue);
 
 void scanner_peek(Scanner_t *scanner, Token_t *tok);
 void scanner_peek_at(Scanner_t *scanner, Token_t *tok, size_t index);
@@ -5,8 +5,9 @@
 #include "symtab.h"
 #include "expr.h"
 
-static bool in_loop = false;
-extern int decl_current_func;
+// Function bodies may be parsed concurrently, so the parser state is per thread
+static _Thread_local bool in_loop = false;
+extern _Thread_local int decl_current_func;
 
 static ASTNode_t *stmt_statements(Scanner_t *scanner);
 static ASTNode_t *stmt_statement(Scanner_t *scanner);
@@ -53,6 +54,7 @@ static ASTNode_t *stmt_statement(Scanner_t *scanner)
     {
 
     // Func calls, assinement statements
+    case TOK_LPAREN:
     case TOK_STAR:
     case TOK_ID:
         return stmt_expression(scanner);
@@ -92,6 +94,8 @@ static ASTNode_t *stmt_print(Scanner_t *scanner)
 
 static ASTNode_t *stmt_var_decl(Scanner_t *scanner)
 {
+    if (decl_enum(scanner))
+        return ast_create_leaf_node(AST_EMPTY, (ASTNodeValue)0);
     return decl_var(scanner);
 }
 
@@ -255,7 +259,7 @@ static ASTNode_t *stmt_return(Scanner_t *scanner)
     {
         ASTNode_t *expr = expr_expression(scanner);
         scanner_match(scanner, TOK_SEMICOLON);
-        datatype_check_assign_expr_type(func->data_type, expr->expr_type);
+        datatype_check_assign_expr_type(func->data_type, expr);
         return_stmt = ast_create_node(
             AST_RETURN,
             expr,
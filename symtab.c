@@ -1,20 +1,75 @@
 #include "symtab.h"
 #include "debug.h"
-#include "darray.h"
 #include "llist_definitions.h"
 
+#include <pthread.h>
+#include <stdatomic.h>
 #include <string.h>
 #include <stdlib.h>
 
-#define GLOBAL_SYMBOL_SIZE 255
+#define GLOBAL_SYMBOL_CHUNK_SIZE 256
+#define GLOBAL_SYMBOL_MAX_CHUNKS 1024
+#define GLOBAL_SYMBOL_BUCKETS 4096
 
-#define GlobalSymTab(index) (*(Symbol_t **)darray_get(&global_symbols, index))
+// Symbols are kept in fixed size chunks that are never moved, so the code
+// generator can read symbols while the parser keeps adding new ones
+#define GlobalSymTab(index) \
+    (global_symbols[(index) / GLOBAL_SYMBOL_CHUNK_SIZE][(index) % GLOBAL_SYMBOL_CHUNK_SIZE])
 
-static DArray_t global_symbols;
+typedef struct SymbolEntry SymbolEntry_t;
+struct SymbolEntry
+{
+    int index;
+    SymbolEntry_t *next;
+};
+
+static Symbol_t **global_symbols[GLOBAL_SYMBOL_MAX_CHUNKS];
 static int global_symbols_index = 0;
 
+// Name lookup table. Entries are only ever pushed at the head of a bucket,
+// after being fully initialized, so lookups don't need to take the lock
+static _Atomic(SymbolEntry_t *) global_symbols_hash[GLOBAL_SYMBOL_BUCKETS];
+static pthread_mutex_t global_symbols_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local int current_position = 0;
+
+static __uint32_t symbol_hash(const char *name)
+{
+    // FNV-1a
+    __uint32_t hash = 2166136261u;
+    for (; *name; name++)
+    {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void reserve_global_symbol(int index)
+{
+    if (index / GLOBAL_SYMBOL_CHUNK_SIZE >= GLOBAL_SYMBOL_MAX_CHUNKS)
+    {
+        debug_print(SEV_ERROR, "[SYMTAB] Too many global symbols");
+        exit(1);
+    }
+    if (global_symbols[index / GLOBAL_SYMBOL_CHUNK_SIZE] == NULL)
+        global_symbols[index / GLOBAL_SYMBOL_CHUNK_SIZE] = calloc(GLOBAL_SYMBOL_CHUNK_SIZE, sizeof(Symbol_t *));
+}
+
+static void publish_global_symbol(int index)
+{
+    _Atomic(SymbolEntry_t *) *bucket = &global_symbols_hash[symbol_hash(GlobalSymTab(index)->sym_name) % GLOBAL_SYMBOL_BUCKETS];
+    SymbolEntry_t *entry = malloc(sizeof(SymbolEntry_t));
+
+    entry->index = index;
+    entry->next = atomic_load_explicit(bucket, memory_order_relaxed);
+    atomic_store_explicit(bucket, entry, memory_order_release);
+}
+
 int symtab_add_global_symbol(char *symbol_name, SymbolType_e sym_type, Datatype_t *data_type)
 {
+    // Function bodies may be parsed on several threads, each adding its locals
+    pthread_mutex_lock(&global_symbols_lock);
+
     int sym_info = symtab_find_global_symbol(symbol_name);
     if (sym_info > -1)
     {
@@ -22,12 +77,16 @@ int symtab_add_global_symbol(char *symbol_name, SymbolType_e sym_type, Datatype_
         exit(1);
     }
 
-    if (sym_type == SYMBOL_VAR)
+    reserve_global_symbol(global_symbols_index);
+    if (sym_type == SYMBOL_VAR || sym_type == SYMBOL_ENUM)
     {
         GlobalSymTab(global_symbols_index) = malloc(sizeof(Symbol_t));
         GlobalSymTab(global_symbols_index)->sym_name = strdup(symbol_name);
         GlobalSymTab(global_symbols_index)->sym_type = sym_type;
         GlobalSymTab(global_symbols_index)->data_type = data_type;
+        GlobalSymTab(global_symbols_index)->position = current_position;
+        GlobalSymTab(global_symbols_index)->init_value = NULL;
+        GlobalSymTab(global_symbols_index)->targets = (CallTargets_t){0};
     }
     else if (sym_type == SYMBOL_FUNC)
     {
@@ -35,27 +94,36 @@ int symtab_add_global_symbol(char *symbol_name, SymbolType_e sym_type, Datatype_
         ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->sym_name = strdup(symbol_name);
         ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->sym_type = sym_type;
         ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->data_type = data_type;
+        ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->position = current_position;
         LList_init(&(((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->args));
+        ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->defined = false;
+        ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->definition = 0;
+        ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->has_locals = false;
+        ((SymbolFunc_t *)GlobalSymTab(global_symbols_index))->parallel_kernel = false;
     }
     else
     {
         debug_print(SEV_ERROR, "[SYMTAB] Unsupported symbol type");
         exit(1);
     }
+    publish_global_symbol(global_symbols_index);
 
     debug_print(SEV_DEBUG, "Added symbol %s in globals symbol table", symbol_name);
-    return global_symbols_index++;
+    sym_info = global_symbols_index++;
+    pthread_mutex_unlock(&global_symbols_lock);
+    return sym_info;
 }
 
 int symtab_find_global_symbol(char *symbol_name)
 {
-    for (int i = 0; i < global_symbols_index; i++)
+    SymbolEntry_t *entry = atomic_load_explicit(
+        &global_symbols_hash[symbol_hash(symbol_name) % GLOBAL_SYMBOL_BUCKETS],
+        memory_order_acquire);
+
+    for (; entry != NULL; entry = entry->next)
     {
-        if (
-            strcmp(symbol_name, GlobalSymTab(i)->sym_name) == 0)
-        {
-            return i;
-        }
+        if (strcmp(symbol_name, GlobalSymTab(entry->index)->sym_name) == 0)
+            return entry->index;
     }
 
     return -1;
@@ -66,31 +134,177 @@ Symbol_t *symtab_get_symbol(int symbol_index)
     return GlobalSymTab(symbol_index);
 }
 
-void symtab_init_global_symtab()
+int symtab_global_symbol_count()
+{
+    return global_symbols_index;
+}
+
+void symtab_set_position(int position)
+{
+    current_position = position;
+}
+
+int symtab_get_position()
+{
+    return current_position;
+}
+
+// Symbols of the same declaration, like the locals of the current function,
+// are visible
+bool symtab_declared_later(int symbol_index)
+{
+    return GlobalSymTab(symbol_index)->position > current_position;
+}
+
+// Function bodies may be parsed on several threads, and generated while the
+// rest of the file is parsed
+void symtab_vote_call_target(CallTargets_t *targets, ASTNode_t *value)
+{
+    int target = value->type == AST_FUNC_ADDR ? value->value.num : -1;
+
+    pthread_mutex_lock(&global_symbols_lock);
+    if (targets->vote_count == targets->vote_capacity)
+    {
+        targets->vote_capacity = targets->vote_capacity ? targets->vote_capacity * 2 : 4;
+        targets->votes = realloc(targets->votes, targets->vote_capacity * sizeof(CallVote_t));
+    }
+    targets->votes[targets->vote_count++] = (CallVote_t){target, current_position};
+    pthread_mutex_unlock(&global_symbols_lock);
+}
+
+// Boyer-Moore majority vote, then a second pass checks that the candidate
+// really has a majority
+int symtab_call_target(CallTargets_t *targets, int position)
+{
+    int candidate = -1;
+    size_t lead = 0;
+    size_t total = 0;
+    size_t count = 0;
+
+    pthread_mutex_lock(&global_symbols_lock);
+    for (size_t i = 0; i < targets->vote_count; i++)
+    {
+        if (targets->votes[i].position > position)
+            continue;
+        total++;
+        if (lead == 0)
+        {
+            candidate = targets->votes[i].target;
+            lead = 1;
+        }
+        else if (targets->votes[i].target == candidate)
+            lead++;
+        else
+            lead--;
+    }
+    for (size_t i = 0; i < targets->vote_count; i++)
+    {
+        if (targets->votes[i].position <= position && targets->votes[i].target == candidate)
+            count++;
+    }
+    pthread_mutex_unlock(&global_symbols_lock);
+    return count * 2 > total ? candidate : -1;
+}
+
+bool symtab_mark_func_locals(int func_index)
+{
+    SymbolFunc_t *func = (SymbolFunc_t *)GlobalSymTab(func_index);
+    bool conflict;
+
+    pthread_mutex_lock(&global_symbols_lock);
+    func->has_locals = true;
+    conflict = func->parallel_kernel;
+    pthread_mutex_unlock(&global_symbols_lock);
+    return conflict;
+}
+
+bool symtab_mark_parallel_kernel(int func_index)
 {
-    darray_init(&global_symbols, GLOBAL_SYMBOL_SIZE, sizeof(Symbol_t *));
+    SymbolFunc_t *func = (SymbolFunc_t *)GlobalSymTab(func_index);
+    bool conflict;
 
+    pthread_mutex_lock(&global_symbols_lock);
+    func->parallel_kernel = true;
+    conflict = func->has_locals;
+    pthread_mutex_unlock(&global_symbols_lock);
+    return conflict;
+}
+
+void symtab_init_global_symtab()
+{
     int lib_print = symtab_add_global_symbol("print", SYMBOL_FUNC, DATATYPE_VOID);
-    SymbolFuncArg_t *argument = (SymbolFuncArg_t *)malloc(sizeof(SymbolFuncArg_t));
+    SymbolFuncArg_t *argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
     argument->arg_name = "x";
     argument->arg_type = DATATYPE_LONG;
     LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_print))->args, argument);
 
     lib_print = symtab_add_global_symbol("print_char", SYMBOL_FUNC, DATATYPE_VOID);
-    argument = (SymbolFuncArg_t *)malloc(sizeof(SymbolFuncArg_t));
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
     argument->arg_name = "x";
     argument->arg_type = DATATYPE_CHAR;
     LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_print))->args, argument);
 
     lib_print = symtab_add_global_symbol("print_str", SYMBOL_FUNC, DATATYPE_VOID);
-    argument = (SymbolFuncArg_t *)malloc(sizeof(SymbolFuncArg_t));
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
     argument->arg_name = "x";
-    argument->arg_type = datatype_get_pointer_of(DATATYPE_CHAR);
+    argument->arg_type = datatype_get_pointer_of(datatype_get_const_of(DATATYPE_CHAR));
     LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_print))->args, argument);
 
     lib_print = symtab_add_global_symbol("print_ln", SYMBOL_FUNC, DATATYPE_VOID);
-    argument = (SymbolFuncArg_t *)malloc(sizeof(SymbolFuncArg_t));
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
     argument->arg_name = "x";
-    argument->arg_type = datatype_get_pointer_of(DATATYPE_CHAR);
+    argument->arg_type = datatype_get_pointer_of(datatype_get_const_of(DATATYPE_CHAR));
     LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_print))->args, argument);
+
+    lib_print = symtab_add_global_symbol("print_double", SYMBOL_FUNC, DATATYPE_VOID);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "x";
+    argument->arg_type = DATATYPE_DOUBLE;
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_print))->args, argument);
+
+    // Runs fn(i) for every i in [lo, hi) on the thread pool of lib/parallel.c
+    int lib_parallel = symtab_add_global_symbol("parallel_for", SYMBOL_FUNC, DATATYPE_VOID);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "lo";
+    argument->arg_type = DATATYPE_LONG;
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_parallel))->args, argument);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "hi";
+    argument->arg_type = DATATYPE_LONG;
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_parallel))->args, argument);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "fn";
+    argument->arg_type = datatype_get_pointer_of(DATATYPE_VOID);
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_parallel))->args, argument);
+
+    // Bump allocator of lib/arena.c, the fast path of arena_alloc is inlined
+    int lib_arena = symtab_add_global_symbol("arena_new", SYMBOL_FUNC, datatype_get_pointer_of(DATATYPE_VOID));
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "capacity";
+    argument->arg_type = DATATYPE_LONG;
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_arena))->args, argument);
+
+    lib_arena = symtab_add_global_symbol("arena_alloc", SYMBOL_FUNC, datatype_get_pointer_of(DATATYPE_VOID));
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "arena";
+    argument->arg_type = datatype_get_pointer_of(DATATYPE_VOID);
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_arena))->args, argument);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "size";
+    argument->arg_type = DATATYPE_LONG;
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_arena))->args, argument);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "align";
+    argument->arg_type = DATATYPE_LONG;
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_arena))->args, argument);
+
+    lib_arena = symtab_add_global_symbol("arena_reset", SYMBOL_FUNC, DATATYPE_VOID);
+    argument = (SymbolFuncArg_t *)calloc(1, sizeof(SymbolFuncArg_t));
+    argument->arg_name = "arena";
+    argument->arg_type = datatype_get_pointer_of(DATATYPE_VOID);
+    LList_SymbolFuncArg_append(&((SymbolFunc_t *)symtab_get_symbol(lib_arena))->args, argument);
+
+    // Defined in lib/, they can still be declared again
+    for (int i = 0; i < global_symbols_index; i++)
+        ((SymbolFunc_t *)GlobalSymTab(i))->defined = true;
 }
\ No newline at end of file
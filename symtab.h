@@ -1,19 +1,48 @@
 #ifndef _SYMTAB_H_
 #define _SYMTAB_H_
 
+#include "ast.h"
 #include "datatype.h"
 #include "llist.h"
 typedef enum
 {
     SYMBOL_VAR,
-    SYMBOL_FUNC
+    SYMBOL_FUNC,
+    SYMBOL_ENUM /**< Enumerator, its uses are replaced by its value. */
 } SymbolType_e;
 
+/**
+ * @brief A store to a function pointer.
+ */
+typedef struct
+{
+    int target; /**< Symbol index of the stored function, -1 for an unknown function. */
+    int position; /**< Position of the top-level declaration holding the store. */
+} CallVote_t;
+
+/**
+ * @brief Functions stored in a function pointer, as seen while parsing.
+ *
+ * Every store votes for the function it stores, or for an unknown one when
+ * the stored value isn't the name of a function. The votes are kept in the
+ * order they were parsed, which differs between threads, but only the
+ * majority among them is used.
+ */
+typedef struct
+{
+    CallVote_t *votes;
+    size_t vote_count;
+    size_t vote_capacity;
+} CallTargets_t;
+
 typedef struct
 {
     char *sym_name;
     SymbolType_e sym_type;
     Datatype_t *data_type;
+    int position;          /**< Top-level declaration that added it, see symtab_set_position(). */
+    ASTNode_t *init_value; /**< Initializer of const variables, value of enumerators, NULL otherwise. */
+    CallTargets_t targets; /**< Functions stored in function pointer variables and arrays. */
 } Symbol_t;
 
 typedef struct
@@ -21,18 +50,94 @@ typedef struct
     char *sym_name;
     SymbolType_e sym_type;
     Datatype_t *data_type;
+    int position; /**< Top-level declaration that added it, see symtab_set_position(). */
     LList_t args;
+    bool defined;         /**< A body was parsed, prototypes leave it unset. */
+    int definition;       /**< Position of the declaration holding the body. */
+    bool has_locals;      /**< The body declares scalar variables, which live in static storage. */
+    bool parallel_kernel; /**< Passed to parallel_for, so several threads may run it at once. */
 } SymbolFunc_t;
 
 typedef struct
 {
     char *arg_name;
     Datatype_t *arg_type;
+    CallTargets_t targets; /**< Functions passed to a function pointer parameter. */
 } SymbolFuncArg_t;
 
 void symtab_init_global_symtab();
 int symtab_add_global_symbol(char *symbol_name, SymbolType_e sym_type, Datatype_t *data_type);
 int symtab_find_global_symbol(char *symbol_name);
 Symbol_t *symtab_get_symbol(int symbol_index);
+int symtab_global_symbol_count();
+
+/**
+ * @brief Sets the top-level declaration parsed by the calling thread.
+ *
+ * Top-level declarations are numbered in file order, from 1, whatever the
+ * mode. Symbols added and stores to function pointers made by the thread
+ * take `position` as their position. The parallel parser declares every
+ * global before parsing the function bodies, positions keep a body from
+ * seeing the globals declared after it.
+ *
+ * @param position Position of the declaration in the file, 0 for the
+ *        builtins.
+ */
+void symtab_set_position(int position);
+int symtab_get_position();
+
+/**
+ * @brief Tells if a symbol was declared after the declaration parsed by the
+ *        calling thread, and so isn't visible to it yet.
+ */
+bool symtab_declared_later(int symbol_index);
+
+/**
+ * @brief Records a store to a function pointer, made in the declaration
+ *        parsed by the calling thread.
+ *
+ * @param targets Targets of the pointer.
+ * @param value Stored value, the store votes for its function when it is
+ *        the address of one.
+ */
+void symtab_vote_call_target(CallTargets_t *targets, ASTNode_t *value);
+
+/**
+ * @brief Function most likely called through a pointer.
+ *
+ * Only the stores in the declarations up to `position` are counted. The
+ * declarations parsed before a function is generated are the same in every
+ * mode, so they always give the same guess, even when the rest of the file
+ * isn't parsed yet. A pointer parameter is stored by the calls to its
+ * function, only the calls in the functions defined before it count.
+ *
+ * @param targets Targets of the pointer.
+ * @param position Position of the definition of the function making the
+ *        call.
+ * @return Symbol index of the function stored by a strict majority of the
+ *         stores, -1 if there is none.
+ */
+int symtab_call_target(CallTargets_t *targets, int position);
+
+/**
+ * @brief Records that a function body declares a scalar variable.
+ *
+ * Scalar locals are kept in static storage, so a parallel_for kernel
+ * declaring one would share it between the threads. The kernel may be
+ * passed to parallel_for before or after its body is parsed, possibly on
+ * another thread, so both flags are checked together under the lock.
+ *
+ * @param func_index Symbol index of the function.
+ * @return true if the function is also a parallel_for kernel.
+ */
+bool symtab_mark_func_locals(int func_index);
+
+/**
+ * @brief Records that a function is passed to parallel_for.
+ *
+ * @param func_index Symbol index of the function.
+ * @return true if the function body also declares scalar variables.
+ */
+bool symtab_mark_parallel_kernel(int func_index);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef TEST_HEADER
+#define TEST_HEADER
+
+#define LIMIT 10
+#define SQUARE(x) ((x) * (x))
+#define ADD(a, b) ((a) + (b))
+
+int square_sum()
+{
+    int sum;
+    int i;
+    sum = 0;
+    for (i = 1; i <= LIMIT; i = i + 1)
+        sum = sum + SQUARE(i);
+    return sum;
+}
+
+#endif
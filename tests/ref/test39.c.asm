@@ -0,0 +1,4 @@
+	lea rax, [inc]
+	call inc
+	lea rax, [dbl]
+	call dbl
@@ -0,0 +1,10 @@
+int main()
+{
+    print_ln("Hello world");
+    print_ln("world");
+    print_ln("Hello world");
+    print_ln("it's a \"quoted\"\tstring");
+    print_ln("");
+    print_ln("ld");
+    return (0);
+}
@@ -0,0 +1,18 @@
+int a = 2 * 3 + 4;
+int b = 10 - 30;
+long c = 100000 * 3;
+int *p = &a + 1;
+char *s = "hello";
+char *t = "hello" + 2;
+int e = 3 > 2;
+int main()
+{
+    print(a);
+    print(b);
+    print(c);
+    print(*(p - 1));
+    print_ln(s);
+    print_ln(t);
+    print(e);
+    return (0);
+}
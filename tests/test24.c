@@ -0,0 +1,20 @@
+int tbl[8] = {1, 2, 3, 4 * 10, 5};
+char msg[] = {'h', 'i', 10};
+char *names[] = {"zero", "one", "two"};
+long big[20];
+char c;
+int x, y[3];
+int main()
+{
+    int loc[3] = {7, 8, 9};
+    print(tbl[3]);
+    print(tbl[7]);
+    print_char(msg[0]);
+    print_char(msg[1]);
+    print_char(msg[2]);
+    print_ln(names[2]);
+    print(loc[0] + loc[1] + loc[2]);
+    y[2] = 5;
+    print(y[2]);
+    return (0);
+}
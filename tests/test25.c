@@ -0,0 +1,22 @@
+const int N = 10;
+const long BIG = 300000;
+const int M = N * 2 + 1;
+const int tbl[] = {1, 2, 4, 8};
+const char *msg = "const";
+int arr[4] = {N, M, 3, 4};
+int x;
+int main()
+{
+    const int k = 7;
+    const int j = x + 1;
+    x = N + M;
+    print(x);
+    print(BIG);
+    print(tbl[3]);
+    print(arr[1]);
+    print(k * j);
+    print_ln(msg);
+    msg = "changed";
+    print_ln(msg);
+    return (0);
+}
@@ -0,0 +1,46 @@
+int one()
+{
+    return 1;
+}
+
+int two()
+{
+    return one() + one();
+}
+
+int three()
+{
+    return one() + two();
+}
+
+int four()
+{
+    return two() * two();
+}
+
+int five()
+{
+    const int k = 5;
+    return k;
+}
+
+int n;
+
+int sum()
+{
+    return one() + two() + three() + four() + five() + n;
+}
+
+int main()
+{
+    n = 10;
+    print(sum());
+    n = 0;
+    print(10 + sum() * 2);
+    print(one() + two() * three() - four() + five());
+    print(two() + two() + two() + two() + two() + two() + two() + two());
+    print(five() + five() + five() + five() + five() + five() + five() + five());
+    print(three() + three() + three() + three() + three() + three() + three());
+    print(four() + four() + four() + four() + four() + four() + four());
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "include/test27.h"
+#include "include/test27.h"
+
+#define DOUBLE(x) (2 * (x))
+#define TWICE_SQUARE(x) DOUBLE(SQUARE(x))
+
+#ifdef LIMIT
+int limit = LIMIT;
+#else
+int limit = 0;
+#endif
+
+#ifndef DEBUG
+#define STEP 3
+#else
+#define STEP 1
+#endif
+
+int main()
+{
+    print(limit);
+    print(square_sum());
+    print(SQUARE(STEP + 1));
+    print(ADD(limit, STEP));
+    print(TWICE_SQUARE(4));
+#undef LIMIT
+#ifdef LIMIT
+    print(0);
+#endif
+    return 0;
+}
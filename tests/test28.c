@@ -0,0 +1,45 @@
+extern void *memset(void *s, int c, long n);
+extern void *memcpy(void *, const void *, long);
+extern long strlen(const char *s);
+extern int strcmp(const char *a, const char *b);
+extern int abs(int);
+extern int toupper(int c);
+extern void *malloc(long size);
+extern void free(void *ptr);
+extern int snprintf(char *buf, long size, const char *format, long a, long b, long c, long d, long e);
+extern long scale(long x, int factor);
+extern long scale(long, int);
+extern void print(long x);
+
+char buf[16];
+
+int main()
+{
+    char *heap;
+    long len;
+
+    memset(buf, 'a', 5);
+    print_ln(buf);
+    len = strlen(buf);
+    print(len);
+
+    heap = malloc(32);
+    memcpy(heap, "copied", 7);
+    print_ln(heap);
+    print(strcmp(heap, "copied"));
+    print(strcmp(heap, "copies") < 0);
+    free(heap);
+
+    print(abs(0 - 42));
+    print(toupper('q'));
+
+    snprintf(buf, 16, "%ld-%ld-%ld-%ld-%ld", 1, 2, 3, 4, 5);
+    print_ln(buf);
+    print(scale(7, 6));
+    return 0;
+}
+
+long scale(long value, int by)
+{
+    return value * by;
+}
@@ -0,0 +1,37 @@
+long counter;
+int flags;
+char small;
+long expected;
+int old_flags;
+
+int main()
+{
+    atomic_store(&counter, 40);
+    print(atomic_fetch_add(&counter, 2));
+    print(atomic_load_explicit(&counter, memory_order_acquire));
+
+    atomic_fetch_add_explicit(&counter, 8, memory_order_relaxed);
+    print(atomic_exchange(&counter, 7));
+    print(counter);
+
+    expected = 7;
+    print(atomic_compare_exchange_strong(&counter, &expected, 11));
+    print(counter);
+    print(atomic_compare_exchange_strong_explicit(&counter, &expected, 13, memory_order_acq_rel, memory_order_acquire));
+    print(expected);
+
+    atomic_store_explicit(&flags, 1, memory_order_release);
+    old_flags = atomic_fetch_or(&flags, 6);
+    print(old_flags);
+    atomic_fetch_or_explicit(&flags, 8, memory_order_relaxed);
+    print(flags);
+
+    atomic_thread_fence(memory_order_seq_cst);
+    atomic_thread_fence(memory_order_acquire);
+
+    small = 250;
+    print(atomic_fetch_add(&small, 10));
+    print(small);
+    print(atomic_fetch_or(&small, 128));
+    return 0;
+}
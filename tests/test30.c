@@ -0,0 +1,74 @@
+long squares[1000];
+long total;
+long hits;
+char seen[1000];
+long *view;
+
+void square(long i)
+{
+    squares[i] = i * i;
+}
+
+void count(long i)
+{
+    atomic_fetch_add(&total, i);
+    seen[i] = seen[i] + 1;
+}
+
+void nested(long i)
+{
+    parallel_for(i * 10, i * 10 + 10, count);
+    atomic_fetch_add(&hits, 1);
+}
+
+long add_three(long a, int b, char c)
+{
+    a = a + b;
+    return a + c;
+}
+
+long last(long a, long b, long c, long d, long e, long f, long g, long h)
+{
+    return g * 10 + h;
+}
+
+int main()
+{
+    long sum;
+    long k;
+    long ok;
+
+    parallel_for(0, 1000, square);
+    sum = 0;
+    for (k = 0; k < 1000; k = k + 1)
+    {
+        sum = sum + squares[k];
+    }
+    print(sum);
+
+    parallel_for(0, 1000, count);
+    print(total);
+    ok = 1;
+    for (k = 0; k < 1000; k = k + 1)
+    {
+        if (seen[k] != 1)
+        {
+            ok = 0;
+        }
+    }
+    print(ok);
+
+    total = 0;
+    parallel_for(0, 100, nested);
+    print(total);
+    print(hits);
+
+    parallel_for(5, 5, square);
+    parallel_for(3, 1, square);
+
+    view = squares;
+    print(view[12]);
+    print(add_three(40, 1, 1));
+    print(last(1, 2, 3, 4, 5, 6, 7, 8));
+    return 0;
+}
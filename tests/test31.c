@@ -0,0 +1,51 @@
+void *arena;
+long *nums;
+long *prev_nums;
+char *tag;
+long *first;
+long i;
+long sum;
+long moved;
+long step;
+
+int main()
+{
+    arena = arena_new(4096);
+
+    tag = arena_alloc(arena, 3, 1);
+    tag[0] = 'o';
+    tag[1] = 'k';
+    tag[2] = 0;
+    print_ln(tag);
+
+    first = arena_alloc(arena, 8, 8);
+    first[0] = 7;
+    sum = 0;
+    for (i = 0; i < 5000; i = i + 1)
+    {
+        nums = arena_alloc(arena, 64, 16);
+        nums[0] = i;
+        nums[7] = i * 2;
+        sum = sum + nums[0] + nums[7];
+    }
+    print(sum);
+    print(first[0]);
+    print(tag[1]);
+
+    nums = arena_alloc(arena, 1000000, 4096);
+    nums[124999] = 5;
+    print(nums[124999]);
+
+    arena_reset(arena);
+    prev_nums = arena_alloc(arena, 3, 1);
+    print(prev_nums == tag);
+    step = 8;
+    nums = arena_alloc(arena, 8, step);
+    moved = 0;
+    if (nums == first)
+    {
+        moved = 1;
+    }
+    print(moved);
+    return 0;
+}
@@ -0,0 +1,78 @@
+extern double atof(const char *s);
+
+const double pi = 3.14159;
+const float weights[3] = {1, 2.5f, 3};
+double samples[4];
+double half;
+float third;
+const float rounded = 0.1;
+
+double scale(double x, int k)
+{
+    return x * k;
+}
+
+float add_float(float a, float b)
+{
+    return a + b;
+}
+
+double mix(long a, double b, long c, double d, long e, long f, long g, long h, long i, double j)
+{
+    return a + b + c + d + e + f + g + h + i + j;
+}
+
+double many(double a, double b, double c, double d, double e, double f, double g, double h, double i, int k)
+{
+    return a + b * 2 + c + d + e + f + g + h + i * 10 + k * 100;
+}
+
+int main()
+{
+    double d;
+    float f;
+    int i;
+    long l;
+    double zero;
+    double nan;
+
+    half = 0.5;
+    third = 1.0f / 3.0f;
+    d = 1.5e2;
+    f = 2.25f;
+    i = d;
+    print(i);
+    d = d / 4 + half;
+    print_double(d);
+    print_double(third);
+    print_double(scale(d, 3));
+    print_double(add_float(f, 1));
+    print_double(d + scale(half, 4));
+
+    samples[2] = 7.5;
+    print_double(samples[2] * 2);
+    print(samples[2] > 7);
+    print(samples[2] <= 7);
+    l = 3 * samples[2];
+    print(l);
+
+    print_double(pi * 2);
+    print_double(weights[1] + weights[2]);
+    print_double(atof("0.75") * 4);
+    print_double(mix(1, 0.5, 2, 0.25, 3, 4, 5, 6, 7, 0.125));
+    print_double(many(1, 2, 3, 4, 5, 6, 7, 8, 9, 3));
+
+    zero = 0;
+    nan = zero / zero;
+    print(nan == nan);
+    print(nan != nan);
+    print(nan < 1);
+    f = 16777217;
+    print_double(f);
+
+    f = 0.5;
+    print_double(add_float(f, 0.25));
+    print(rounded == 0.1);
+    print(rounded == 0.1f);
+    return 0;
+}
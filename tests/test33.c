@@ -0,0 +1,102 @@
+const unsigned int seed = 2166136261u;
+unsigned char bytes[4] = {200, 100, 250, 7};
+unsigned buckets[8];
+
+unsigned int fnv(unsigned char *p, int n)
+{
+    unsigned int h;
+    int i;
+
+    h = seed;
+    for (i = 0; i < n; i = i + 1)
+    {
+        h = (h + p[i]) * 16777619;
+    }
+    return h;
+}
+
+unsigned long divide(unsigned long x, unsigned long y)
+{
+    return x / y;
+}
+
+int main()
+{
+    unsigned int u;
+    unsigned int hashed;
+    unsigned long ul;
+    unsigned char c;
+    int s;
+    long l;
+    double d;
+
+    u = 0 - 1;
+    print(u);
+    print(u / 2);
+    print(u % 10);
+    print(u % 64);
+    print(u > 1);
+    s = 0 - 1;
+    print(s > 1);
+    print(s % 3);
+    print(17 % 5);
+    print(seed / 3);
+    print(3000000000 > seed);
+
+    hashed = fnv(bytes, 4);
+    print(hashed);
+    print(hashed % 8);
+    print(hashed / 16);
+    buckets[hashed % 8] = buckets[hashed % 8] + 1;
+    print(buckets[hashed % 8]);
+
+    c = 250;
+    print(c > 100);
+    print(c / 4);
+
+    l = u;
+    print(l);
+    s = 0 - 2;
+    ul = s;
+    print(ul / 2);
+    print(divide(ul, 4000000000u));
+    print(ul > 5);
+
+    ul = 0 - 1;
+    d = ul;
+    print_double(d);
+    d = 18000000000000000000.0;
+    ul = d;
+    print(ul / 1000);
+    u = 4000000000u;
+    d = u;
+    print_double(d);
+    d = 3000000000.5;
+    u = d;
+    print(u);
+
+    u = 7;
+    while (u < 4000000000)
+    {
+        u = u * 3;
+    }
+    print(u);
+    if (u >= 3000000000)
+        print(1);
+
+    l = 5000000000;
+    print(l);
+    ul = 18446744073709551615u;
+    print(ul > 5000000000);
+    print(ul / 4294967296);
+    print(1l * 1099511627776);
+    print(sizeof(1l));
+    print(sizeof(4000000000u));
+    print(sizeof(3000000000));
+    print(sizeof(9223372036854775807));
+    print(4294967295u + 1);
+    print(4294967295ul + 1);
+    print(2147483647 + 1l);
+    print(12LLu);
+    return 0;
+}
@@ -0,0 +1,77 @@
+enum Color
+{
+    RED,
+    GREEN = 5,
+    BLUE,
+    LAST = BLUE * 2 + 1
+};
+enum
+{
+    SLOTS = sizeof(long) * 2
+};
+const int scale = 3;
+enum Limits { BIG = scale * 100, HUGE = BIG * BIG };
+
+long table[SLOTS];
+char names[sizeof(int) + 1];
+enum Color favourite;
+
+int counter()
+{
+    print(99);
+    return 1;
+}
+
+int shade(enum Color c)
+{
+    return c * LAST;
+}
+
+int main()
+{
+    enum Mode { OFF = 0 - 1, ON = OFF + 2 };
+    int i;
+    long values[RED + 4];
+    char c;
+
+    print(RED);
+    print(GREEN);
+    print(BLUE);
+    print(LAST);
+    print(SLOTS);
+    print(BIG);
+    print(HUGE);
+    print(OFF);
+    print(ON);
+
+    print(sizeof(char));
+    print(sizeof(int));
+    print(sizeof(long));
+    print(sizeof(float));
+    print(sizeof(double));
+    print(sizeof(unsigned long));
+    print(sizeof(const char *));
+    print(sizeof(enum Color));
+    print(sizeof table);
+    print(sizeof names);
+    print(sizeof(values));
+    print(sizeof values[0]);
+    print(sizeof(table) / sizeof(table[0]));
+    print(sizeof i + 1);
+    print(sizeof(counter()));
+
+    for (i = 0; i < SLOTS; i = i + 1)
+    {
+        table[i] = i * LAST;
+    }
+    print(table[SLOTS - 1]);
+
+    favourite = BLUE;
+    print(favourite == BLUE);
+    print(shade(favourite));
+    c = GREEN;
+    print(c + ON);
+    if (OFF < 0)
+        print(1);
+    return 0;
+}
@@ -0,0 +1,86 @@
+extern int abs(int);
+
+long add(long a, long b)
+{
+    return a + b;
+}
+
+long sub(long a, long b)
+{
+    return a - b;
+}
+
+long mul(long a, long b)
+{
+    return a * b;
+}
+
+long seven()
+{
+    return 7;
+}
+
+float half(float x)
+{
+    return x / 2;
+}
+
+long (*ops[3])(long, long) = {add, sub, mul};
+long (*binop)(long, long) = add;
+int (*mag)(int) = abs;
+long (*constant)() = seven;
+
+long apply(long (*f)(long, long), long x, long y)
+{
+    return f(x, y);
+}
+
+long fold(long (*f)(long, long), long *values, int n)
+{
+    long acc;
+    int k;
+
+    acc = values[0];
+    for (k = 1; k < n; k = k + 1)
+        acc = (*f)(acc, values[k]);
+    return acc;
+}
+
+long values[4] = {3, 5, 7, 9};
+
+int main()
+{
+    int i;
+    float (*shrink)(float);
+    float size;
+    void (*show)(long);
+
+    print(binop(3, 4));
+    binop = mul;
+    print(binop(3, 4));
+    print(binop == mul);
+    print(binop == add);
+
+    print(apply(add, 10, 5));
+    print(apply(add, apply(add, 1, 2), 3));
+    print(apply(add, 4, 4));
+    print(apply(sub, 10, 5));
+
+    for (i = 0; i < 3; i = i + 1)
+        print(ops[i](20, 4));
+    ops[1] = add;
+    print(ops[1](1, 2));
+
+    print(fold(add, values, 4));
+    print(fold(mul, values, 4));
+
+    print(mag(0 - 12));
+    print(constant() * 6);
+
+    shrink = half;
+    size = 5;
+    print_double(shrink(size));
+    show = print;
+    show(99);
+    return 0;
+}
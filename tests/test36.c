@@ -0,0 +1,83 @@
+long weights[4] = {1, 10, 100, 1000};
+
+long digits(long n, long base)
+{
+    long out[20];
+    int count;
+    int k;
+    long value;
+
+    count = 0;
+    while (n > 0)
+    {
+        out[count] = n % base;
+        n = n / base;
+        count = count + 1;
+    }
+    value = 0;
+    for (k = 0; k < count; k = k + 1)
+        value = value * 10 + out[k];
+    return value;
+}
+
+long depth(long n, long a, long b, long c, long d, long e, long f, long g)
+{
+    long seen[5] = {7};
+    long partial;
+
+    seen[1] = n;
+    partial = seen[0] + seen[1] + seen[2] + seen[4];
+    if (n > 0)
+        partial = partial + depth(n - 1, a, b, c, d, e, f, g);
+    return partial + a + g;
+}
+
+long fill(long n)
+{
+    long slot[2];
+    long inner;
+
+    slot[0] = n;
+    inner = 0;
+    if (n > 0)
+        inner = fill(n - 1);
+    return slot[0] + inner;
+}
+
+int main()
+{
+    long table[32];
+    int small[3] = {4, 5, 6};
+    double scale[2];
+    char tag[3];
+    long *cursor;
+    int i;
+    long sum;
+
+    for (i = 0; i < 32; i = i + 1)
+        table[i] = i * weights[i % 4];
+    sum = 0;
+    cursor = table;
+    for (i = 0; i < 32; i = i + 1)
+        sum = sum + cursor[i];
+    print(sum);
+    print(*(table + 31));
+    print(small[0] + small[1] * small[2]);
+
+    scale[0] = 1.5;
+    scale[1] = scale[0] * 4;
+    print_double(scale[1]);
+
+    tag[0] = 'o';
+    tag[1] = tag[0] - 4;
+    tag[2] = 10;
+    print_char(tag[0]);
+    print_char(tag[1]);
+    print_char(tag[2]);
+
+    print(digits(1234, 10));
+    print(digits(10, 2));
+    print(depth(3, 1, 2, 3, 4, 5, 6, 7));
+    print(fill(3));
+    return 0;
+}
@@ -0,0 +1,1221 @@
+long arg;
+long faaa() { long yaaa; yaaa = arg * 3; return yaaa - yaaa / 1000003 * 1000003; }
+long faab() { long yaab; yaab = arg * 3 + 1; arg = yaab - yaab / 1000003 * 1000003; return faaa(); }
+long faac() { long yaac; yaac = arg * 3 + 2; arg = yaac - yaac / 1000003 * 1000003; return faab(); }
+long faad() { long yaad; yaad = arg * 3 + 3; arg = yaad - yaad / 1000003 * 1000003; return faac(); }
+long faae() { long yaae; yaae = arg * 3 + 4; arg = yaae - yaae / 1000003 * 1000003; return faad(); }
+long faaf() { long yaaf; yaaf = arg * 3 + 5; arg = yaaf - yaaf / 1000003 * 1000003; return faae(); }
+long faag() { long yaag; yaag = arg * 3 + 6; arg = yaag - yaag / 1000003 * 1000003; return faaf(); }
+long faah() { long yaah; yaah = arg * 3 + 7; arg = yaah - yaah / 1000003 * 1000003; return faag(); }
+long faai() { long yaai; yaai = arg * 3 + 8; arg = yaai - yaai / 1000003 * 1000003; return faah(); }
+long faaj() { long yaaj; yaaj = arg * 3 + 9; arg = yaaj - yaaj / 1000003 * 1000003; return faai(); }
+long faak() { long yaak; yaak = arg * 3 + 10; arg = yaak - yaak / 1000003 * 1000003; return faaj(); }
+long faal() { long yaal; yaal = arg * 3 + 11; arg = yaal - yaal / 1000003 * 1000003; return faak(); }
+long faam() { long yaam; yaam = arg * 3 + 12; arg = yaam - yaam / 1000003 * 1000003; return faal(); }
+long faan() { long yaan; yaan = arg * 3 + 13; arg = yaan - yaan / 1000003 * 1000003; return faam(); }
+long faao() { long yaao; yaao = arg * 3 + 14; arg = yaao - yaao / 1000003 * 1000003; return faan(); }
+long faap() { long yaap; yaap = arg * 3 + 15; arg = yaap - yaap / 1000003 * 1000003; return faao(); }
+long faaq() { long yaaq; yaaq = arg * 3 + 16; arg = yaaq - yaaq / 1000003 * 1000003; return faap(); }
+long faar() { long yaar; yaar = arg * 3 + 17; arg = yaar - yaar / 1000003 * 1000003; return faaq(); }
+long faas() { long yaas; yaas = arg * 3 + 18; arg = yaas - yaas / 1000003 * 1000003; return faar(); }
+long faat() { long yaat; yaat = arg * 3 + 19; arg = yaat - yaat / 1000003 * 1000003; return faas(); }
+long faau() { long yaau; yaau = arg * 3 + 20; arg = yaau - yaau / 1000003 * 1000003; return faat(); }
+long faav() { long yaav; yaav = arg * 3 + 21; arg = yaav - yaav / 1000003 * 1000003; return faau(); }
+long faaw() { long yaaw; yaaw = arg * 3 + 22; arg = yaaw - yaaw / 1000003 * 1000003; return faav(); }
+long faax() { long yaax; yaax = arg * 3 + 23; arg = yaax - yaax / 1000003 * 1000003; return faaw(); }
+long faay() { long yaay; yaay = arg * 3 + 24; arg = yaay - yaay / 1000003 * 1000003; return faax(); }
+long faaz() { long yaaz; yaaz = arg * 3 + 25; arg = yaaz - yaaz / 1000003 * 1000003; return faay(); }
+long faba() { long yaba; yaba = arg * 3 + 26; arg = yaba - yaba / 1000003 * 1000003; return faaz(); }
+long fabb() { long yabb; yabb = arg * 3 + 27; arg = yabb - yabb / 1000003 * 1000003; return faba(); }
+long fabc() { long yabc; yabc = arg * 3 + 28; arg = yabc - yabc / 1000003 * 1000003; return fabb(); }
+long fabd() { long yabd; yabd = arg * 3 + 29; arg = yabd - yabd / 1000003 * 1000003; return fabc(); }
+long fabe() { long yabe; yabe = arg * 3 + 30; arg = yabe - yabe / 1000003 * 1000003; return fabd(); }
+long fabf() { long yabf; yabf = arg * 3 + 31; arg = yabf - yabf / 1000003 * 1000003; return fabe(); }
+long fabg() { long yabg; yabg = arg * 3 + 32; arg = yabg - yabg / 1000003 * 1000003; return fabf(); }
+long fabh() { long yabh; yabh = arg * 3 + 33; arg = yabh - yabh / 1000003 * 1000003; return fabg(); }
+long fabi() { long yabi; yabi = arg * 3 + 34; arg = yabi - yabi / 1000003 * 1000003; return fabh(); }
+long fabj() { long yabj; yabj = arg * 3 + 35; arg = yabj - yabj / 1000003 * 1000003; return fabi(); }
+long fabk() { long yabk; yabk = arg * 3 + 36; arg = yabk - yabk / 1000003 * 1000003; return fabj(); }
+long fabl() { long yabl; yabl = arg * 3 + 37; arg = yabl - yabl / 1000003 * 1000003; return fabk(); }
+long fabm() { long yabm; yabm = arg * 3 + 38; arg = yabm - yabm / 1000003 * 1000003; return fabl(); }
+long fabn() { long yabn; yabn = arg * 3 + 39; arg = yabn - yabn / 1000003 * 1000003; return fabm(); }
+long fabo() { long yabo; yabo = arg * 3 + 40; arg = yabo - yabo / 1000003 * 1000003; return fabn(); }
+long fabp() { long yabp; yabp = arg * 3 + 41; arg = yabp - yabp / 1000003 * 1000003; return fabo(); }
+long fabq() { long yabq; yabq = arg * 3 + 42; arg = yabq - yabq / 1000003 * 1000003; return fabp(); }
+long fabr() { long yabr; yabr = arg * 3 + 43; arg = yabr - yabr / 1000003 * 1000003; return fabq(); }
+long fabs() { long yabs; yabs = arg * 3 + 44; arg = yabs - yabs / 1000003 * 1000003; return fabr(); }
+long fabt() { long yabt; yabt = arg * 3 + 45; arg = yabt - yabt / 1000003 * 1000003; return fabs(); }
+long fabu() { long yabu; yabu = arg * 3 + 46; arg = yabu - yabu / 1000003 * 1000003; return fabt(); }
+long fabv() { long yabv; yabv = arg * 3 + 47; arg = yabv - yabv / 1000003 * 1000003; return fabu(); }
+long fabw() { long yabw; yabw = arg * 3 + 48; arg = yabw - yabw / 1000003 * 1000003; return fabv(); }
+long fabx() { long yabx; yabx = arg * 3 + 49; arg = yabx - yabx / 1000003 * 1000003; return fabw(); }
+long faby() { long yaby; yaby = arg * 3 + 50; arg = yaby - yaby / 1000003 * 1000003; return fabx(); }
+long fabz() { long yabz; yabz = arg * 3 + 51; arg = yabz - yabz / 1000003 * 1000003; return faby(); }
+long faca() { long yaca; yaca = arg * 3 + 52; arg = yaca - yaca / 1000003 * 1000003; return fabz(); }
+long facb() { long yacb; yacb = arg * 3 + 53; arg = yacb - yacb / 1000003 * 1000003; return faca(); }
+long facc() { long yacc; yacc = arg * 3 + 54; arg = yacc - yacc / 1000003 * 1000003; return facb(); }
+long facd() { long yacd; yacd = arg * 3 + 55; arg = yacd - yacd / 1000003 * 1000003; return facc(); }
+long face() { long yace; yace = arg * 3 + 56; arg = yace - yace / 1000003 * 1000003; return facd(); }
+long facf() { long yacf; yacf = arg * 3 + 57; arg = yacf - yacf / 1000003 * 1000003; return face(); }
+long facg() { long yacg; yacg = arg * 3 + 58; arg = yacg - yacg / 1000003 * 1000003; return facf(); }
+long fach() { long yach; yach = arg * 3 + 59; arg = yach - yach / 1000003 * 1000003; return facg(); }
+long faci() { long yaci; yaci = arg * 3 + 60; arg = yaci - yaci / 1000003 * 1000003; return fach(); }
+long facj() { long yacj; yacj = arg * 3 + 61; arg = yacj - yacj / 1000003 * 1000003; return faci(); }
+long fack() { long yack; yack = arg * 3 + 62; arg = yack - yack / 1000003 * 1000003; return facj(); }
+long facl() { long yacl; yacl = arg * 3 + 63; arg = yacl - yacl / 1000003 * 1000003; return fack(); }
+long facm() { long yacm; yacm = arg * 3 + 64; arg = yacm - yacm / 1000003 * 1000003; return facl(); }
+long facn() { long yacn; yacn = arg * 3 + 65; arg = yacn - yacn / 1000003 * 1000003; return facm(); }
+long faco() { long yaco; yaco = arg * 3 + 66; arg = yaco - yaco / 1000003 * 1000003; return facn(); }
+long facp() { long yacp; yacp = arg * 3 + 67; arg = yacp - yacp / 1000003 * 1000003; return faco(); }
+long facq() { long yacq; yacq = arg * 3 + 68; arg = yacq - yacq / 1000003 * 1000003; return facp(); }
+long facr() { long yacr; yacr = arg * 3 + 69; arg = yacr - yacr / 1000003 * 1000003; return facq(); }
+long facs() { long yacs; yacs = arg * 3 + 70; arg = yacs - yacs / 1000003 * 1000003; return facr(); }
+long fact() { long yact; yact = arg * 3 + 71; arg = yact - yact / 1000003 * 1000003; return facs(); }
+long facu() { long yacu; yacu = arg * 3 + 72; arg = yacu - yacu / 1000003 * 1000003; return fact(); }
+long facv() { long yacv; yacv = arg * 3 + 73; arg = yacv - yacv / 1000003 * 1000003; return facu(); }
+long facw() { long yacw; yacw = arg * 3 + 74; arg = yacw - yacw / 1000003 * 1000003; return facv(); }
+long facx() { long yacx; yacx = arg * 3 + 75; arg = yacx - yacx / 1000003 * 1000003; return facw(); }
+long facy() { long yacy; yacy = arg * 3 + 76; arg = yacy - yacy / 1000003 * 1000003; return facx(); }
+long facz() { long yacz; yacz = arg * 3 + 77; arg = yacz - yacz / 1000003 * 1000003; return facy(); }
+long fada() { long yada; yada = arg * 3 + 78; arg = yada - yada / 1000003 * 1000003; return facz(); }
+long fadb() { long yadb; yadb = arg * 3 + 79; arg = yadb - yadb / 1000003 * 1000003; return fada(); }
+long fadc() { long yadc; yadc = arg * 3 + 80; arg = yadc - yadc / 1000003 * 1000003; return fadb(); }
+long fadd() { long yadd; yadd = arg * 3 + 81; arg = yadd - yadd / 1000003 * 1000003; return fadc(); }
+long fade() { long yade; yade = arg * 3 + 82; arg = yade - yade / 1000003 * 1000003; return fadd(); }
+long fadf() { long yadf; yadf = arg * 3 + 83; arg = yadf - yadf / 1000003 * 1000003; return fade(); }
+long fadg() { long yadg; yadg = arg * 3 + 84; arg = yadg - yadg / 1000003 * 1000003; return fadf(); }
+long fadh() { long yadh; yadh = arg * 3 + 85; arg = yadh - yadh / 1000003 * 1000003; return fadg(); }
+long fadi() { long yadi; yadi = arg * 3 + 86; arg = yadi - yadi / 1000003 * 1000003; return fadh(); }
+long fadj() { long yadj; yadj = arg * 3 + 87; arg = yadj - yadj / 1000003 * 1000003; return fadi(); }
+long fadk() { long yadk; yadk = arg * 3 + 88; arg = yadk - yadk / 1000003 * 1000003; return fadj(); }
+long fadl() { long yadl; yadl = arg * 3 + 89; arg = yadl - yadl / 1000003 * 1000003; return fadk(); }
+long fadm() { long yadm; yadm = arg * 3 + 90; arg = yadm - yadm / 1000003 * 1000003; return fadl(); }
+long fadn() { long yadn; yadn = arg * 3 + 91; arg = yadn - yadn / 1000003 * 1000003; return fadm(); }
+long fado() { long yado; yado = arg * 3 + 92; arg = yado - yado / 1000003 * 1000003; return fadn(); }
+long fadp() { long yadp; yadp = arg * 3 + 93; arg = yadp - yadp / 1000003 * 1000003; return fado(); }
+long fadq() { long yadq; yadq = arg * 3 + 94; arg = yadq - yadq / 1000003 * 1000003; return fadp(); }
+long fadr() { long yadr; yadr = arg * 3 + 95; arg = yadr - yadr / 1000003 * 1000003; return fadq(); }
+long fads() { long yads; yads = arg * 3 + 96; arg = yads - yads / 1000003 * 1000003; return fadr(); }
+long fadt() { long yadt; yadt = arg * 3 + 97; arg = yadt - yadt / 1000003 * 1000003; return fads(); }
+long fadu() { long yadu; yadu = arg * 3 + 98; arg = yadu - yadu / 1000003 * 1000003; return fadt(); }
+long fadv() { long yadv; yadv = arg * 3 + 99; arg = yadv - yadv / 1000003 * 1000003; return fadu(); }
+long fadw() { long yadw; yadw = arg * 3 + 100; arg = yadw - yadw / 1000003 * 1000003; return fadv(); }
+long fadx() { long yadx; yadx = arg * 3 + 101; arg = yadx - yadx / 1000003 * 1000003; return fadw(); }
+long fady() { long yady; yady = arg * 3 + 102; arg = yady - yady / 1000003 * 1000003; return fadx(); }
+long fadz() { long yadz; yadz = arg * 3 + 103; arg = yadz - yadz / 1000003 * 1000003; return fady(); }
+long faea() { long yaea; yaea = arg * 3 + 104; arg = yaea - yaea / 1000003 * 1000003; return fadz(); }
+long faeb() { long yaeb; yaeb = arg * 3 + 105; arg = yaeb - yaeb / 1000003 * 1000003; return faea(); }
+long faec() { long yaec; yaec = arg * 3 + 106; arg = yaec - yaec / 1000003 * 1000003; return faeb(); }
+long faed() { long yaed; yaed = arg * 3 + 107; arg = yaed - yaed / 1000003 * 1000003; return faec(); }
+long faee() { long yaee; yaee = arg * 3 + 108; arg = yaee - yaee / 1000003 * 1000003; return faed(); }
+long faef() { long yaef; yaef = arg * 3 + 109; arg = yaef - yaef / 1000003 * 1000003; return faee(); }
+long faeg() { long yaeg; yaeg = arg * 3 + 110; arg = yaeg - yaeg / 1000003 * 1000003; return faef(); }
+long faeh() { long yaeh; yaeh = arg * 3 + 111; arg = yaeh - yaeh / 1000003 * 1000003; return faeg(); }
+long faei() { long yaei; yaei = arg * 3 + 112; arg = yaei - yaei / 1000003 * 1000003; return faeh(); }
+long faej() { long yaej; yaej = arg * 3 + 113; arg = yaej - yaej / 1000003 * 1000003; return faei(); }
+long faek() { long yaek; yaek = arg * 3 + 114; arg = yaek - yaek / 1000003 * 1000003; return faej(); }
+long fael() { long yael; yael = arg * 3 + 115; arg = yael - yael / 1000003 * 1000003; return faek(); }
+long faem() { long yaem; yaem = arg * 3 + 116; arg = yaem - yaem / 1000003 * 1000003; return fael(); }
+long faen() { long yaen; yaen = arg * 3 + 117; arg = yaen - yaen / 1000003 * 1000003; return faem(); }
+long faeo() { long yaeo; yaeo = arg * 3 + 118; arg = yaeo - yaeo / 1000003 * 1000003; return faen(); }
+long faep() { long yaep; yaep = arg * 3 + 119; arg = yaep - yaep / 1000003 * 1000003; return faeo(); }
+long faeq() { long yaeq; yaeq = arg * 3 + 120; arg = yaeq - yaeq / 1000003 * 1000003; return faep(); }
+long faer() { long yaer; yaer = arg * 3 + 121; arg = yaer - yaer / 1000003 * 1000003; return faeq(); }
+long faes() { long yaes; yaes = arg * 3 + 122; arg = yaes - yaes / 1000003 * 1000003; return faer(); }
+long faet() { long yaet; yaet = arg * 3 + 123; arg = yaet - yaet / 1000003 * 1000003; return faes(); }
+long faeu() { long yaeu; yaeu = arg * 3 + 124; arg = yaeu - yaeu / 1000003 * 1000003; return faet(); }
+long faev() { long yaev; yaev = arg * 3 + 125; arg = yaev - yaev / 1000003 * 1000003; return faeu(); }
+long faew() { long yaew; yaew = arg * 3 + 126; arg = yaew - yaew / 1000003 * 1000003; return faev(); }
+long faex() { long yaex; yaex = arg * 3 + 127; arg = yaex - yaex / 1000003 * 1000003; return faew(); }
+long faey() { long yaey; yaey = arg * 3 + 128; arg = yaey - yaey / 1000003 * 1000003; return faex(); }
+long faez() { long yaez; yaez = arg * 3 + 129; arg = yaez - yaez / 1000003 * 1000003; return faey(); }
+long fafa() { long yafa; yafa = arg * 3 + 130; arg = yafa - yafa / 1000003 * 1000003; return faez(); }
+long fafb() { long yafb; yafb = arg * 3 + 131; arg = yafb - yafb / 1000003 * 1000003; return fafa(); }
+long fafc() { long yafc; yafc = arg * 3 + 132; arg = yafc - yafc / 1000003 * 1000003; return fafb(); }
+long fafd() { long yafd; yafd = arg * 3 + 133; arg = yafd - yafd / 1000003 * 1000003; return fafc(); }
+long fafe() { long yafe; yafe = arg * 3 + 134; arg = yafe - yafe / 1000003 * 1000003; return fafd(); }
+long faff() { long yaff; yaff = arg * 3 + 135; arg = yaff - yaff / 1000003 * 1000003; return fafe(); }
+long fafg() { long yafg; yafg = arg * 3 + 136; arg = yafg - yafg / 1000003 * 1000003; return faff(); }
+long fafh() { long yafh; yafh = arg * 3 + 137; arg = yafh - yafh / 1000003 * 1000003; return fafg(); }
+long fafi() { long yafi; yafi = arg * 3 + 138; arg = yafi - yafi / 1000003 * 1000003; return fafh(); }
+long fafj() { long yafj; yafj = arg * 3 + 139; arg = yafj - yafj / 1000003 * 1000003; return fafi(); }
+long fafk() { long yafk; yafk = arg * 3 + 140; arg = yafk - yafk / 1000003 * 1000003; return fafj(); }
+long fafl() { long yafl; yafl = arg * 3 + 141; arg = yafl - yafl / 1000003 * 1000003; return fafk(); }
+long fafm() { long yafm; yafm = arg * 3 + 142; arg = yafm - yafm / 1000003 * 1000003; return fafl(); }
+long fafn() { long yafn; yafn = arg * 3 + 143; arg = yafn - yafn / 1000003 * 1000003; return fafm(); }
+long fafo() { long yafo; yafo = arg * 3 + 144; arg = yafo - yafo / 1000003 * 1000003; return fafn(); }
+long fafp() { long yafp; yafp = arg * 3 + 145; arg = yafp - yafp / 1000003 * 1000003; return fafo(); }
+long fafq() { long yafq; yafq = arg * 3 + 146; arg = yafq - yafq / 1000003 * 1000003; return fafp(); }
+long fafr() { long yafr; yafr = arg * 3 + 147; arg = yafr - yafr / 1000003 * 1000003; return fafq(); }
+long fafs() { long yafs; yafs = arg * 3 + 148; arg = yafs - yafs / 1000003 * 1000003; return fafr(); }
+long faft() { long yaft; yaft = arg * 3 + 149; arg = yaft - yaft / 1000003 * 1000003; return fafs(); }
+long fafu() { long yafu; yafu = arg * 3 + 150; arg = yafu - yafu / 1000003 * 1000003; return faft(); }
+long fafv() { long yafv; yafv = arg * 3 + 151; arg = yafv - yafv / 1000003 * 1000003; return fafu(); }
+long fafw() { long yafw; yafw = arg * 3 + 152; arg = yafw - yafw / 1000003 * 1000003; return fafv(); }
+long fafx() { long yafx; yafx = arg * 3 + 153; arg = yafx - yafx / 1000003 * 1000003; return fafw(); }
+long fafy() { long yafy; yafy = arg * 3 + 154; arg = yafy - yafy / 1000003 * 1000003; return fafx(); }
+long fafz() { long yafz; yafz = arg * 3 + 155; arg = yafz - yafz / 1000003 * 1000003; return fafy(); }
+long faga() { long yaga; yaga = arg * 3 + 156; arg = yaga - yaga / 1000003 * 1000003; return fafz(); }
+long fagb() { long yagb; yagb = arg * 3 + 157; arg = yagb - yagb / 1000003 * 1000003; return faga(); }
+long fagc() { long yagc; yagc = arg * 3 + 158; arg = yagc - yagc / 1000003 * 1000003; return fagb(); }
+long fagd() { long yagd; yagd = arg * 3 + 159; arg = yagd - yagd / 1000003 * 1000003; return fagc(); }
+long fage() { long yage; yage = arg * 3 + 160; arg = yage - yage / 1000003 * 1000003; return fagd(); }
+long fagf() { long yagf; yagf = arg * 3 + 161; arg = yagf - yagf / 1000003 * 1000003; return fage(); }
+long fagg() { long yagg; yagg = arg * 3 + 162; arg = yagg - yagg / 1000003 * 1000003; return fagf(); }
+long fagh() { long yagh; yagh = arg * 3 + 163; arg = yagh - yagh / 1000003 * 1000003; return fagg(); }
+long fagi() { long yagi; yagi = arg * 3 + 164; arg = yagi - yagi / 1000003 * 1000003; return fagh(); }
+long fagj() { long yagj; yagj = arg * 3 + 165; arg = yagj - yagj / 1000003 * 1000003; return fagi(); }
+long fagk() { long yagk; yagk = arg * 3 + 166; arg = yagk - yagk / 1000003 * 1000003; return fagj(); }
+long fagl() { long yagl; yagl = arg * 3 + 167; arg = yagl - yagl / 1000003 * 1000003; return fagk(); }
+long fagm() { long yagm; yagm = arg * 3 + 168; arg = yagm - yagm / 1000003 * 1000003; return fagl(); }
+long fagn() { long yagn; yagn = arg * 3 + 169; arg = yagn - yagn / 1000003 * 1000003; return fagm(); }
+long fago() { long yago; yago = arg * 3 + 170; arg = yago - yago / 1000003 * 1000003; return fagn(); }
+long fagp() { long yagp; yagp = arg * 3 + 171; arg = yagp - yagp / 1000003 * 1000003; return fago(); }
+long fagq() { long yagq; yagq = arg * 3 + 172; arg = yagq - yagq / 1000003 * 1000003; return fagp(); }
+long fagr() { long yagr; yagr = arg * 3 + 173; arg = yagr - yagr / 1000003 * 1000003; return fagq(); }
+long fags() { long yags; yags = arg * 3 + 174; arg = yags - yags / 1000003 * 1000003; return fagr(); }
+long fagt() { long yagt; yagt = arg * 3 + 175; arg = yagt - yagt / 1000003 * 1000003; return fags(); }
+long fagu() { long yagu; yagu = arg * 3 + 176; arg = yagu - yagu / 1000003 * 1000003; return fagt(); }
+long fagv() { long yagv; yagv = arg * 3 + 177; arg = yagv - yagv / 1000003 * 1000003; return fagu(); }
+long fagw() { long yagw; yagw = arg * 3 + 178; arg = yagw - yagw / 1000003 * 1000003; return fagv(); }
+long fagx() { long yagx; yagx = arg * 3 + 179; arg = yagx - yagx / 1000003 * 1000003; return fagw(); }
+long fagy() { long yagy; yagy = arg * 3 + 180; arg = yagy - yagy / 1000003 * 1000003; return fagx(); }
+long fagz() { long yagz; yagz = arg * 3 + 181; arg = yagz - yagz / 1000003 * 1000003; return fagy(); }
+long faha() { long yaha; yaha = arg * 3 + 182; arg = yaha - yaha / 1000003 * 1000003; return fagz(); }
+long fahb() { long yahb; yahb = arg * 3 + 183; arg = yahb - yahb / 1000003 * 1000003; return faha(); }
+long fahc() { long yahc; yahc = arg * 3 + 184; arg = yahc - yahc / 1000003 * 1000003; return fahb(); }
+long fahd() { long yahd; yahd = arg * 3 + 185; arg = yahd - yahd / 1000003 * 1000003; return fahc(); }
+long fahe() { long yahe; yahe = arg * 3 + 186; arg = yahe - yahe / 1000003 * 1000003; return fahd(); }
+long fahf() { long yahf; yahf = arg * 3 + 187; arg = yahf - yahf / 1000003 * 1000003; return fahe(); }
+long fahg() { long yahg; yahg = arg * 3 + 188; arg = yahg - yahg / 1000003 * 1000003; return fahf(); }
+long fahh() { long yahh; yahh = arg * 3 + 189; arg = yahh - yahh / 1000003 * 1000003; return fahg(); }
+long fahi() { long yahi; yahi = arg * 3 + 190; arg = yahi - yahi / 1000003 * 1000003; return fahh(); }
+long fahj() { long yahj; yahj = arg * 3 + 191; arg = yahj - yahj / 1000003 * 1000003; return fahi(); }
+long fahk() { long yahk; yahk = arg * 3 + 192; arg = yahk - yahk / 1000003 * 1000003; return fahj(); }
+long fahl() { long yahl; yahl = arg * 3 + 193; arg = yahl - yahl / 1000003 * 1000003; return fahk(); }
+long fahm() { long yahm; yahm = arg * 3 + 194; arg = yahm - yahm / 1000003 * 1000003; return fahl(); }
+long fahn() { long yahn; yahn = arg * 3 + 195; arg = yahn - yahn / 1000003 * 1000003; return fahm(); }
+long faho() { long yaho; yaho = arg * 3 + 196; arg = yaho - yaho / 1000003 * 1000003; return fahn(); }
+long fahp() { long yahp; yahp = arg * 3 + 197; arg = yahp - yahp / 1000003 * 1000003; return faho(); }
+long fahq() { long yahq; yahq = arg * 3 + 198; arg = yahq - yahq / 1000003 * 1000003; return fahp(); }
+long fahr() { long yahr; yahr = arg * 3 + 199; arg = yahr - yahr / 1000003 * 1000003; return fahq(); }
+long fahs() { long yahs; yahs = arg * 3 + 200; arg = yahs - yahs / 1000003 * 1000003; return fahr(); }
+long faht() { long yaht; yaht = arg * 3 + 201; arg = yaht - yaht / 1000003 * 1000003; return fahs(); }
+long fahu() { long yahu; yahu = arg * 3 + 202; arg = yahu - yahu / 1000003 * 1000003; return faht(); }
+long fahv() { long yahv; yahv = arg * 3 + 203; arg = yahv - yahv / 1000003 * 1000003; return fahu(); }
+long fahw() { long yahw; yahw = arg * 3 + 204; arg = yahw - yahw / 1000003 * 1000003; return fahv(); }
+long fahx() { long yahx; yahx = arg * 3 + 205; arg = yahx - yahx / 1000003 * 1000003; return fahw(); }
+long fahy() { long yahy; yahy = arg * 3 + 206; arg = yahy - yahy / 1000003 * 1000003; return fahx(); }
+long fahz() { long yahz; yahz = arg * 3 + 207; arg = yahz - yahz / 1000003 * 1000003; return fahy(); }
+long faia() { long yaia; yaia = arg * 3 + 208; arg = yaia - yaia / 1000003 * 1000003; return fahz(); }
+long faib() { long yaib; yaib = arg * 3 + 209; arg = yaib - yaib / 1000003 * 1000003; return faia(); }
+long faic() { long yaic; yaic = arg * 3 + 210; arg = yaic - yaic / 1000003 * 1000003; return faib(); }
+long faid() { long yaid; yaid = arg * 3 + 211; arg = yaid - yaid / 1000003 * 1000003; return faic(); }
+long faie() { long yaie; yaie = arg * 3 + 212; arg = yaie - yaie / 1000003 * 1000003; return faid(); }
+long faif() { long yaif; yaif = arg * 3 + 213; arg = yaif - yaif / 1000003 * 1000003; return faie(); }
+long faig() { long yaig; yaig = arg * 3 + 214; arg = yaig - yaig / 1000003 * 1000003; return faif(); }
+long faih() { long yaih; yaih = arg * 3 + 215; arg = yaih - yaih / 1000003 * 1000003; return faig(); }
+long faii() { long yaii; yaii = arg * 3 + 216; arg = yaii - yaii / 1000003 * 1000003; return faih(); }
+long faij() { long yaij; yaij = arg * 3 + 217; arg = yaij - yaij / 1000003 * 1000003; return faii(); }
+long faik() { long yaik; yaik = arg * 3 + 218; arg = yaik - yaik / 1000003 * 1000003; return faij(); }
+long fail() { long yail; yail = arg * 3 + 219; arg = yail - yail / 1000003 * 1000003; return faik(); }
+long faim() { long yaim; yaim = arg * 3 + 220; arg = yaim - yaim / 1000003 * 1000003; return fail(); }
+long fain() { long yain; yain = arg * 3 + 221; arg = yain - yain / 1000003 * 1000003; return faim(); }
+long faio() { long yaio; yaio = arg * 3 + 222; arg = yaio - yaio / 1000003 * 1000003; return fain(); }
+long faip() { long yaip; yaip = arg * 3 + 223; arg = yaip - yaip / 1000003 * 1000003; return faio(); }
+long faiq() { long yaiq; yaiq = arg * 3 + 224; arg = yaiq - yaiq / 1000003 * 1000003; return faip(); }
+long fair() { long yair; yair = arg * 3 + 225; arg = yair - yair / 1000003 * 1000003; return faiq(); }
+long fais() { long yais; yais = arg * 3 + 226; arg = yais - yais / 1000003 * 1000003; return fair(); }
+long fait() { long yait; yait = arg * 3 + 227; arg = yait - yait / 1000003 * 1000003; return fais(); }
+long faiu() { long yaiu; yaiu = arg * 3 + 228; arg = yaiu - yaiu / 1000003 * 1000003; return fait(); }
+long faiv() { long yaiv; yaiv = arg * 3 + 229; arg = yaiv - yaiv / 1000003 * 1000003; return faiu(); }
+long faiw() { long yaiw; yaiw = arg * 3 + 230; arg = yaiw - yaiw / 1000003 * 1000003; return faiv(); }
+long faix() { long yaix; yaix = arg * 3 + 231; arg = yaix - yaix / 1000003 * 1000003; return faiw(); }
+long faiy() { long yaiy; yaiy = arg * 3 + 232; arg = yaiy - yaiy / 1000003 * 1000003; return faix(); }
+long faiz() { long yaiz; yaiz = arg * 3 + 233; arg = yaiz - yaiz / 1000003 * 1000003; return faiy(); }
+long faja() { long yaja; yaja = arg * 3 + 234; arg = yaja - yaja / 1000003 * 1000003; return faiz(); }
+long fajb() { long yajb; yajb = arg * 3 + 235; arg = yajb - yajb / 1000003 * 1000003; return faja(); }
+long fajc() { long yajc; yajc = arg * 3 + 236; arg = yajc - yajc / 1000003 * 1000003; return fajb(); }
+long fajd() { long yajd; yajd = arg * 3 + 237; arg = yajd - yajd / 1000003 * 1000003; return fajc(); }
+long faje() { long yaje; yaje = arg * 3 + 238; arg = yaje - yaje / 1000003 * 1000003; return fajd(); }
+long fajf() { long yajf; yajf = arg * 3 + 239; arg = yajf - yajf / 1000003 * 1000003; return faje(); }
+long fajg() { long yajg; yajg = arg * 3 + 240; arg = yajg - yajg / 1000003 * 1000003; return fajf(); }
+long fajh() { long yajh; yajh = arg * 3 + 241; arg = yajh - yajh / 1000003 * 1000003; return fajg(); }
+long faji() { long yaji; yaji = arg * 3 + 242; arg = yaji - yaji / 1000003 * 1000003; return fajh(); }
+long fajj() { long yajj; yajj = arg * 3 + 243; arg = yajj - yajj / 1000003 * 1000003; return faji(); }
+long fajk() { long yajk; yajk = arg * 3 + 244; arg = yajk - yajk / 1000003 * 1000003; return fajj(); }
+long fajl() { long yajl; yajl = arg * 3 + 245; arg = yajl - yajl / 1000003 * 1000003; return fajk(); }
+long fajm() { long yajm; yajm = arg * 3 + 246; arg = yajm - yajm / 1000003 * 1000003; return fajl(); }
+long fajn() { long yajn; yajn = arg * 3 + 247; arg = yajn - yajn / 1000003 * 1000003; return fajm(); }
+long fajo() { long yajo; yajo = arg * 3 + 248; arg = yajo - yajo / 1000003 * 1000003; return fajn(); }
+long fajp() { long yajp; yajp = arg * 3 + 249; arg = yajp - yajp / 1000003 * 1000003; return fajo(); }
+long fajq() { long yajq; yajq = arg * 3 + 250; arg = yajq - yajq / 1000003 * 1000003; return fajp(); }
+long fajr() { long yajr; yajr = arg * 3 + 251; arg = yajr - yajr / 1000003 * 1000003; return fajq(); }
+long fajs() { long yajs; yajs = arg * 3 + 252; arg = yajs - yajs / 1000003 * 1000003; return fajr(); }
+long fajt() { long yajt; yajt = arg * 3 + 253; arg = yajt - yajt / 1000003 * 1000003; return fajs(); }
+long faju() { long yaju; yaju = arg * 3 + 254; arg = yaju - yaju / 1000003 * 1000003; return fajt(); }
+long fajv() { long yajv; yajv = arg * 3 + 255; arg = yajv - yajv / 1000003 * 1000003; return faju(); }
+long fajw() { long yajw; yajw = arg * 3 + 256; arg = yajw - yajw / 1000003 * 1000003; return fajv(); }
+long fajx() { long yajx; yajx = arg * 3 + 257; arg = yajx - yajx / 1000003 * 1000003; return fajw(); }
+long fajy() { long yajy; yajy = arg * 3 + 258; arg = yajy - yajy / 1000003 * 1000003; return fajx(); }
+long fajz() { long yajz; yajz = arg * 3 + 259; arg = yajz - yajz / 1000003 * 1000003; return fajy(); }
+long faka() { long yaka; yaka = arg * 3 + 260; arg = yaka - yaka / 1000003 * 1000003; return fajz(); }
+long fakb() { long yakb; yakb = arg * 3 + 261; arg = yakb - yakb / 1000003 * 1000003; return faka(); }
+long fakc() { long yakc; yakc = arg * 3 + 262; arg = yakc - yakc / 1000003 * 1000003; return fakb(); }
+long fakd() { long yakd; yakd = arg * 3 + 263; arg = yakd - yakd / 1000003 * 1000003; return fakc(); }
+long fake() { long yake; yake = arg * 3 + 264; arg = yake - yake / 1000003 * 1000003; return fakd(); }
+long fakf() { long yakf; yakf = arg * 3 + 265; arg = yakf - yakf / 1000003 * 1000003; return fake(); }
+long fakg() { long yakg; yakg = arg * 3 + 266; arg = yakg - yakg / 1000003 * 1000003; return fakf(); }
+long fakh() { long yakh; yakh = arg * 3 + 267; arg = yakh - yakh / 1000003 * 1000003; return fakg(); }
+long faki() { long yaki; yaki = arg * 3 + 268; arg = yaki - yaki / 1000003 * 1000003; return fakh(); }
+long fakj() { long yakj; yakj = arg * 3 + 269; arg = yakj - yakj / 1000003 * 1000003; return faki(); }
+long fakk() { long yakk; yakk = arg * 3 + 270; arg = yakk - yakk / 1000003 * 1000003; return fakj(); }
+long fakl() { long yakl; yakl = arg * 3 + 271; arg = yakl - yakl / 1000003 * 1000003; return fakk(); }
+long fakm() { long yakm; yakm = arg * 3 + 272; arg = yakm - yakm / 1000003 * 1000003; return fakl(); }
+long fakn() { long yakn; yakn = arg * 3 + 273; arg = yakn - yakn / 1000003 * 1000003; return fakm(); }
+long fako() { long yako; yako = arg * 3 + 274; arg = yako - yako / 1000003 * 1000003; return fakn(); }
+long fakp() { long yakp; yakp = arg * 3 + 275; arg = yakp - yakp / 1000003 * 1000003; return fako(); }
+long fakq() { long yakq; yakq = arg * 3 + 276; arg = yakq - yakq / 1000003 * 1000003; return fakp(); }
+long fakr() { long yakr; yakr = arg * 3 + 277; arg = yakr - yakr / 1000003 * 1000003; return fakq(); }
+long faks() { long yaks; yaks = arg * 3 + 278; arg = yaks - yaks / 1000003 * 1000003; return fakr(); }
+long fakt() { long yakt; yakt = arg * 3 + 279; arg = yakt - yakt / 1000003 * 1000003; return faks(); }
+long faku() { long yaku; yaku = arg * 3 + 280; arg = yaku - yaku / 1000003 * 1000003; return fakt(); }
+long fakv() { long yakv; yakv = arg * 3 + 281; arg = yakv - yakv / 1000003 * 1000003; return faku(); }
+long fakw() { long yakw; yakw = arg * 3 + 282; arg = yakw - yakw / 1000003 * 1000003; return fakv(); }
+long fakx() { long yakx; yakx = arg * 3 + 283; arg = yakx - yakx / 1000003 * 1000003; return fakw(); }
+long faky() { long yaky; yaky = arg * 3 + 284; arg = yaky - yaky / 1000003 * 1000003; return fakx(); }
+long fakz() { long yakz; yakz = arg * 3 + 285; arg = yakz - yakz / 1000003 * 1000003; return faky(); }
+long fala() { long yala; yala = arg * 3 + 286; arg = yala - yala / 1000003 * 1000003; return fakz(); }
+long falb() { long yalb; yalb = arg * 3 + 287; arg = yalb - yalb / 1000003 * 1000003; return fala(); }
+long falc() { long yalc; yalc = arg * 3 + 288; arg = yalc - yalc / 1000003 * 1000003; return falb(); }
+long fald() { long yald; yald = arg * 3 + 289; arg = yald - yald / 1000003 * 1000003; return falc(); }
+long fale() { long yale; yale = arg * 3 + 290; arg = yale - yale / 1000003 * 1000003; return fald(); }
+long falf() { long yalf; yalf = arg * 3 + 291; arg = yalf - yalf / 1000003 * 1000003; return fale(); }
+long falg() { long yalg; yalg = arg * 3 + 292; arg = yalg - yalg / 1000003 * 1000003; return falf(); }
+long falh() { long yalh; yalh = arg * 3 + 293; arg = yalh - yalh / 1000003 * 1000003; return falg(); }
+long fali() { long yali; yali = arg * 3 + 294; arg = yali - yali / 1000003 * 1000003; return falh(); }
+long falj() { long yalj; yalj = arg * 3 + 295; arg = yalj - yalj / 1000003 * 1000003; return fali(); }
+long falk() { long yalk; yalk = arg * 3 + 296; arg = yalk - yalk / 1000003 * 1000003; return falj(); }
+long fall() { long yall; yall = arg * 3 + 297; arg = yall - yall / 1000003 * 1000003; return falk(); }
+long falm() { long yalm; yalm = arg * 3 + 298; arg = yalm - yalm / 1000003 * 1000003; return fall(); }
+long faln() { long yaln; yaln = arg * 3 + 299; arg = yaln - yaln / 1000003 * 1000003; return falm(); }
+long falo() { long yalo; yalo = arg * 3 + 300; arg = yalo - yalo / 1000003 * 1000003; return faln(); }
+long falp() { long yalp; yalp = arg * 3 + 301; arg = yalp - yalp / 1000003 * 1000003; return falo(); }
+long falq() { long yalq; yalq = arg * 3 + 302; arg = yalq - yalq / 1000003 * 1000003; return falp(); }
+long falr() { long yalr; yalr = arg * 3 + 303; arg = yalr - yalr / 1000003 * 1000003; return falq(); }
+long fals() { long yals; yals = arg * 3 + 304; arg = yals - yals / 1000003 * 1000003; return falr(); }
+long falt() { long yalt; yalt = arg * 3 + 305; arg = yalt - yalt / 1000003 * 1000003; return fals(); }
+long falu() { long yalu; yalu = arg * 3 + 306; arg = yalu - yalu / 1000003 * 1000003; return falt(); }
+long falv() { long yalv; yalv = arg * 3 + 307; arg = yalv - yalv / 1000003 * 1000003; return falu(); }
+long falw() { long yalw; yalw = arg * 3 + 308; arg = yalw - yalw / 1000003 * 1000003; return falv(); }
+long falx() { long yalx; yalx = arg * 3 + 309; arg = yalx - yalx / 1000003 * 1000003; return falw(); }
+long faly() { long yaly; yaly = arg * 3 + 310; arg = yaly - yaly / 1000003 * 1000003; return falx(); }
+long falz() { long yalz; yalz = arg * 3 + 311; arg = yalz - yalz / 1000003 * 1000003; return faly(); }
+long fama() { long yama; yama = arg * 3 + 312; arg = yama - yama / 1000003 * 1000003; return falz(); }
+long famb() { long yamb; yamb = arg * 3 + 313; arg = yamb - yamb / 1000003 * 1000003; return fama(); }
+long famc() { long yamc; yamc = arg * 3 + 314; arg = yamc - yamc / 1000003 * 1000003; return famb(); }
+long famd() { long yamd; yamd = arg * 3 + 315; arg = yamd - yamd / 1000003 * 1000003; return famc(); }
+long fame() { long yame; yame = arg * 3 + 316; arg = yame - yame / 1000003 * 1000003; return famd(); }
+long famf() { long yamf; yamf = arg * 3 + 317; arg = yamf - yamf / 1000003 * 1000003; return fame(); }
+long famg() { long yamg; yamg = arg * 3 + 318; arg = yamg - yamg / 1000003 * 1000003; return famf(); }
+long famh() { long yamh; yamh = arg * 3 + 319; arg = yamh - yamh / 1000003 * 1000003; return famg(); }
+long fami() { long yami; yami = arg * 3 + 320; arg = yami - yami / 1000003 * 1000003; return famh(); }
+long famj() { long yamj; yamj = arg * 3 + 321; arg = yamj - yamj / 1000003 * 1000003; return fami(); }
+long famk() { long yamk; yamk = arg * 3 + 322; arg = yamk - yamk / 1000003 * 1000003; return famj(); }
+long faml() { long yaml; yaml = arg * 3 + 323; arg = yaml - yaml / 1000003 * 1000003; return famk(); }
+long famm() { long yamm; yamm = arg * 3 + 324; arg = yamm - yamm / 1000003 * 1000003; return faml(); }
+long famn() { long yamn; yamn = arg * 3 + 325; arg = yamn - yamn / 1000003 * 1000003; return famm(); }
+long famo() { long yamo; yamo = arg * 3 + 326; arg = yamo - yamo / 1000003 * 1000003; return famn(); }
+long famp() { long yamp; yamp = arg * 3 + 327; arg = yamp - yamp / 1000003 * 1000003; return famo(); }
+long famq() { long yamq; yamq = arg * 3 + 328; arg = yamq - yamq / 1000003 * 1000003; return famp(); }
+long famr() { long yamr; yamr = arg * 3 + 329; arg = yamr - yamr / 1000003 * 1000003; return famq(); }
+long fams() { long yams; yams = arg * 3 + 330; arg = yams - yams / 1000003 * 1000003; return famr(); }
+long famt() { long yamt; yamt = arg * 3 + 331; arg = yamt - yamt / 1000003 * 1000003; return fams(); }
+long famu() { long yamu; yamu = arg * 3 + 332; arg = yamu - yamu / 1000003 * 1000003; return famt(); }
+long famv() { long yamv; yamv = arg * 3 + 333; arg = yamv - yamv / 1000003 * 1000003; return famu(); }
+long famw() { long yamw; yamw = arg * 3 + 334; arg = yamw - yamw / 1000003 * 1000003; return famv(); }
+long famx() { long yamx; yamx = arg * 3 + 335; arg = yamx - yamx / 1000003 * 1000003; return famw(); }
+long famy() { long yamy; yamy = arg * 3 + 336; arg = yamy - yamy / 1000003 * 1000003; return famx(); }
+long famz() { long yamz; yamz = arg * 3 + 337; arg = yamz - yamz / 1000003 * 1000003; return famy(); }
+long fana() { long yana; yana = arg * 3 + 338; arg = yana - yana / 1000003 * 1000003; return famz(); }
+long fanb() { long yanb; yanb = arg * 3 + 339; arg = yanb - yanb / 1000003 * 1000003; return fana(); }
+long fanc() { long yanc; yanc = arg * 3 + 340; arg = yanc - yanc / 1000003 * 1000003; return fanb(); }
+long fand() { long yand; yand = arg * 3 + 341; arg = yand - yand / 1000003 * 1000003; return fanc(); }
+long fane() { long yane; yane = arg * 3 + 342; arg = yane - yane / 1000003 * 1000003; return fand(); }
+long fanf() { long yanf; yanf = arg * 3 + 343; arg = yanf - yanf / 1000003 * 1000003; return fane(); }
+long fang() { long yang; yang = arg * 3 + 344; arg = yang - yang / 1000003 * 1000003; return fanf(); }
+long fanh() { long yanh; yanh = arg * 3 + 345; arg = yanh - yanh / 1000003 * 1000003; return fang(); }
+long fani() { long yani; yani = arg * 3 + 346; arg = yani - yani / 1000003 * 1000003; return fanh(); }
+long fanj() { long yanj; yanj = arg * 3 + 347; arg = yanj - yanj / 1000003 * 1000003; return fani(); }
+long fank() { long yank; yank = arg * 3 + 348; arg = yank - yank / 1000003 * 1000003; return fanj(); }
+long fanl() { long yanl; yanl = arg * 3 + 349; arg = yanl - yanl / 1000003 * 1000003; return fank(); }
+long fanm() { long yanm; yanm = arg * 3 + 350; arg = yanm - yanm / 1000003 * 1000003; return fanl(); }
+long fann() { long yann; yann = arg * 3 + 351; arg = yann - yann / 1000003 * 1000003; return fanm(); }
+long fano() { long yano; yano = arg * 3 + 352; arg = yano - yano / 1000003 * 1000003; return fann(); }
+long fanp() { long yanp; yanp = arg * 3 + 353; arg = yanp - yanp / 1000003 * 1000003; return fano(); }
+long fanq() { long yanq; yanq = arg * 3 + 354; arg = yanq - yanq / 1000003 * 1000003; return fanp(); }
+long fanr() { long yanr; yanr = arg * 3 + 355; arg = yanr - yanr / 1000003 * 1000003; return fanq(); }
+long fans() { long yans; yans = arg * 3 + 356; arg = yans - yans / 1000003 * 1000003; return fanr(); }
+long fant() { long yant; yant = arg * 3 + 357; arg = yant - yant / 1000003 * 1000003; return fans(); }
+long fanu() { long yanu; yanu = arg * 3 + 358; arg = yanu - yanu / 1000003 * 1000003; return fant(); }
+long fanv() { long yanv; yanv = arg * 3 + 359; arg = yanv - yanv / 1000003 * 1000003; return fanu(); }
+long fanw() { long yanw; yanw = arg * 3 + 360; arg = yanw - yanw / 1000003 * 1000003; return fanv(); }
+long fanx() { long yanx; yanx = arg * 3 + 361; arg = yanx - yanx / 1000003 * 1000003; return fanw(); }
+long fany() { long yany; yany = arg * 3 + 362; arg = yany - yany / 1000003 * 1000003; return fanx(); }
+long fanz() { long yanz; yanz = arg * 3 + 363; arg = yanz - yanz / 1000003 * 1000003; return fany(); }
+long faoa() { long yaoa; yaoa = arg * 3 + 364; arg = yaoa - yaoa / 1000003 * 1000003; return fanz(); }
+long faob() { long yaob; yaob = arg * 3 + 365; arg = yaob - yaob / 1000003 * 1000003; return faoa(); }
+long faoc() { long yaoc; yaoc = arg * 3 + 366; arg = yaoc - yaoc / 1000003 * 1000003; return faob(); }
+long faod() { long yaod; yaod = arg * 3 + 367; arg = yaod - yaod / 1000003 * 1000003; return faoc(); }
+long faoe() { long yaoe; yaoe = arg * 3 + 368; arg = yaoe - yaoe / 1000003 * 1000003; return faod(); }
+long faof() { long yaof; yaof = arg * 3 + 369; arg = yaof - yaof / 1000003 * 1000003; return faoe(); }
+long faog() { long yaog; yaog = arg * 3 + 370; arg = yaog - yaog / 1000003 * 1000003; return faof(); }
+long faoh() { long yaoh; yaoh = arg * 3 + 371; arg = yaoh - yaoh / 1000003 * 1000003; return faog(); }
+long faoi() { long yaoi; yaoi = arg * 3 + 372; arg = yaoi - yaoi / 1000003 * 1000003; return faoh(); }
+long faoj() { long yaoj; yaoj = arg * 3 + 373; arg = yaoj - yaoj / 1000003 * 1000003; return faoi(); }
+long faok() { long yaok; yaok = arg * 3 + 374; arg = yaok - yaok / 1000003 * 1000003; return faoj(); }
+long faol() { long yaol; yaol = arg * 3 + 375; arg = yaol - yaol / 1000003 * 1000003; return faok(); }
+long faom() { long yaom; yaom = arg * 3 + 376; arg = yaom - yaom / 1000003 * 1000003; return faol(); }
+long faon() { long yaon; yaon = arg * 3 + 377; arg = yaon - yaon / 1000003 * 1000003; return faom(); }
+long faoo() { long yaoo; yaoo = arg * 3 + 378; arg = yaoo - yaoo / 1000003 * 1000003; return faon(); }
+long faop() { long yaop; yaop = arg * 3 + 379; arg = yaop - yaop / 1000003 * 1000003; return faoo(); }
+long faoq() { long yaoq; yaoq = arg * 3 + 380; arg = yaoq - yaoq / 1000003 * 1000003; return faop(); }
+long faor() { long yaor; yaor = arg * 3 + 381; arg = yaor - yaor / 1000003 * 1000003; return faoq(); }
+long faos() { long yaos; yaos = arg * 3 + 382; arg = yaos - yaos / 1000003 * 1000003; return faor(); }
+long faot() { long yaot; yaot = arg * 3 + 383; arg = yaot - yaot / 1000003 * 1000003; return faos(); }
+long faou() { long yaou; yaou = arg * 3 + 384; arg = yaou - yaou / 1000003 * 1000003; return faot(); }
+long faov() { long yaov; yaov = arg * 3 + 385; arg = yaov - yaov / 1000003 * 1000003; return faou(); }
+long faow() { long yaow; yaow = arg * 3 + 386; arg = yaow - yaow / 1000003 * 1000003; return faov(); }
+long faox() { long yaox; yaox = arg * 3 + 387; arg = yaox - yaox / 1000003 * 1000003; return faow(); }
+long faoy() { long yaoy; yaoy = arg * 3 + 388; arg = yaoy - yaoy / 1000003 * 1000003; return faox(); }
+long faoz() { long yaoz; yaoz = arg * 3 + 389; arg = yaoz - yaoz / 1000003 * 1000003; return faoy(); }
+long fapa() { long yapa; yapa = arg * 3 + 390; arg = yapa - yapa / 1000003 * 1000003; return faoz(); }
+long fapb() { long yapb; yapb = arg * 3 + 391; arg = yapb - yapb / 1000003 * 1000003; return fapa(); }
+long fapc() { long yapc; yapc = arg * 3 + 392; arg = yapc - yapc / 1000003 * 1000003; return fapb(); }
+long fapd() { long yapd; yapd = arg * 3 + 393; arg = yapd - yapd / 1000003 * 1000003; return fapc(); }
+long fape() { long yape; yape = arg * 3 + 394; arg = yape - yape / 1000003 * 1000003; return fapd(); }
+long fapf() { long yapf; yapf = arg * 3 + 395; arg = yapf - yapf / 1000003 * 1000003; return fape(); }
+long fapg() { long yapg; yapg = arg * 3 + 396; arg = yapg - yapg / 1000003 * 1000003; return fapf(); }
+long faph() { long yaph; yaph = arg * 3 + 397; arg = yaph - yaph / 1000003 * 1000003; return fapg(); }
+long fapi() { long yapi; yapi = arg * 3 + 398; arg = yapi - yapi / 1000003 * 1000003; return faph(); }
+long fapj() { long yapj; yapj = arg * 3 + 399; arg = yapj - yapj / 1000003 * 1000003; return fapi(); }
+long fapk() { long yapk; yapk = arg * 3 + 400; arg = yapk - yapk / 1000003 * 1000003; return fapj(); }
+long fapl() { long yapl; yapl = arg * 3 + 401; arg = yapl - yapl / 1000003 * 1000003; return fapk(); }
+long fapm() { long yapm; yapm = arg * 3 + 402; arg = yapm - yapm / 1000003 * 1000003; return fapl(); }
+long fapn() { long yapn; yapn = arg * 3 + 403; arg = yapn - yapn / 1000003 * 1000003; return fapm(); }
+long fapo() { long yapo; yapo = arg * 3 + 404; arg = yapo - yapo / 1000003 * 1000003; return fapn(); }
+long fapp() { long yapp; yapp = arg * 3 + 405; arg = yapp - yapp / 1000003 * 1000003; return fapo(); }
+long fapq() { long yapq; yapq = arg * 3 + 406; arg = yapq - yapq / 1000003 * 1000003; return fapp(); }
+long fapr() { long yapr; yapr = arg * 3 + 407; arg = yapr - yapr / 1000003 * 1000003; return fapq(); }
+long faps() { long yaps; yaps = arg * 3 + 408; arg = yaps - yaps / 1000003 * 1000003; return fapr(); }
+long fapt() { long yapt; yapt = arg * 3 + 409; arg = yapt - yapt / 1000003 * 1000003; return faps(); }
+long fapu() { long yapu; yapu = arg * 3 + 410; arg = yapu - yapu / 1000003 * 1000003; return fapt(); }
+long fapv() { long yapv; yapv = arg * 3 + 411; arg = yapv - yapv / 1000003 * 1000003; return fapu(); }
+long fapw() { long yapw; yapw = arg * 3 + 412; arg = yapw - yapw / 1000003 * 1000003; return fapv(); }
+long fapx() { long yapx; yapx = arg * 3 + 413; arg = yapx - yapx / 1000003 * 1000003; return fapw(); }
+long fapy() { long yapy; yapy = arg * 3 + 414; arg = yapy - yapy / 1000003 * 1000003; return fapx(); }
+long fapz() { long yapz; yapz = arg * 3 + 415; arg = yapz - yapz / 1000003 * 1000003; return fapy(); }
+long faqa() { long yaqa; yaqa = arg * 3 + 416; arg = yaqa - yaqa / 1000003 * 1000003; return fapz(); }
+long faqb() { long yaqb; yaqb = arg * 3 + 417; arg = yaqb - yaqb / 1000003 * 1000003; return faqa(); }
+long faqc() { long yaqc; yaqc = arg * 3 + 418; arg = yaqc - yaqc / 1000003 * 1000003; return faqb(); }
+long faqd() { long yaqd; yaqd = arg * 3 + 419; arg = yaqd - yaqd / 1000003 * 1000003; return faqc(); }
+long faqe() { long yaqe; yaqe = arg * 3 + 420; arg = yaqe - yaqe / 1000003 * 1000003; return faqd(); }
+long faqf() { long yaqf; yaqf = arg * 3 + 421; arg = yaqf - yaqf / 1000003 * 1000003; return faqe(); }
+long faqg() { long yaqg; yaqg = arg * 3 + 422; arg = yaqg - yaqg / 1000003 * 1000003; return faqf(); }
+long faqh() { long yaqh; yaqh = arg * 3 + 423; arg = yaqh - yaqh / 1000003 * 1000003; return faqg(); }
+long faqi() { long yaqi; yaqi = arg * 3 + 424; arg = yaqi - yaqi / 1000003 * 1000003; return faqh(); }
+long faqj() { long yaqj; yaqj = arg * 3 + 425; arg = yaqj - yaqj / 1000003 * 1000003; return faqi(); }
+long faqk() { long yaqk; yaqk = arg * 3 + 426; arg = yaqk - yaqk / 1000003 * 1000003; return faqj(); }
+long faql() { long yaql; yaql = arg * 3 + 427; arg = yaql - yaql / 1000003 * 1000003; return faqk(); }
+long faqm() { long yaqm; yaqm = arg * 3 + 428; arg = yaqm - yaqm / 1000003 * 1000003; return faql(); }
+long faqn() { long yaqn; yaqn = arg * 3 + 429; arg = yaqn - yaqn / 1000003 * 1000003; return faqm(); }
+long faqo() { long yaqo; yaqo = arg * 3 + 430; arg = yaqo - yaqo / 1000003 * 1000003; return faqn(); }
+long faqp() { long yaqp; yaqp = arg * 3 + 431; arg = yaqp - yaqp / 1000003 * 1000003; return faqo(); }
+long faqq() { long yaqq; yaqq = arg * 3 + 432; arg = yaqq - yaqq / 1000003 * 1000003; return faqp(); }
+long faqr() { long yaqr; yaqr = arg * 3 + 433; arg = yaqr - yaqr / 1000003 * 1000003; return faqq(); }
+long faqs() { long yaqs; yaqs = arg * 3 + 434; arg = yaqs - yaqs / 1000003 * 1000003; return faqr(); }
+long faqt() { long yaqt; yaqt = arg * 3 + 435; arg = yaqt - yaqt / 1000003 * 1000003; return faqs(); }
+long faqu() { long yaqu; yaqu = arg * 3 + 436; arg = yaqu - yaqu / 1000003 * 1000003; return faqt(); }
+long faqv() { long yaqv; yaqv = arg * 3 + 437; arg = yaqv - yaqv / 1000003 * 1000003; return faqu(); }
+long faqw() { long yaqw; yaqw = arg * 3 + 438; arg = yaqw - yaqw / 1000003 * 1000003; return faqv(); }
+long faqx() { long yaqx; yaqx = arg * 3 + 439; arg = yaqx - yaqx / 1000003 * 1000003; return faqw(); }
+long faqy() { long yaqy; yaqy = arg * 3 + 440; arg = yaqy - yaqy / 1000003 * 1000003; return faqx(); }
+long faqz() { long yaqz; yaqz = arg * 3 + 441; arg = yaqz - yaqz / 1000003 * 1000003; return faqy(); }
+long fara() { long yara; yara = arg * 3 + 442; arg = yara - yara / 1000003 * 1000003; return faqz(); }
+long farb() { long yarb; yarb = arg * 3 + 443; arg = yarb - yarb / 1000003 * 1000003; return fara(); }
+long farc() { long yarc; yarc = arg * 3 + 444; arg = yarc - yarc / 1000003 * 1000003; return farb(); }
+long fard() { long yard; yard = arg * 3 + 445; arg = yard - yard / 1000003 * 1000003; return farc(); }
+long fare() { long yare; yare = arg * 3 + 446; arg = yare - yare / 1000003 * 1000003; return fard(); }
+long farf() { long yarf; yarf = arg * 3 + 447; arg = yarf - yarf / 1000003 * 1000003; return fare(); }
+long farg() { long yarg; yarg = arg * 3 + 448; arg = yarg - yarg / 1000003 * 1000003; return farf(); }
+long farh() { long yarh; yarh = arg * 3 + 449; arg = yarh - yarh / 1000003 * 1000003; return farg(); }
+long fari() { long yari; yari = arg * 3 + 450; arg = yari - yari / 1000003 * 1000003; return farh(); }
+long farj() { long yarj; yarj = arg * 3 + 451; arg = yarj - yarj / 1000003 * 1000003; return fari(); }
+long fark() { long yark; yark = arg * 3 + 452; arg = yark - yark / 1000003 * 1000003; return farj(); }
+long farl() { long yarl; yarl = arg * 3 + 453; arg = yarl - yarl / 1000003 * 1000003; return fark(); }
+long farm() { long yarm; yarm = arg * 3 + 454; arg = yarm - yarm / 1000003 * 1000003; return farl(); }
+long farn() { long yarn; yarn = arg * 3 + 455; arg = yarn - yarn / 1000003 * 1000003; return farm(); }
+long faro() { long yaro; yaro = arg * 3 + 456; arg = yaro - yaro / 1000003 * 1000003; return farn(); }
+long farp() { long yarp; yarp = arg * 3 + 457; arg = yarp - yarp / 1000003 * 1000003; return faro(); }
+long farq() { long yarq; yarq = arg * 3 + 458; arg = yarq - yarq / 1000003 * 1000003; return farp(); }
+long farr() { long yarr; yarr = arg * 3 + 459; arg = yarr - yarr / 1000003 * 1000003; return farq(); }
+long fars() { long yars; yars = arg * 3 + 460; arg = yars - yars / 1000003 * 1000003; return farr(); }
+long fart() { long yart; yart = arg * 3 + 461; arg = yart - yart / 1000003 * 1000003; return fars(); }
+long faru() { long yaru; yaru = arg * 3 + 462; arg = yaru - yaru / 1000003 * 1000003; return fart(); }
+long farv() { long yarv; yarv = arg * 3 + 463; arg = yarv - yarv / 1000003 * 1000003; return faru(); }
+long farw() { long yarw; yarw = arg * 3 + 464; arg = yarw - yarw / 1000003 * 1000003; return farv(); }
+long farx() { long yarx; yarx = arg * 3 + 465; arg = yarx - yarx / 1000003 * 1000003; return farw(); }
+long fary() { long yary; yary = arg * 3 + 466; arg = yary - yary / 1000003 * 1000003; return farx(); }
+long farz() { long yarz; yarz = arg * 3 + 467; arg = yarz - yarz / 1000003 * 1000003; return fary(); }
+long fasa() { long yasa; yasa = arg * 3 + 468; arg = yasa - yasa / 1000003 * 1000003; return farz(); }
+long fasb() { long yasb; yasb = arg * 3 + 469; arg = yasb - yasb / 1000003 * 1000003; return fasa(); }
+long fasc() { long yasc; yasc = arg * 3 + 470; arg = yasc - yasc / 1000003 * 1000003; return fasb(); }
+long fasd() { long yasd; yasd = arg * 3 + 471; arg = yasd - yasd / 1000003 * 1000003; return fasc(); }
+long fase() { long yase; yase = arg * 3 + 472; arg = yase - yase / 1000003 * 1000003; return fasd(); }
+long fasf() { long yasf; yasf = arg * 3 + 473; arg = yasf - yasf / 1000003 * 1000003; return fase(); }
+long fasg() { long yasg; yasg = arg * 3 + 474; arg = yasg - yasg / 1000003 * 1000003; return fasf(); }
+long fash() { long yash; yash = arg * 3 + 475; arg = yash - yash / 1000003 * 1000003; return fasg(); }
+long fasi() { long yasi; yasi = arg * 3 + 476; arg = yasi - yasi / 1000003 * 1000003; return fash(); }
+long fasj() { long yasj; yasj = arg * 3 + 477; arg = yasj - yasj / 1000003 * 1000003; return fasi(); }
+long fask() { long yask; yask = arg * 3 + 478; arg = yask - yask / 1000003 * 1000003; return fasj(); }
+long fasl() { long yasl; yasl = arg * 3 + 479; arg = yasl - yasl / 1000003 * 1000003; return fask(); }
+long fasm() { long yasm; yasm = arg * 3 + 480; arg = yasm - yasm / 1000003 * 1000003; return fasl(); }
+long fasn() { long yasn; yasn = arg * 3 + 481; arg = yasn - yasn / 1000003 * 1000003; return fasm(); }
+long faso() { long yaso; yaso = arg * 3 + 482; arg = yaso - yaso / 1000003 * 1000003; return fasn(); }
+long fasp() { long yasp; yasp = arg * 3 + 483; arg = yasp - yasp / 1000003 * 1000003; return faso(); }
+long fasq() { long yasq; yasq = arg * 3 + 484; arg = yasq - yasq / 1000003 * 1000003; return fasp(); }
+long fasr() { long yasr; yasr = arg * 3 + 485; arg = yasr - yasr / 1000003 * 1000003; return fasq(); }
+long fass() { long yass; yass = arg * 3 + 486; arg = yass - yass / 1000003 * 1000003; return fasr(); }
+long fast() { long yast; yast = arg * 3 + 487; arg = yast - yast / 1000003 * 1000003; return fass(); }
+long fasu() { long yasu; yasu = arg * 3 + 488; arg = yasu - yasu / 1000003 * 1000003; return fast(); }
+long fasv() { long yasv; yasv = arg * 3 + 489; arg = yasv - yasv / 1000003 * 1000003; return fasu(); }
+long fasw() { long yasw; yasw = arg * 3 + 490; arg = yasw - yasw / 1000003 * 1000003; return fasv(); }
+long fasx() { long yasx; yasx = arg * 3 + 491; arg = yasx - yasx / 1000003 * 1000003; return fasw(); }
+long fasy() { long yasy; yasy = arg * 3 + 492; arg = yasy - yasy / 1000003 * 1000003; return fasx(); }
+long fasz() { long yasz; yasz = arg * 3 + 493; arg = yasz - yasz / 1000003 * 1000003; return fasy(); }
+long fata() { long yata; yata = arg * 3 + 494; arg = yata - yata / 1000003 * 1000003; return fasz(); }
+long fatb() { long yatb; yatb = arg * 3 + 495; arg = yatb - yatb / 1000003 * 1000003; return fata(); }
+long fatc() { long yatc; yatc = arg * 3 + 496; arg = yatc - yatc / 1000003 * 1000003; return fatb(); }
+long fatd() { long yatd; yatd = arg * 3 + 497; arg = yatd - yatd / 1000003 * 1000003; return fatc(); }
+long fate() { long yate; yate = arg * 3 + 498; arg = yate - yate / 1000003 * 1000003; return fatd(); }
+long fatf() { long yatf; yatf = arg * 3 + 499; arg = yatf - yatf / 1000003 * 1000003; return fate(); }
+long fatg() { long yatg; yatg = arg * 3 + 500; arg = yatg - yatg / 1000003 * 1000003; return fatf(); }
+long fath() { long yath; yath = arg * 3 + 501; arg = yath - yath / 1000003 * 1000003; return fatg(); }
+long fati() { long yati; yati = arg * 3 + 502; arg = yati - yati / 1000003 * 1000003; return fath(); }
+long fatj() { long yatj; yatj = arg * 3 + 503; arg = yatj - yatj / 1000003 * 1000003; return fati(); }
+long fatk() { long yatk; yatk = arg * 3 + 504; arg = yatk - yatk / 1000003 * 1000003; return fatj(); }
+long fatl() { long yatl; yatl = arg * 3 + 505; arg = yatl - yatl / 1000003 * 1000003; return fatk(); }
+long fatm() { long yatm; yatm = arg * 3 + 506; arg = yatm - yatm / 1000003 * 1000003; return fatl(); }
+long fatn() { long yatn; yatn = arg * 3 + 507; arg = yatn - yatn / 1000003 * 1000003; return fatm(); }
+long fato() { long yato; yato = arg * 3 + 508; arg = yato - yato / 1000003 * 1000003; return fatn(); }
+long fatp() { long yatp; yatp = arg * 3 + 509; arg = yatp - yatp / 1000003 * 1000003; return fato(); }
+long fatq() { long yatq; yatq = arg * 3 + 510; arg = yatq - yatq / 1000003 * 1000003; return fatp(); }
+long fatr() { long yatr; yatr = arg * 3 + 511; arg = yatr - yatr / 1000003 * 1000003; return fatq(); }
+long fats() { long yats; yats = arg * 3 + 512; arg = yats - yats / 1000003 * 1000003; return fatr(); }
+long fatt() { long yatt; yatt = arg * 3 + 513; arg = yatt - yatt / 1000003 * 1000003; return fats(); }
+long fatu() { long yatu; yatu = arg * 3 + 514; arg = yatu - yatu / 1000003 * 1000003; return fatt(); }
+long fatv() { long yatv; yatv = arg * 3 + 515; arg = yatv - yatv / 1000003 * 1000003; return fatu(); }
+long fatw() { long yatw; yatw = arg * 3 + 516; arg = yatw - yatw / 1000003 * 1000003; return fatv(); }
+long fatx() { long yatx; yatx = arg * 3 + 517; arg = yatx - yatx / 1000003 * 1000003; return fatw(); }
+long faty() { long yaty; yaty = arg * 3 + 518; arg = yaty - yaty / 1000003 * 1000003; return fatx(); }
+long fatz() { long yatz; yatz = arg * 3 + 519; arg = yatz - yatz / 1000003 * 1000003; return faty(); }
+long faua() { long yaua; yaua = arg * 3 + 520; arg = yaua - yaua / 1000003 * 1000003; return fatz(); }
+long faub() { long yaub; yaub = arg * 3 + 521; arg = yaub - yaub / 1000003 * 1000003; return faua(); }
+long fauc() { long yauc; yauc = arg * 3 + 522; arg = yauc - yauc / 1000003 * 1000003; return faub(); }
+long faud() { long yaud; yaud = arg * 3 + 523; arg = yaud - yaud / 1000003 * 1000003; return fauc(); }
+long faue() { long yaue; yaue = arg * 3 + 524; arg = yaue - yaue / 1000003 * 1000003; return faud(); }
+long fauf() { long yauf; yauf = arg * 3 + 525; arg = yauf - yauf / 1000003 * 1000003; return faue(); }
+long faug() { long yaug; yaug = arg * 3 + 526; arg = yaug - yaug / 1000003 * 1000003; return fauf(); }
+long fauh() { long yauh; yauh = arg * 3 + 527; arg = yauh - yauh / 1000003 * 1000003; return faug(); }
+long faui() { long yaui; yaui = arg * 3 + 528; arg = yaui - yaui / 1000003 * 1000003; return fauh(); }
+long fauj() { long yauj; yauj = arg * 3 + 529; arg = yauj - yauj / 1000003 * 1000003; return faui(); }
+long fauk() { long yauk; yauk = arg * 3 + 530; arg = yauk - yauk / 1000003 * 1000003; return fauj(); }
+long faul() { long yaul; yaul = arg * 3 + 531; arg = yaul - yaul / 1000003 * 1000003; return fauk(); }
+long faum() { long yaum; yaum = arg * 3 + 532; arg = yaum - yaum / 1000003 * 1000003; return faul(); }
+long faun() { long yaun; yaun = arg * 3 + 533; arg = yaun - yaun / 1000003 * 1000003; return faum(); }
+long fauo() { long yauo; yauo = arg * 3 + 534; arg = yauo - yauo / 1000003 * 1000003; return faun(); }
+long faup() { long yaup; yaup = arg * 3 + 535; arg = yaup - yaup / 1000003 * 1000003; return fauo(); }
+long fauq() { long yauq; yauq = arg * 3 + 536; arg = yauq - yauq / 1000003 * 1000003; return faup(); }
+long faur() { long yaur; yaur = arg * 3 + 537; arg = yaur - yaur / 1000003 * 1000003; return fauq(); }
+long faus() { long yaus; yaus = arg * 3 + 538; arg = yaus - yaus / 1000003 * 1000003; return faur(); }
+long faut() { long yaut; yaut = arg * 3 + 539; arg = yaut - yaut / 1000003 * 1000003; return faus(); }
+long fauu() { long yauu; yauu = arg * 3 + 540; arg = yauu - yauu / 1000003 * 1000003; return faut(); }
+long fauv() { long yauv; yauv = arg * 3 + 541; arg = yauv - yauv / 1000003 * 1000003; return fauu(); }
+long fauw() { long yauw; yauw = arg * 3 + 542; arg = yauw - yauw / 1000003 * 1000003; return fauv(); }
+long faux() { long yaux; yaux = arg * 3 + 543; arg = yaux - yaux / 1000003 * 1000003; return fauw(); }
+long fauy() { long yauy; yauy = arg * 3 + 544; arg = yauy - yauy / 1000003 * 1000003; return faux(); }
+long fauz() { long yauz; yauz = arg * 3 + 545; arg = yauz - yauz / 1000003 * 1000003; return fauy(); }
+long fava() { long yava; yava = arg * 3 + 546; arg = yava - yava / 1000003 * 1000003; return fauz(); }
+long favb() { long yavb; yavb = arg * 3 + 547; arg = yavb - yavb / 1000003 * 1000003; return fava(); }
+long favc() { long yavc; yavc = arg * 3 + 548; arg = yavc - yavc / 1000003 * 1000003; return favb(); }
+long favd() { long yavd; yavd = arg * 3 + 549; arg = yavd - yavd / 1000003 * 1000003; return favc(); }
+long fave() { long yave; yave = arg * 3 + 550; arg = yave - yave / 1000003 * 1000003; return favd(); }
+long favf() { long yavf; yavf = arg * 3 + 551; arg = yavf - yavf / 1000003 * 1000003; return fave(); }
+long favg() { long yavg; yavg = arg * 3 + 552; arg = yavg - yavg / 1000003 * 1000003; return favf(); }
+long favh() { long yavh; yavh = arg * 3 + 553; arg = yavh - yavh / 1000003 * 1000003; return favg(); }
+long favi() { long yavi; yavi = arg * 3 + 554; arg = yavi - yavi / 1000003 * 1000003; return favh(); }
+long favj() { long yavj; yavj = arg * 3 + 555; arg = yavj - yavj / 1000003 * 1000003; return favi(); }
+long favk() { long yavk; yavk = arg * 3 + 556; arg = yavk - yavk / 1000003 * 1000003; return favj(); }
+long favl() { long yavl; yavl = arg * 3 + 557; arg = yavl - yavl / 1000003 * 1000003; return favk(); }
+long favm() { long yavm; yavm = arg * 3 + 558; arg = yavm - yavm / 1000003 * 1000003; return favl(); }
+long favn() { long yavn; yavn = arg * 3 + 559; arg = yavn - yavn / 1000003 * 1000003; return favm(); }
+long favo() { long yavo; yavo = arg * 3 + 560; arg = yavo - yavo / 1000003 * 1000003; return favn(); }
+long favp() { long yavp; yavp = arg * 3 + 561; arg = yavp - yavp / 1000003 * 1000003; return favo(); }
+long favq() { long yavq; yavq = arg * 3 + 562; arg = yavq - yavq / 1000003 * 1000003; return favp(); }
+long favr() { long yavr; yavr = arg * 3 + 563; arg = yavr - yavr / 1000003 * 1000003; return favq(); }
+long favs() { long yavs; yavs = arg * 3 + 564; arg = yavs - yavs / 1000003 * 1000003; return favr(); }
+long favt() { long yavt; yavt = arg * 3 + 565; arg = yavt - yavt / 1000003 * 1000003; return favs(); }
+long favu() { long yavu; yavu = arg * 3 + 566; arg = yavu - yavu / 1000003 * 1000003; return favt(); }
+long favv() { long yavv; yavv = arg * 3 + 567; arg = yavv - yavv / 1000003 * 1000003; return favu(); }
+long favw() { long yavw; yavw = arg * 3 + 568; arg = yavw - yavw / 1000003 * 1000003; return favv(); }
+long favx() { long yavx; yavx = arg * 3 + 569; arg = yavx - yavx / 1000003 * 1000003; return favw(); }
+long favy() { long yavy; yavy = arg * 3 + 570; arg = yavy - yavy / 1000003 * 1000003; return favx(); }
+long favz() { long yavz; yavz = arg * 3 + 571; arg = yavz - yavz / 1000003 * 1000003; return favy(); }
+long fawa() { long yawa; yawa = arg * 3 + 572; arg = yawa - yawa / 1000003 * 1000003; return favz(); }
+long fawb() { long yawb; yawb = arg * 3 + 573; arg = yawb - yawb / 1000003 * 1000003; return fawa(); }
+long fawc() { long yawc; yawc = arg * 3 + 574; arg = yawc - yawc / 1000003 * 1000003; return fawb(); }
+long fawd() { long yawd; yawd = arg * 3 + 575; arg = yawd - yawd / 1000003 * 1000003; return fawc(); }
+long fawe() { long yawe; yawe = arg * 3 + 576; arg = yawe - yawe / 1000003 * 1000003; return fawd(); }
+long fawf() { long yawf; yawf = arg * 3 + 577; arg = yawf - yawf / 1000003 * 1000003; return fawe(); }
+long fawg() { long yawg; yawg = arg * 3 + 578; arg = yawg - yawg / 1000003 * 1000003; return fawf(); }
+long fawh() { long yawh; yawh = arg * 3 + 579; arg = yawh - yawh / 1000003 * 1000003; return fawg(); }
+long fawi() { long yawi; yawi = arg * 3 + 580; arg = yawi - yawi / 1000003 * 1000003; return fawh(); }
+long fawj() { long yawj; yawj = arg * 3 + 581; arg = yawj - yawj / 1000003 * 1000003; return fawi(); }
+long fawk() { long yawk; yawk = arg * 3 + 582; arg = yawk - yawk / 1000003 * 1000003; return fawj(); }
+long fawl() { long yawl; yawl = arg * 3 + 583; arg = yawl - yawl / 1000003 * 1000003; return fawk(); }
+long fawm() { long yawm; yawm = arg * 3 + 584; arg = yawm - yawm / 1000003 * 1000003; return fawl(); }
+long fawn() { long yawn; yawn = arg * 3 + 585; arg = yawn - yawn / 1000003 * 1000003; return fawm(); }
+long fawo() { long yawo; yawo = arg * 3 + 586; arg = yawo - yawo / 1000003 * 1000003; return fawn(); }
+long fawp() { long yawp; yawp = arg * 3 + 587; arg = yawp - yawp / 1000003 * 1000003; return fawo(); }
+long fawq() { long yawq; yawq = arg * 3 + 588; arg = yawq - yawq / 1000003 * 1000003; return fawp(); }
+long fawr() { long yawr; yawr = arg * 3 + 589; arg = yawr - yawr / 1000003 * 1000003; return fawq(); }
+long faws() { long yaws; yaws = arg * 3 + 590; arg = yaws - yaws / 1000003 * 1000003; return fawr(); }
+long fawt() { long yawt; yawt = arg * 3 + 591; arg = yawt - yawt / 1000003 * 1000003; return faws(); }
+long fawu() { long yawu; yawu = arg * 3 + 592; arg = yawu - yawu / 1000003 * 1000003; return fawt(); }
+long fawv() { long yawv; yawv = arg * 3 + 593; arg = yawv - yawv / 1000003 * 1000003; return fawu(); }
+long faww() { long yaww; yaww = arg * 3 + 594; arg = yaww - yaww / 1000003 * 1000003; return fawv(); }
+long fawx() { long yawx; yawx = arg * 3 + 595; arg = yawx - yawx / 1000003 * 1000003; return faww(); }
+long fawy() { long yawy; yawy = arg * 3 + 596; arg = yawy - yawy / 1000003 * 1000003; return fawx(); }
+long fawz() { long yawz; yawz = arg * 3 + 597; arg = yawz - yawz / 1000003 * 1000003; return fawy(); }
+long faxa() { long yaxa; yaxa = arg * 3 + 598; arg = yaxa - yaxa / 1000003 * 1000003; return fawz(); }
+long faxb() { long yaxb; yaxb = arg * 3 + 599; arg = yaxb - yaxb / 1000003 * 1000003; return faxa(); }
+long faxc() { long yaxc; yaxc = arg * 3 + 600; arg = yaxc - yaxc / 1000003 * 1000003; return faxb(); }
+long faxd() { long yaxd; yaxd = arg * 3 + 601; arg = yaxd - yaxd / 1000003 * 1000003; return faxc(); }
+long faxe() { long yaxe; yaxe = arg * 3 + 602; arg = yaxe - yaxe / 1000003 * 1000003; return faxd(); }
+long faxf() { long yaxf; yaxf = arg * 3 + 603; arg = yaxf - yaxf / 1000003 * 1000003; return faxe(); }
+long faxg() { long yaxg; yaxg = arg * 3 + 604; arg = yaxg - yaxg / 1000003 * 1000003; return faxf(); }
+long faxh() { long yaxh; yaxh = arg * 3 + 605; arg = yaxh - yaxh / 1000003 * 1000003; return faxg(); }
+long faxi() { long yaxi; yaxi = arg * 3 + 606; arg = yaxi - yaxi / 1000003 * 1000003; return faxh(); }
+long faxj() { long yaxj; yaxj = arg * 3 + 607; arg = yaxj - yaxj / 1000003 * 1000003; return faxi(); }
+long faxk() { long yaxk; yaxk = arg * 3 + 608; arg = yaxk - yaxk / 1000003 * 1000003; return faxj(); }
+long faxl() { long yaxl; yaxl = arg * 3 + 609; arg = yaxl - yaxl / 1000003 * 1000003; return faxk(); }
+long faxm() { long yaxm; yaxm = arg * 3 + 610; arg = yaxm - yaxm / 1000003 * 1000003; return faxl(); }
+long faxn() { long yaxn; yaxn = arg * 3 + 611; arg = yaxn - yaxn / 1000003 * 1000003; return faxm(); }
+long faxo() { long yaxo; yaxo = arg * 3 + 612; arg = yaxo - yaxo / 1000003 * 1000003; return faxn(); }
+long faxp() { long yaxp; yaxp = arg * 3 + 613; arg = yaxp - yaxp / 1000003 * 1000003; return faxo(); }
+long faxq() { long yaxq; yaxq = arg * 3 + 614; arg = yaxq - yaxq / 1000003 * 1000003; return faxp(); }
+long faxr() { long yaxr; yaxr = arg * 3 + 615; arg = yaxr - yaxr / 1000003 * 1000003; return faxq(); }
+long faxs() { long yaxs; yaxs = arg * 3 + 616; arg = yaxs - yaxs / 1000003 * 1000003; return faxr(); }
+long faxt() { long yaxt; yaxt = arg * 3 + 617; arg = yaxt - yaxt / 1000003 * 1000003; return faxs(); }
+long faxu() { long yaxu; yaxu = arg * 3 + 618; arg = yaxu - yaxu / 1000003 * 1000003; return faxt(); }
+long faxv() { long yaxv; yaxv = arg * 3 + 619; arg = yaxv - yaxv / 1000003 * 1000003; return faxu(); }
+long faxw() { long yaxw; yaxw = arg * 3 + 620; arg = yaxw - yaxw / 1000003 * 1000003; return faxv(); }
+long faxx() { long yaxx; yaxx = arg * 3 + 621; arg = yaxx - yaxx / 1000003 * 1000003; return faxw(); }
+long faxy() { long yaxy; yaxy = arg * 3 + 622; arg = yaxy - yaxy / 1000003 * 1000003; return faxx(); }
+long faxz() { long yaxz; yaxz = arg * 3 + 623; arg = yaxz - yaxz / 1000003 * 1000003; return faxy(); }
+long faya() { long yaya; yaya = arg * 3 + 624; arg = yaya - yaya / 1000003 * 1000003; return faxz(); }
+long fayb() { long yayb; yayb = arg * 3 + 625; arg = yayb - yayb / 1000003 * 1000003; return faya(); }
+long fayc() { long yayc; yayc = arg * 3 + 626; arg = yayc - yayc / 1000003 * 1000003; return fayb(); }
+long fayd() { long yayd; yayd = arg * 3 + 627; arg = yayd - yayd / 1000003 * 1000003; return fayc(); }
+long faye() { long yaye; yaye = arg * 3 + 628; arg = yaye - yaye / 1000003 * 1000003; return fayd(); }
+long fayf() { long yayf; yayf = arg * 3 + 629; arg = yayf - yayf / 1000003 * 1000003; return faye(); }
+long fayg() { long yayg; yayg = arg * 3 + 630; arg = yayg - yayg / 1000003 * 1000003; return fayf(); }
+long fayh() { long yayh; yayh = arg * 3 + 631; arg = yayh - yayh / 1000003 * 1000003; return fayg(); }
+long fayi() { long yayi; yayi = arg * 3 + 632; arg = yayi - yayi / 1000003 * 1000003; return fayh(); }
+long fayj() { long yayj; yayj = arg * 3 + 633; arg = yayj - yayj / 1000003 * 1000003; return fayi(); }
+long fayk() { long yayk; yayk = arg * 3 + 634; arg = yayk - yayk / 1000003 * 1000003; return fayj(); }
+long fayl() { long yayl; yayl = arg * 3 + 635; arg = yayl - yayl / 1000003 * 1000003; return fayk(); }
+long faym() { long yaym; yaym = arg * 3 + 636; arg = yaym - yaym / 1000003 * 1000003; return fayl(); }
+long fayn() { long yayn; yayn = arg * 3 + 637; arg = yayn - yayn / 1000003 * 1000003; return faym(); }
+long fayo() { long yayo; yayo = arg * 3 + 638; arg = yayo - yayo / 1000003 * 1000003; return fayn(); }
+long fayp() { long yayp; yayp = arg * 3 + 639; arg = yayp - yayp / 1000003 * 1000003; return fayo(); }
+long fayq() { long yayq; yayq = arg * 3 + 640; arg = yayq - yayq / 1000003 * 1000003; return fayp(); }
+long fayr() { long yayr; yayr = arg * 3 + 641; arg = yayr - yayr / 1000003 * 1000003; return fayq(); }
+long fays() { long yays; yays = arg * 3 + 642; arg = yays - yays / 1000003 * 1000003; return fayr(); }
+long fayt() { long yayt; yayt = arg * 3 + 643; arg = yayt - yayt / 1000003 * 1000003; return fays(); }
+long fayu() { long yayu; yayu = arg * 3 + 644; arg = yayu - yayu / 1000003 * 1000003; return fayt(); }
+long fayv() { long yayv; yayv = arg * 3 + 645; arg = yayv - yayv / 1000003 * 1000003; return fayu(); }
+long fayw() { long yayw; yayw = arg * 3 + 646; arg = yayw - yayw / 1000003 * 1000003; return fayv(); }
+long fayx() { long yayx; yayx = arg * 3 + 647; arg = yayx - yayx / 1000003 * 1000003; return fayw(); }
+long fayy() { long yayy; yayy = arg * 3 + 648; arg = yayy - yayy / 1000003 * 1000003; return fayx(); }
+long fayz() { long yayz; yayz = arg * 3 + 649; arg = yayz - yayz / 1000003 * 1000003; return fayy(); }
+long faza() { long yaza; yaza = arg * 3 + 650; arg = yaza - yaza / 1000003 * 1000003; return fayz(); }
+long fazb() { long yazb; yazb = arg * 3 + 651; arg = yazb - yazb / 1000003 * 1000003; return faza(); }
+long fazc() { long yazc; yazc = arg * 3 + 652; arg = yazc - yazc / 1000003 * 1000003; return fazb(); }
+long fazd() { long yazd; yazd = arg * 3 + 653; arg = yazd - yazd / 1000003 * 1000003; return fazc(); }
+long faze() { long yaze; yaze = arg * 3 + 654; arg = yaze - yaze / 1000003 * 1000003; return fazd(); }
+long fazf() { long yazf; yazf = arg * 3 + 655; arg = yazf - yazf / 1000003 * 1000003; return faze(); }
+long fazg() { long yazg; yazg = arg * 3 + 656; arg = yazg - yazg / 1000003 * 1000003; return fazf(); }
+long fazh() { long yazh; yazh = arg * 3 + 657; arg = yazh - yazh / 1000003 * 1000003; return fazg(); }
+long fazi() { long yazi; yazi = arg * 3 + 658; arg = yazi - yazi / 1000003 * 1000003; return fazh(); }
+long fazj() { long yazj; yazj = arg * 3 + 659; arg = yazj - yazj / 1000003 * 1000003; return fazi(); }
+long fazk() { long yazk; yazk = arg * 3 + 660; arg = yazk - yazk / 1000003 * 1000003; return fazj(); }
+long fazl() { long yazl; yazl = arg * 3 + 661; arg = yazl - yazl / 1000003 * 1000003; return fazk(); }
+long fazm() { long yazm; yazm = arg * 3 + 662; arg = yazm - yazm / 1000003 * 1000003; return fazl(); }
+long fazn() { long yazn; yazn = arg * 3 + 663; arg = yazn - yazn / 1000003 * 1000003; return fazm(); }
+long fazo() { long yazo; yazo = arg * 3 + 664; arg = yazo - yazo / 1000003 * 1000003; return fazn(); }
+long fazp() { long yazp; yazp = arg * 3 + 665; arg = yazp - yazp / 1000003 * 1000003; return fazo(); }
+long fazq() { long yazq; yazq = arg * 3 + 666; arg = yazq - yazq / 1000003 * 1000003; return fazp(); }
+long fazr() { long yazr; yazr = arg * 3 + 667; arg = yazr - yazr / 1000003 * 1000003; return fazq(); }
+long fazs() { long yazs; yazs = arg * 3 + 668; arg = yazs - yazs / 1000003 * 1000003; return fazr(); }
+long fazt() { long yazt; yazt = arg * 3 + 669; arg = yazt - yazt / 1000003 * 1000003; return fazs(); }
+long fazu() { long yazu; yazu = arg * 3 + 670; arg = yazu - yazu / 1000003 * 1000003; return fazt(); }
+long fazv() { long yazv; yazv = arg * 3 + 671; arg = yazv - yazv / 1000003 * 1000003; return fazu(); }
+long fazw() { long yazw; yazw = arg * 3 + 672; arg = yazw - yazw / 1000003 * 1000003; return fazv(); }
+long fazx() { long yazx; yazx = arg * 3 + 673; arg = yazx - yazx / 1000003 * 1000003; return fazw(); }
+long fazy() { long yazy; yazy = arg * 3 + 674; arg = yazy - yazy / 1000003 * 1000003; return fazx(); }
+long fazz() { long yazz; yazz = arg * 3 + 675; arg = yazz - yazz / 1000003 * 1000003; return fazy(); }
+long fbaa() { long ybaa; ybaa = arg * 3 + 676; arg = ybaa - ybaa / 1000003 * 1000003; return fazz(); }
+long fbab() { long ybab; ybab = arg * 3 + 677; arg = ybab - ybab / 1000003 * 1000003; return fbaa(); }
+long fbac() { long ybac; ybac = arg * 3 + 678; arg = ybac - ybac / 1000003 * 1000003; return fbab(); }
+long fbad() { long ybad; ybad = arg * 3 + 679; arg = ybad - ybad / 1000003 * 1000003; return fbac(); }
+long fbae() { long ybae; ybae = arg * 3 + 680; arg = ybae - ybae / 1000003 * 1000003; return fbad(); }
+long fbaf() { long ybaf; ybaf = arg * 3 + 681; arg = ybaf - ybaf / 1000003 * 1000003; return fbae(); }
+long fbag() { long ybag; ybag = arg * 3 + 682; arg = ybag - ybag / 1000003 * 1000003; return fbaf(); }
+long fbah() { long ybah; ybah = arg * 3 + 683; arg = ybah - ybah / 1000003 * 1000003; return fbag(); }
+long fbai() { long ybai; ybai = arg * 3 + 684; arg = ybai - ybai / 1000003 * 1000003; return fbah(); }
+long fbaj() { long ybaj; ybaj = arg * 3 + 685; arg = ybaj - ybaj / 1000003 * 1000003; return fbai(); }
+long fbak() { long ybak; ybak = arg * 3 + 686; arg = ybak - ybak / 1000003 * 1000003; return fbaj(); }
+long fbal() { long ybal; ybal = arg * 3 + 687; arg = ybal - ybal / 1000003 * 1000003; return fbak(); }
+long fbam() { long ybam; ybam = arg * 3 + 688; arg = ybam - ybam / 1000003 * 1000003; return fbal(); }
+long fban() { long yban; yban = arg * 3 + 689; arg = yban - yban / 1000003 * 1000003; return fbam(); }
+long fbao() { long ybao; ybao = arg * 3 + 690; arg = ybao - ybao / 1000003 * 1000003; return fban(); }
+long fbap() { long ybap; ybap = arg * 3 + 691; arg = ybap - ybap / 1000003 * 1000003; return fbao(); }
+long fbaq() { long ybaq; ybaq = arg * 3 + 692; arg = ybaq - ybaq / 1000003 * 1000003; return fbap(); }
+long fbar() { long ybar; ybar = arg * 3 + 693; arg = ybar - ybar / 1000003 * 1000003; return fbaq(); }
+long fbas() { long ybas; ybas = arg * 3 + 694; arg = ybas - ybas / 1000003 * 1000003; return fbar(); }
+long fbat() { long ybat; ybat = arg * 3 + 695; arg = ybat - ybat / 1000003 * 1000003; return fbas(); }
+long fbau() { long ybau; ybau = arg * 3 + 696; arg = ybau - ybau / 1000003 * 1000003; return fbat(); }
+long fbav() { long ybav; ybav = arg * 3 + 697; arg = ybav - ybav / 1000003 * 1000003; return fbau(); }
+long fbaw() { long ybaw; ybaw = arg * 3 + 698; arg = ybaw - ybaw / 1000003 * 1000003; return fbav(); }
+long fbax() { long ybax; ybax = arg * 3 + 699; arg = ybax - ybax / 1000003 * 1000003; return fbaw(); }
+long fbay() { long ybay; ybay = arg * 3 + 700; arg = ybay - ybay / 1000003 * 1000003; return fbax(); }
+long fbaz() { long ybaz; ybaz = arg * 3 + 701; arg = ybaz - ybaz / 1000003 * 1000003; return fbay(); }
+long fbba() { long ybba; ybba = arg * 3 + 702; arg = ybba - ybba / 1000003 * 1000003; return fbaz(); }
+long fbbb() { long ybbb; ybbb = arg * 3 + 703; arg = ybbb - ybbb / 1000003 * 1000003; return fbba(); }
+long fbbc() { long ybbc; ybbc = arg * 3 + 704; arg = ybbc - ybbc / 1000003 * 1000003; return fbbb(); }
+long fbbd() { long ybbd; ybbd = arg * 3 + 705; arg = ybbd - ybbd / 1000003 * 1000003; return fbbc(); }
+long fbbe() { long ybbe; ybbe = arg * 3 + 706; arg = ybbe - ybbe / 1000003 * 1000003; return fbbd(); }
+long fbbf() { long ybbf; ybbf = arg * 3 + 707; arg = ybbf - ybbf / 1000003 * 1000003; return fbbe(); }
+long fbbg() { long ybbg; ybbg = arg * 3 + 708; arg = ybbg - ybbg / 1000003 * 1000003; return fbbf(); }
+long fbbh() { long ybbh; ybbh = arg * 3 + 709; arg = ybbh - ybbh / 1000003 * 1000003; return fbbg(); }
+long fbbi() { long ybbi; ybbi = arg * 3 + 710; arg = ybbi - ybbi / 1000003 * 1000003; return fbbh(); }
+long fbbj() { long ybbj; ybbj = arg * 3 + 711; arg = ybbj - ybbj / 1000003 * 1000003; return fbbi(); }
+long fbbk() { long ybbk; ybbk = arg * 3 + 712; arg = ybbk - ybbk / 1000003 * 1000003; return fbbj(); }
+long fbbl() { long ybbl; ybbl = arg * 3 + 713; arg = ybbl - ybbl / 1000003 * 1000003; return fbbk(); }
+long fbbm() { long ybbm; ybbm = arg * 3 + 714; arg = ybbm - ybbm / 1000003 * 1000003; return fbbl(); }
+long fbbn() { long ybbn; ybbn = arg * 3 + 715; arg = ybbn - ybbn / 1000003 * 1000003; return fbbm(); }
+long fbbo() { long ybbo; ybbo = arg * 3 + 716; arg = ybbo - ybbo / 1000003 * 1000003; return fbbn(); }
+long fbbp() { long ybbp; ybbp = arg * 3 + 717; arg = ybbp - ybbp / 1000003 * 1000003; return fbbo(); }
+long fbbq() { long ybbq; ybbq = arg * 3 + 718; arg = ybbq - ybbq / 1000003 * 1000003; return fbbp(); }
+long fbbr() { long ybbr; ybbr = arg * 3 + 719; arg = ybbr - ybbr / 1000003 * 1000003; return fbbq(); }
+long fbbs() { long ybbs; ybbs = arg * 3 + 720; arg = ybbs - ybbs / 1000003 * 1000003; return fbbr(); }
+long fbbt() { long ybbt; ybbt = arg * 3 + 721; arg = ybbt - ybbt / 1000003 * 1000003; return fbbs(); }
+long fbbu() { long ybbu; ybbu = arg * 3 + 722; arg = ybbu - ybbu / 1000003 * 1000003; return fbbt(); }
+long fbbv() { long ybbv; ybbv = arg * 3 + 723; arg = ybbv - ybbv / 1000003 * 1000003; return fbbu(); }
+long fbbw() { long ybbw; ybbw = arg * 3 + 724; arg = ybbw - ybbw / 1000003 * 1000003; return fbbv(); }
+long fbbx() { long ybbx; ybbx = arg * 3 + 725; arg = ybbx - ybbx / 1000003 * 1000003; return fbbw(); }
+long fbby() { long ybby; ybby = arg * 3 + 726; arg = ybby - ybby / 1000003 * 1000003; return fbbx(); }
+long fbbz() { long ybbz; ybbz = arg * 3 + 727; arg = ybbz - ybbz / 1000003 * 1000003; return fbby(); }
+long fbca() { long ybca; ybca = arg * 3 + 728; arg = ybca - ybca / 1000003 * 1000003; return fbbz(); }
+long fbcb() { long ybcb; ybcb = arg * 3 + 729; arg = ybcb - ybcb / 1000003 * 1000003; return fbca(); }
+long fbcc() { long ybcc; ybcc = arg * 3 + 730; arg = ybcc - ybcc / 1000003 * 1000003; return fbcb(); }
+long fbcd() { long ybcd; ybcd = arg * 3 + 731; arg = ybcd - ybcd / 1000003 * 1000003; return fbcc(); }
+long fbce() { long ybce; ybce = arg * 3 + 732; arg = ybce - ybce / 1000003 * 1000003; return fbcd(); }
+long fbcf() { long ybcf; ybcf = arg * 3 + 733; arg = ybcf - ybcf / 1000003 * 1000003; return fbce(); }
+long fbcg() { long ybcg; ybcg = arg * 3 + 734; arg = ybcg - ybcg / 1000003 * 1000003; return fbcf(); }
+long fbch() { long ybch; ybch = arg * 3 + 735; arg = ybch - ybch / 1000003 * 1000003; return fbcg(); }
+long fbci() { long ybci; ybci = arg * 3 + 736; arg = ybci - ybci / 1000003 * 1000003; return fbch(); }
+long fbcj() { long ybcj; ybcj = arg * 3 + 737; arg = ybcj - ybcj / 1000003 * 1000003; return fbci(); }
+long fbck() { long ybck; ybck = arg * 3 + 738; arg = ybck - ybck / 1000003 * 1000003; return fbcj(); }
+long fbcl() { long ybcl; ybcl = arg * 3 + 739; arg = ybcl - ybcl / 1000003 * 1000003; return fbck(); }
+long fbcm() { long ybcm; ybcm = arg * 3 + 740; arg = ybcm - ybcm / 1000003 * 1000003; return fbcl(); }
+long fbcn() { long ybcn; ybcn = arg * 3 + 741; arg = ybcn - ybcn / 1000003 * 1000003; return fbcm(); }
+long fbco() { long ybco; ybco = arg * 3 + 742; arg = ybco - ybco / 1000003 * 1000003; return fbcn(); }
+long fbcp() { long ybcp; ybcp = arg * 3 + 743; arg = ybcp - ybcp / 1000003 * 1000003; return fbco(); }
+long fbcq() { long ybcq; ybcq = arg * 3 + 744; arg = ybcq - ybcq / 1000003 * 1000003; return fbcp(); }
+long fbcr() { long ybcr; ybcr = arg * 3 + 745; arg = ybcr - ybcr / 1000003 * 1000003; return fbcq(); }
+long fbcs() { long ybcs; ybcs = arg * 3 + 746; arg = ybcs - ybcs / 1000003 * 1000003; return fbcr(); }
+long fbct() { long ybct; ybct = arg * 3 + 747; arg = ybct - ybct / 1000003 * 1000003; return fbcs(); }
+long fbcu() { long ybcu; ybcu = arg * 3 + 748; arg = ybcu - ybcu / 1000003 * 1000003; return fbct(); }
+long fbcv() { long ybcv; ybcv = arg * 3 + 749; arg = ybcv - ybcv / 1000003 * 1000003; return fbcu(); }
+long fbcw() { long ybcw; ybcw = arg * 3 + 750; arg = ybcw - ybcw / 1000003 * 1000003; return fbcv(); }
+long fbcx() { long ybcx; ybcx = arg * 3 + 751; arg = ybcx - ybcx / 1000003 * 1000003; return fbcw(); }
+long fbcy() { long ybcy; ybcy = arg * 3 + 752; arg = ybcy - ybcy / 1000003 * 1000003; return fbcx(); }
+long fbcz() { long ybcz; ybcz = arg * 3 + 753; arg = ybcz - ybcz / 1000003 * 1000003; return fbcy(); }
+long fbda() { long ybda; ybda = arg * 3 + 754; arg = ybda - ybda / 1000003 * 1000003; return fbcz(); }
+long fbdb() { long ybdb; ybdb = arg * 3 + 755; arg = ybdb - ybdb / 1000003 * 1000003; return fbda(); }
+long fbdc() { long ybdc; ybdc = arg * 3 + 756; arg = ybdc - ybdc / 1000003 * 1000003; return fbdb(); }
+long fbdd() { long ybdd; ybdd = arg * 3 + 757; arg = ybdd - ybdd / 1000003 * 1000003; return fbdc(); }
+long fbde() { long ybde; ybde = arg * 3 + 758; arg = ybde - ybde / 1000003 * 1000003; return fbdd(); }
+long fbdf() { long ybdf; ybdf = arg * 3 + 759; arg = ybdf - ybdf / 1000003 * 1000003; return fbde(); }
+long fbdg() { long ybdg; ybdg = arg * 3 + 760; arg = ybdg - ybdg / 1000003 * 1000003; return fbdf(); }
+long fbdh() { long ybdh; ybdh = arg * 3 + 761; arg = ybdh - ybdh / 1000003 * 1000003; return fbdg(); }
+long fbdi() { long ybdi; ybdi = arg * 3 + 762; arg = ybdi - ybdi / 1000003 * 1000003; return fbdh(); }
+long fbdj() { long ybdj; ybdj = arg * 3 + 763; arg = ybdj - ybdj / 1000003 * 1000003; return fbdi(); }
+long fbdk() { long ybdk; ybdk = arg * 3 + 764; arg = ybdk - ybdk / 1000003 * 1000003; return fbdj(); }
+long fbdl() { long ybdl; ybdl = arg * 3 + 765; arg = ybdl - ybdl / 1000003 * 1000003; return fbdk(); }
+long fbdm() { long ybdm; ybdm = arg * 3 + 766; arg = ybdm - ybdm / 1000003 * 1000003; return fbdl(); }
+long fbdn() { long ybdn; ybdn = arg * 3 + 767; arg = ybdn - ybdn / 1000003 * 1000003; return fbdm(); }
+long fbdo() { long ybdo; ybdo = arg * 3 + 768; arg = ybdo - ybdo / 1000003 * 1000003; return fbdn(); }
+long fbdp() { long ybdp; ybdp = arg * 3 + 769; arg = ybdp - ybdp / 1000003 * 1000003; return fbdo(); }
+long fbdq() { long ybdq; ybdq = arg * 3 + 770; arg = ybdq - ybdq / 1000003 * 1000003; return fbdp(); }
+long fbdr() { long ybdr; ybdr = arg * 3 + 771; arg = ybdr - ybdr / 1000003 * 1000003; return fbdq(); }
+long fbds() { long ybds; ybds = arg * 3 + 772; arg = ybds - ybds / 1000003 * 1000003; return fbdr(); }
+long fbdt() { long ybdt; ybdt = arg * 3 + 773; arg = ybdt - ybdt / 1000003 * 1000003; return fbds(); }
+long fbdu() { long ybdu; ybdu = arg * 3 + 774; arg = ybdu - ybdu / 1000003 * 1000003; return fbdt(); }
+long fbdv() { long ybdv; ybdv = arg * 3 + 775; arg = ybdv - ybdv / 1000003 * 1000003; return fbdu(); }
+long fbdw() { long ybdw; ybdw = arg * 3 + 776; arg = ybdw - ybdw / 1000003 * 1000003; return fbdv(); }
+long fbdx() { long ybdx; ybdx = arg * 3 + 777; arg = ybdx - ybdx / 1000003 * 1000003; return fbdw(); }
+long fbdy() { long ybdy; ybdy = arg * 3 + 778; arg = ybdy - ybdy / 1000003 * 1000003; return fbdx(); }
+long fbdz() { long ybdz; ybdz = arg * 3 + 779; arg = ybdz - ybdz / 1000003 * 1000003; return fbdy(); }
+long fbea() { long ybea; ybea = arg * 3 + 780; arg = ybea - ybea / 1000003 * 1000003; return fbdz(); }
+long fbeb() { long ybeb; ybeb = arg * 3 + 781; arg = ybeb - ybeb / 1000003 * 1000003; return fbea(); }
+long fbec() { long ybec; ybec = arg * 3 + 782; arg = ybec - ybec / 1000003 * 1000003; return fbeb(); }
+long fbed() { long ybed; ybed = arg * 3 + 783; arg = ybed - ybed / 1000003 * 1000003; return fbec(); }
+long fbee() { long ybee; ybee = arg * 3 + 784; arg = ybee - ybee / 1000003 * 1000003; return fbed(); }
+long fbef() { long ybef; ybef = arg * 3 + 785; arg = ybef - ybef / 1000003 * 1000003; return fbee(); }
+long fbeg() { long ybeg; ybeg = arg * 3 + 786; arg = ybeg - ybeg / 1000003 * 1000003; return fbef(); }
+long fbeh() { long ybeh; ybeh = arg * 3 + 787; arg = ybeh - ybeh / 1000003 * 1000003; return fbeg(); }
+long fbei() { long ybei; ybei = arg * 3 + 788; arg = ybei - ybei / 1000003 * 1000003; return fbeh(); }
+long fbej() { long ybej; ybej = arg * 3 + 789; arg = ybej - ybej / 1000003 * 1000003; return fbei(); }
+long fbek() { long ybek; ybek = arg * 3 + 790; arg = ybek - ybek / 1000003 * 1000003; return fbej(); }
+long fbel() { long ybel; ybel = arg * 3 + 791; arg = ybel - ybel / 1000003 * 1000003; return fbek(); }
+long fbem() { long ybem; ybem = arg * 3 + 792; arg = ybem - ybem / 1000003 * 1000003; return fbel(); }
+long fben() { long yben; yben = arg * 3 + 793; arg = yben - yben / 1000003 * 1000003; return fbem(); }
+long fbeo() { long ybeo; ybeo = arg * 3 + 794; arg = ybeo - ybeo / 1000003 * 1000003; return fben(); }
+long fbep() { long ybep; ybep = arg * 3 + 795; arg = ybep - ybep / 1000003 * 1000003; return fbeo(); }
+long fbeq() { long ybeq; ybeq = arg * 3 + 796; arg = ybeq - ybeq / 1000003 * 1000003; return fbep(); }
+long fber() { long yber; yber = arg * 3 + 797; arg = yber - yber / 1000003 * 1000003; return fbeq(); }
+long fbes() { long ybes; ybes = arg * 3 + 798; arg = ybes - ybes / 1000003 * 1000003; return fber(); }
+long fbet() { long ybet; ybet = arg * 3 + 799; arg = ybet - ybet / 1000003 * 1000003; return fbes(); }
+long fbeu() { long ybeu; ybeu = arg * 3 + 800; arg = ybeu - ybeu / 1000003 * 1000003; return fbet(); }
+long fbev() { long ybev; ybev = arg * 3 + 801; arg = ybev - ybev / 1000003 * 1000003; return fbeu(); }
+long fbew() { long ybew; ybew = arg * 3 + 802; arg = ybew - ybew / 1000003 * 1000003; return fbev(); }
+long fbex() { long ybex; ybex = arg * 3 + 803; arg = ybex - ybex / 1000003 * 1000003; return fbew(); }
+long fbey() { long ybey; ybey = arg * 3 + 804; arg = ybey - ybey / 1000003 * 1000003; return fbex(); }
+long fbez() { long ybez; ybez = arg * 3 + 805; arg = ybez - ybez / 1000003 * 1000003; return fbey(); }
+long fbfa() { long ybfa; ybfa = arg * 3 + 806; arg = ybfa - ybfa / 1000003 * 1000003; return fbez(); }
+long fbfb() { long ybfb; ybfb = arg * 3 + 807; arg = ybfb - ybfb / 1000003 * 1000003; return fbfa(); }
+long fbfc() { long ybfc; ybfc = arg * 3 + 808; arg = ybfc - ybfc / 1000003 * 1000003; return fbfb(); }
+long fbfd() { long ybfd; ybfd = arg * 3 + 809; arg = ybfd - ybfd / 1000003 * 1000003; return fbfc(); }
+long fbfe() { long ybfe; ybfe = arg * 3 + 810; arg = ybfe - ybfe / 1000003 * 1000003; return fbfd(); }
+long fbff() { long ybff; ybff = arg * 3 + 811; arg = ybff - ybff / 1000003 * 1000003; return fbfe(); }
+long fbfg() { long ybfg; ybfg = arg * 3 + 812; arg = ybfg - ybfg / 1000003 * 1000003; return fbff(); }
+long fbfh() { long ybfh; ybfh = arg * 3 + 813; arg = ybfh - ybfh / 1000003 * 1000003; return fbfg(); }
+long fbfi() { long ybfi; ybfi = arg * 3 + 814; arg = ybfi - ybfi / 1000003 * 1000003; return fbfh(); }
+long fbfj() { long ybfj; ybfj = arg * 3 + 815; arg = ybfj - ybfj / 1000003 * 1000003; return fbfi(); }
+long fbfk() { long ybfk; ybfk = arg * 3 + 816; arg = ybfk - ybfk / 1000003 * 1000003; return fbfj(); }
+long fbfl() { long ybfl; ybfl = arg * 3 + 817; arg = ybfl - ybfl / 1000003 * 1000003; return fbfk(); }
+long fbfm() { long ybfm; ybfm = arg * 3 + 818; arg = ybfm - ybfm / 1000003 * 1000003; return fbfl(); }
+long fbfn() { long ybfn; ybfn = arg * 3 + 819; arg = ybfn - ybfn / 1000003 * 1000003; return fbfm(); }
+long fbfo() { long ybfo; ybfo = arg * 3 + 820; arg = ybfo - ybfo / 1000003 * 1000003; return fbfn(); }
+long fbfp() { long ybfp; ybfp = arg * 3 + 821; arg = ybfp - ybfp / 1000003 * 1000003; return fbfo(); }
+long fbfq() { long ybfq; ybfq = arg * 3 + 822; arg = ybfq - ybfq / 1000003 * 1000003; return fbfp(); }
+long fbfr() { long ybfr; ybfr = arg * 3 + 823; arg = ybfr - ybfr / 1000003 * 1000003; return fbfq(); }
+long fbfs() { long ybfs; ybfs = arg * 3 + 824; arg = ybfs - ybfs / 1000003 * 1000003; return fbfr(); }
+long fbft() { long ybft; ybft = arg * 3 + 825; arg = ybft - ybft / 1000003 * 1000003; return fbfs(); }
+long fbfu() { long ybfu; ybfu = arg * 3 + 826; arg = ybfu - ybfu / 1000003 * 1000003; return fbft(); }
+long fbfv() { long ybfv; ybfv = arg * 3 + 827; arg = ybfv - ybfv / 1000003 * 1000003; return fbfu(); }
+long fbfw() { long ybfw; ybfw = arg * 3 + 828; arg = ybfw - ybfw / 1000003 * 1000003; return fbfv(); }
+long fbfx() { long ybfx; ybfx = arg * 3 + 829; arg = ybfx - ybfx / 1000003 * 1000003; return fbfw(); }
+long fbfy() { long ybfy; ybfy = arg * 3 + 830; arg = ybfy - ybfy / 1000003 * 1000003; return fbfx(); }
+long fbfz() { long ybfz; ybfz = arg * 3 + 831; arg = ybfz - ybfz / 1000003 * 1000003; return fbfy(); }
+long fbga() { long ybga; ybga = arg * 3 + 832; arg = ybga - ybga / 1000003 * 1000003; return fbfz(); }
+long fbgb() { long ybgb; ybgb = arg * 3 + 833; arg = ybgb - ybgb / 1000003 * 1000003; return fbga(); }
+long fbgc() { long ybgc; ybgc = arg * 3 + 834; arg = ybgc - ybgc / 1000003 * 1000003; return fbgb(); }
+long fbgd() { long ybgd; ybgd = arg * 3 + 835; arg = ybgd - ybgd / 1000003 * 1000003; return fbgc(); }
+long fbge() { long ybge; ybge = arg * 3 + 836; arg = ybge - ybge / 1000003 * 1000003; return fbgd(); }
+long fbgf() { long ybgf; ybgf = arg * 3 + 837; arg = ybgf - ybgf / 1000003 * 1000003; return fbge(); }
+long fbgg() { long ybgg; ybgg = arg * 3 + 838; arg = ybgg - ybgg / 1000003 * 1000003; return fbgf(); }
+long fbgh() { long ybgh; ybgh = arg * 3 + 839; arg = ybgh - ybgh / 1000003 * 1000003; return fbgg(); }
+long fbgi() { long ybgi; ybgi = arg * 3 + 840; arg = ybgi - ybgi / 1000003 * 1000003; return fbgh(); }
+long fbgj() { long ybgj; ybgj = arg * 3 + 841; arg = ybgj - ybgj / 1000003 * 1000003; return fbgi(); }
+long fbgk() { long ybgk; ybgk = arg * 3 + 842; arg = ybgk - ybgk / 1000003 * 1000003; return fbgj(); }
+long fbgl() { long ybgl; ybgl = arg * 3 + 843; arg = ybgl - ybgl / 1000003 * 1000003; return fbgk(); }
+long fbgm() { long ybgm; ybgm = arg * 3 + 844; arg = ybgm - ybgm / 1000003 * 1000003; return fbgl(); }
+long fbgn() { long ybgn; ybgn = arg * 3 + 845; arg = ybgn - ybgn / 1000003 * 1000003; return fbgm(); }
+long fbgo() { long ybgo; ybgo = arg * 3 + 846; arg = ybgo - ybgo / 1000003 * 1000003; return fbgn(); }
+long fbgp() { long ybgp; ybgp = arg * 3 + 847; arg = ybgp - ybgp / 1000003 * 1000003; return fbgo(); }
+long fbgq() { long ybgq; ybgq = arg * 3 + 848; arg = ybgq - ybgq / 1000003 * 1000003; return fbgp(); }
+long fbgr() { long ybgr; ybgr = arg * 3 + 849; arg = ybgr - ybgr / 1000003 * 1000003; return fbgq(); }
+long fbgs() { long ybgs; ybgs = arg * 3 + 850; arg = ybgs - ybgs / 1000003 * 1000003; return fbgr(); }
+long fbgt() { long ybgt; ybgt = arg * 3 + 851; arg = ybgt - ybgt / 1000003 * 1000003; return fbgs(); }
+long fbgu() { long ybgu; ybgu = arg * 3 + 852; arg = ybgu - ybgu / 1000003 * 1000003; return fbgt(); }
+long fbgv() { long ybgv; ybgv = arg * 3 + 853; arg = ybgv - ybgv / 1000003 * 1000003; return fbgu(); }
+long fbgw() { long ybgw; ybgw = arg * 3 + 854; arg = ybgw - ybgw / 1000003 * 1000003; return fbgv(); }
+long fbgx() { long ybgx; ybgx = arg * 3 + 855; arg = ybgx - ybgx / 1000003 * 1000003; return fbgw(); }
+long fbgy() { long ybgy; ybgy = arg * 3 + 856; arg = ybgy - ybgy / 1000003 * 1000003; return fbgx(); }
+long fbgz() { long ybgz; ybgz = arg * 3 + 857; arg = ybgz - ybgz / 1000003 * 1000003; return fbgy(); }
+long fbha() { long ybha; ybha = arg * 3 + 858; arg = ybha - ybha / 1000003 * 1000003; return fbgz(); }
+long fbhb() { long ybhb; ybhb = arg * 3 + 859; arg = ybhb - ybhb / 1000003 * 1000003; return fbha(); }
+long fbhc() { long ybhc; ybhc = arg * 3 + 860; arg = ybhc - ybhc / 1000003 * 1000003; return fbhb(); }
+long fbhd() { long ybhd; ybhd = arg * 3 + 861; arg = ybhd - ybhd / 1000003 * 1000003; return fbhc(); }
+long fbhe() { long ybhe; ybhe = arg * 3 + 862; arg = ybhe - ybhe / 1000003 * 1000003; return fbhd(); }
+long fbhf() { long ybhf; ybhf = arg * 3 + 863; arg = ybhf - ybhf / 1000003 * 1000003; return fbhe(); }
+long fbhg() { long ybhg; ybhg = arg * 3 + 864; arg = ybhg - ybhg / 1000003 * 1000003; return fbhf(); }
+long fbhh() { long ybhh; ybhh = arg * 3 + 865; arg = ybhh - ybhh / 1000003 * 1000003; return fbhg(); }
+long fbhi() { long ybhi; ybhi = arg * 3 + 866; arg = ybhi - ybhi / 1000003 * 1000003; return fbhh(); }
+long fbhj() { long ybhj; ybhj = arg * 3 + 867; arg = ybhj - ybhj / 1000003 * 1000003; return fbhi(); }
+long fbhk() { long ybhk; ybhk = arg * 3 + 868; arg = ybhk - ybhk / 1000003 * 1000003; return fbhj(); }
+long fbhl() { long ybhl; ybhl = arg * 3 + 869; arg = ybhl - ybhl / 1000003 * 1000003; return fbhk(); }
+long fbhm() { long ybhm; ybhm = arg * 3 + 870; arg = ybhm - ybhm / 1000003 * 1000003; return fbhl(); }
+long fbhn() { long ybhn; ybhn = arg * 3 + 871; arg = ybhn - ybhn / 1000003 * 1000003; return fbhm(); }
+long fbho() { long ybho; ybho = arg * 3 + 872; arg = ybho - ybho / 1000003 * 1000003; return fbhn(); }
+long fbhp() { long ybhp; ybhp = arg * 3 + 873; arg = ybhp - ybhp / 1000003 * 1000003; return fbho(); }
+long fbhq() { long ybhq; ybhq = arg * 3 + 874; arg = ybhq - ybhq / 1000003 * 1000003; return fbhp(); }
+long fbhr() { long ybhr; ybhr = arg * 3 + 875; arg = ybhr - ybhr / 1000003 * 1000003; return fbhq(); }
+long fbhs() { long ybhs; ybhs = arg * 3 + 876; arg = ybhs - ybhs / 1000003 * 1000003; return fbhr(); }
+long fbht() { long ybht; ybht = arg * 3 + 877; arg = ybht - ybht / 1000003 * 1000003; return fbhs(); }
+long fbhu() { long ybhu; ybhu = arg * 3 + 878; arg = ybhu - ybhu / 1000003 * 1000003; return fbht(); }
+long fbhv() { long ybhv; ybhv = arg * 3 + 879; arg = ybhv - ybhv / 1000003 * 1000003; return fbhu(); }
+long fbhw() { long ybhw; ybhw = arg * 3 + 880; arg = ybhw - ybhw / 1000003 * 1000003; return fbhv(); }
+long fbhx() { long ybhx; ybhx = arg * 3 + 881; arg = ybhx - ybhx / 1000003 * 1000003; return fbhw(); }
+long fbhy() { long ybhy; ybhy = arg * 3 + 882; arg = ybhy - ybhy / 1000003 * 1000003; return fbhx(); }
+long fbhz() { long ybhz; ybhz = arg * 3 + 883; arg = ybhz - ybhz / 1000003 * 1000003; return fbhy(); }
+long fbia() { long ybia; ybia = arg * 3 + 884; arg = ybia - ybia / 1000003 * 1000003; return fbhz(); }
+long fbib() { long ybib; ybib = arg * 3 + 885; arg = ybib - ybib / 1000003 * 1000003; return fbia(); }
+long fbic() { long ybic; ybic = arg * 3 + 886; arg = ybic - ybic / 1000003 * 1000003; return fbib(); }
+long fbid() { long ybid; ybid = arg * 3 + 887; arg = ybid - ybid / 1000003 * 1000003; return fbic(); }
+long fbie() { long ybie; ybie = arg * 3 + 888; arg = ybie - ybie / 1000003 * 1000003; return fbid(); }
+long fbif() { long ybif; ybif = arg * 3 + 889; arg = ybif - ybif / 1000003 * 1000003; return fbie(); }
+long fbig() { long ybig; ybig = arg * 3 + 890; arg = ybig - ybig / 1000003 * 1000003; return fbif(); }
+long fbih() { long ybih; ybih = arg * 3 + 891; arg = ybih - ybih / 1000003 * 1000003; return fbig(); }
+long fbii() { long ybii; ybii = arg * 3 + 892; arg = ybii - ybii / 1000003 * 1000003; return fbih(); }
+long fbij() { long ybij; ybij = arg * 3 + 893; arg = ybij - ybij / 1000003 * 1000003; return fbii(); }
+long fbik() { long ybik; ybik = arg * 3 + 894; arg = ybik - ybik / 1000003 * 1000003; return fbij(); }
+long fbil() { long ybil; ybil = arg * 3 + 895; arg = ybil - ybil / 1000003 * 1000003; return fbik(); }
+long fbim() { long ybim; ybim = arg * 3 + 896; arg = ybim - ybim / 1000003 * 1000003; return fbil(); }
+long fbin() { long ybin; ybin = arg * 3 + 897; arg = ybin - ybin / 1000003 * 1000003; return fbim(); }
+long fbio() { long ybio; ybio = arg * 3 + 898; arg = ybio - ybio / 1000003 * 1000003; return fbin(); }
+long fbip() { long ybip; ybip = arg * 3 + 899; arg = ybip - ybip / 1000003 * 1000003; return fbio(); }
+long fbiq() { long ybiq; ybiq = arg * 3 + 900; arg = ybiq - ybiq / 1000003 * 1000003; return fbip(); }
+long fbir() { long ybir; ybir = arg * 3 + 901; arg = ybir - ybir / 1000003 * 1000003; return fbiq(); }
+long fbis() { long ybis; ybis = arg * 3 + 902; arg = ybis - ybis / 1000003 * 1000003; return fbir(); }
+long fbit() { long ybit; ybit = arg * 3 + 903; arg = ybit - ybit / 1000003 * 1000003; return fbis(); }
+long fbiu() { long ybiu; ybiu = arg * 3 + 904; arg = ybiu - ybiu / 1000003 * 1000003; return fbit(); }
+long fbiv() { long ybiv; ybiv = arg * 3 + 905; arg = ybiv - ybiv / 1000003 * 1000003; return fbiu(); }
+long fbiw() { long ybiw; ybiw = arg * 3 + 906; arg = ybiw - ybiw / 1000003 * 1000003; return fbiv(); }
+long fbix() { long ybix; ybix = arg * 3 + 907; arg = ybix - ybix / 1000003 * 1000003; return fbiw(); }
+long fbiy() { long ybiy; ybiy = arg * 3 + 908; arg = ybiy - ybiy / 1000003 * 1000003; return fbix(); }
+long fbiz() { long ybiz; ybiz = arg * 3 + 909; arg = ybiz - ybiz / 1000003 * 1000003; return fbiy(); }
+long fbja() { long ybja; ybja = arg * 3 + 910; arg = ybja - ybja / 1000003 * 1000003; return fbiz(); }
+long fbjb() { long ybjb; ybjb = arg * 3 + 911; arg = ybjb - ybjb / 1000003 * 1000003; return fbja(); }
+long fbjc() { long ybjc; ybjc = arg * 3 + 912; arg = ybjc - ybjc / 1000003 * 1000003; return fbjb(); }
+long fbjd() { long ybjd; ybjd = arg * 3 + 913; arg = ybjd - ybjd / 1000003 * 1000003; return fbjc(); }
+long fbje() { long ybje; ybje = arg * 3 + 914; arg = ybje - ybje / 1000003 * 1000003; return fbjd(); }
+long fbjf() { long ybjf; ybjf = arg * 3 + 915; arg = ybjf - ybjf / 1000003 * 1000003; return fbje(); }
+long fbjg() { long ybjg; ybjg = arg * 3 + 916; arg = ybjg - ybjg / 1000003 * 1000003; return fbjf(); }
+long fbjh() { long ybjh; ybjh = arg * 3 + 917; arg = ybjh - ybjh / 1000003 * 1000003; return fbjg(); }
+long fbji() { long ybji; ybji = arg * 3 + 918; arg = ybji - ybji / 1000003 * 1000003; return fbjh(); }
+long fbjj() { long ybjj; ybjj = arg * 3 + 919; arg = ybjj - ybjj / 1000003 * 1000003; return fbji(); }
+long fbjk() { long ybjk; ybjk = arg * 3 + 920; arg = ybjk - ybjk / 1000003 * 1000003; return fbjj(); }
+long fbjl() { long ybjl; ybjl = arg * 3 + 921; arg = ybjl - ybjl / 1000003 * 1000003; return fbjk(); }
+long fbjm() { long ybjm; ybjm = arg * 3 + 922; arg = ybjm - ybjm / 1000003 * 1000003; return fbjl(); }
+long fbjn() { long ybjn; ybjn = arg * 3 + 923; arg = ybjn - ybjn / 1000003 * 1000003; return fbjm(); }
+long fbjo() { long ybjo; ybjo = arg * 3 + 924; arg = ybjo - ybjo / 1000003 * 1000003; return fbjn(); }
+long fbjp() { long ybjp; ybjp = arg * 3 + 925; arg = ybjp - ybjp / 1000003 * 1000003; return fbjo(); }
+long fbjq() { long ybjq; ybjq = arg * 3 + 926; arg = ybjq - ybjq / 1000003 * 1000003; return fbjp(); }
+long fbjr() { long ybjr; ybjr = arg * 3 + 927; arg = ybjr - ybjr / 1000003 * 1000003; return fbjq(); }
+long fbjs() { long ybjs; ybjs = arg * 3 + 928; arg = ybjs - ybjs / 1000003 * 1000003; return fbjr(); }
+long fbjt() { long ybjt; ybjt = arg * 3 + 929; arg = ybjt - ybjt / 1000003 * 1000003; return fbjs(); }
+long fbju() { long ybju; ybju = arg * 3 + 930; arg = ybju - ybju / 1000003 * 1000003; return fbjt(); }
+long fbjv() { long ybjv; ybjv = arg * 3 + 931; arg = ybjv - ybjv / 1000003 * 1000003; return fbju(); }
+long fbjw() { long ybjw; ybjw = arg * 3 + 932; arg = ybjw - ybjw / 1000003 * 1000003; return fbjv(); }
+long fbjx() { long ybjx; ybjx = arg * 3 + 933; arg = ybjx - ybjx / 1000003 * 1000003; return fbjw(); }
+long fbjy() { long ybjy; ybjy = arg * 3 + 934; arg = ybjy - ybjy / 1000003 * 1000003; return fbjx(); }
+long fbjz() { long ybjz; ybjz = arg * 3 + 935; arg = ybjz - ybjz / 1000003 * 1000003; return fbjy(); }
+long fbka() { long ybka; ybka = arg * 3 + 936; arg = ybka - ybka / 1000003 * 1000003; return fbjz(); }
+long fbkb() { long ybkb; ybkb = arg * 3 + 937; arg = ybkb - ybkb / 1000003 * 1000003; return fbka(); }
+long fbkc() { long ybkc; ybkc = arg * 3 + 938; arg = ybkc - ybkc / 1000003 * 1000003; return fbkb(); }
+long fbkd() { long ybkd; ybkd = arg * 3 + 939; arg = ybkd - ybkd / 1000003 * 1000003; return fbkc(); }
+long fbke() { long ybke; ybke = arg * 3 + 940; arg = ybke - ybke / 1000003 * 1000003; return fbkd(); }
+long fbkf() { long ybkf; ybkf = arg * 3 + 941; arg = ybkf - ybkf / 1000003 * 1000003; return fbke(); }
+long fbkg() { long ybkg; ybkg = arg * 3 + 942; arg = ybkg - ybkg / 1000003 * 1000003; return fbkf(); }
+long fbkh() { long ybkh; ybkh = arg * 3 + 943; arg = ybkh - ybkh / 1000003 * 1000003; return fbkg(); }
+long fbki() { long ybki; ybki = arg * 3 + 944; arg = ybki - ybki / 1000003 * 1000003; return fbkh(); }
+long fbkj() { long ybkj; ybkj = arg * 3 + 945; arg = ybkj - ybkj / 1000003 * 1000003; return fbki(); }
+long fbkk() { long ybkk; ybkk = arg * 3 + 946; arg = ybkk - ybkk / 1000003 * 1000003; return fbkj(); }
+long fbkl() { long ybkl; ybkl = arg * 3 + 947; arg = ybkl - ybkl / 1000003 * 1000003; return fbkk(); }
+long fbkm() { long ybkm; ybkm = arg * 3 + 948; arg = ybkm - ybkm / 1000003 * 1000003; return fbkl(); }
+long fbkn() { long ybkn; ybkn = arg * 3 + 949; arg = ybkn - ybkn / 1000003 * 1000003; return fbkm(); }
+long fbko() { long ybko; ybko = arg * 3 + 950; arg = ybko - ybko / 1000003 * 1000003; return fbkn(); }
+long fbkp() { long ybkp; ybkp = arg * 3 + 951; arg = ybkp - ybkp / 1000003 * 1000003; return fbko(); }
+long fbkq() { long ybkq; ybkq = arg * 3 + 952; arg = ybkq - ybkq / 1000003 * 1000003; return fbkp(); }
+long fbkr() { long ybkr; ybkr = arg * 3 + 953; arg = ybkr - ybkr / 1000003 * 1000003; return fbkq(); }
+long fbks() { long ybks; ybks = arg * 3 + 954; arg = ybks - ybks / 1000003 * 1000003; return fbkr(); }
+long fbkt() { long ybkt; ybkt = arg * 3 + 955; arg = ybkt - ybkt / 1000003 * 1000003; return fbks(); }
+long fbku() { long ybku; ybku = arg * 3 + 956; arg = ybku - ybku / 1000003 * 1000003; return fbkt(); }
+long fbkv() { long ybkv; ybkv = arg * 3 + 957; arg = ybkv - ybkv / 1000003 * 1000003; return fbku(); }
+long fbkw() { long ybkw; ybkw = arg * 3 + 958; arg = ybkw - ybkw / 1000003 * 1000003; return fbkv(); }
+long fbkx() { long ybkx; ybkx = arg * 3 + 959; arg = ybkx - ybkx / 1000003 * 1000003; return fbkw(); }
+long fbky() { long ybky; ybky = arg * 3 + 960; arg = ybky - ybky / 1000003 * 1000003; return fbkx(); }
+long fbkz() { long ybkz; ybkz = arg * 3 + 961; arg = ybkz - ybkz / 1000003 * 1000003; return fbky(); }
+long fbla() { long ybla; ybla = arg * 3 + 962; arg = ybla - ybla / 1000003 * 1000003; return fbkz(); }
+long fblb() { long yblb; yblb = arg * 3 + 963; arg = yblb - yblb / 1000003 * 1000003; return fbla(); }
+long fblc() { long yblc; yblc = arg * 3 + 964; arg = yblc - yblc / 1000003 * 1000003; return fblb(); }
+long fbld() { long ybld; ybld = arg * 3 + 965; arg = ybld - ybld / 1000003 * 1000003; return fblc(); }
+long fble() { long yble; yble = arg * 3 + 966; arg = yble - yble / 1000003 * 1000003; return fbld(); }
+long fblf() { long yblf; yblf = arg * 3 + 967; arg = yblf - yblf / 1000003 * 1000003; return fble(); }
+long fblg() { long yblg; yblg = arg * 3 + 968; arg = yblg - yblg / 1000003 * 1000003; return fblf(); }
+long fblh() { long yblh; yblh = arg * 3 + 969; arg = yblh - yblh / 1000003 * 1000003; return fblg(); }
+long fbli() { long ybli; ybli = arg * 3 + 970; arg = ybli - ybli / 1000003 * 1000003; return fblh(); }
+long fblj() { long yblj; yblj = arg * 3 + 971; arg = yblj - yblj / 1000003 * 1000003; return fbli(); }
+long fblk() { long yblk; yblk = arg * 3 + 972; arg = yblk - yblk / 1000003 * 1000003; return fblj(); }
+long fbll() { long ybll; ybll = arg * 3 + 973; arg = ybll - ybll / 1000003 * 1000003; return fblk(); }
+long fblm() { long yblm; yblm = arg * 3 + 974; arg = yblm - yblm / 1000003 * 1000003; return fbll(); }
+long fbln() { long ybln; ybln = arg * 3 + 975; arg = ybln - ybln / 1000003 * 1000003; return fblm(); }
+long fblo() { long yblo; yblo = arg * 3 + 976; arg = yblo - yblo / 1000003 * 1000003; return fbln(); }
+long fblp() { long yblp; yblp = arg * 3 + 977; arg = yblp - yblp / 1000003 * 1000003; return fblo(); }
+long fblq() { long yblq; yblq = arg * 3 + 978; arg = yblq - yblq / 1000003 * 1000003; return fblp(); }
+long fblr() { long yblr; yblr = arg * 3 + 979; arg = yblr - yblr / 1000003 * 1000003; return fblq(); }
+long fbls() { long ybls; ybls = arg * 3 + 980; arg = ybls - ybls / 1000003 * 1000003; return fblr(); }
+long fblt() { long yblt; yblt = arg * 3 + 981; arg = yblt - yblt / 1000003 * 1000003; return fbls(); }
+long fblu() { long yblu; yblu = arg * 3 + 982; arg = yblu - yblu / 1000003 * 1000003; return fblt(); }
+long fblv() { long yblv; yblv = arg * 3 + 983; arg = yblv - yblv / 1000003 * 1000003; return fblu(); }
+long fblw() { long yblw; yblw = arg * 3 + 984; arg = yblw - yblw / 1000003 * 1000003; return fblv(); }
+long fblx() { long yblx; yblx = arg * 3 + 985; arg = yblx - yblx / 1000003 * 1000003; return fblw(); }
+long fbly() { long ybly; ybly = arg * 3 + 986; arg = ybly - ybly / 1000003 * 1000003; return fblx(); }
+long fblz() { long yblz; yblz = arg * 3 + 987; arg = yblz - yblz / 1000003 * 1000003; return fbly(); }
+long fbma() { long ybma; ybma = arg * 3 + 988; arg = ybma - ybma / 1000003 * 1000003; return fblz(); }
+long fbmb() { long ybmb; ybmb = arg * 3 + 989; arg = ybmb - ybmb / 1000003 * 1000003; return fbma(); }
+long fbmc() { long ybmc; ybmc = arg * 3 + 990; arg = ybmc - ybmc / 1000003 * 1000003; return fbmb(); }
+long fbmd() { long ybmd; ybmd = arg * 3 + 991; arg = ybmd - ybmd / 1000003 * 1000003; return fbmc(); }
+long fbme() { long ybme; ybme = arg * 3 + 992; arg = ybme - ybme / 1000003 * 1000003; return fbmd(); }
+long fbmf() { long ybmf; ybmf = arg * 3 + 993; arg = ybmf - ybmf / 1000003 * 1000003; return fbme(); }
+long fbmg() { long ybmg; ybmg = arg * 3 + 994; arg = ybmg - ybmg / 1000003 * 1000003; return fbmf(); }
+long fbmh() { long ybmh; ybmh = arg * 3 + 995; arg = ybmh - ybmh / 1000003 * 1000003; return fbmg(); }
+long fbmi() { long ybmi; ybmi = arg * 3 + 996; arg = ybmi - ybmi / 1000003 * 1000003; return fbmh(); }
+long fbmj() { long ybmj; ybmj = arg * 3 + 997; arg = ybmj - ybmj / 1000003 * 1000003; return fbmi(); }
+long fbmk() { long ybmk; ybmk = arg * 3 + 998; arg = ybmk - ybmk / 1000003 * 1000003; return fbmj(); }
+long fbml() { long ybml; ybml = arg * 3 + 999; arg = ybml - ybml / 1000003 * 1000003; return fbmk(); }
+long fbmm() { long ybmm; ybmm = arg * 3 + 1000; arg = ybmm - ybmm / 1000003 * 1000003; return fbml(); }
+long fbmn() { long ybmn; ybmn = arg * 3 + 1001; arg = ybmn - ybmn / 1000003 * 1000003; return fbmm(); }
+long fbmo() { long ybmo; ybmo = arg * 3 + 1002; arg = ybmo - ybmo / 1000003 * 1000003; return fbmn(); }
+long fbmp() { long ybmp; ybmp = arg * 3 + 1003; arg = ybmp - ybmp / 1000003 * 1000003; return fbmo(); }
+long fbmq() { long ybmq; ybmq = arg * 3 + 1004; arg = ybmq - ybmq / 1000003 * 1000003; return fbmp(); }
+long fbmr() { long ybmr; ybmr = arg * 3 + 1005; arg = ybmr - ybmr / 1000003 * 1000003; return fbmq(); }
+long fbms() { long ybms; ybms = arg * 3 + 1006; arg = ybms - ybms / 1000003 * 1000003; return fbmr(); }
+long fbmt() { long ybmt; ybmt = arg * 3 + 1007; arg = ybmt - ybmt / 1000003 * 1000003; return fbms(); }
+long fbmu() { long ybmu; ybmu = arg * 3 + 1008; arg = ybmu - ybmu / 1000003 * 1000003; return fbmt(); }
+long fbmv() { long ybmv; ybmv = arg * 3 + 1009; arg = ybmv - ybmv / 1000003 * 1000003; return fbmu(); }
+long fbmw() { long ybmw; ybmw = arg * 3 + 1010; arg = ybmw - ybmw / 1000003 * 1000003; return fbmv(); }
+long fbmx() { long ybmx; ybmx = arg * 3 + 1011; arg = ybmx - ybmx / 1000003 * 1000003; return fbmw(); }
+long fbmy() { long ybmy; ybmy = arg * 3 + 1012; arg = ybmy - ybmy / 1000003 * 1000003; return fbmx(); }
+long fbmz() { long ybmz; ybmz = arg * 3 + 1013; arg = ybmz - ybmz / 1000003 * 1000003; return fbmy(); }
+long fbna() { long ybna; ybna = arg * 3 + 1014; arg = ybna - ybna / 1000003 * 1000003; return fbmz(); }
+long fbnb() { long ybnb; ybnb = arg * 3 + 1015; arg = ybnb - ybnb / 1000003 * 1000003; return fbna(); }
+long fbnc() { long ybnc; ybnc = arg * 3 + 1016; arg = ybnc - ybnc / 1000003 * 1000003; return fbnb(); }
+long fbnd() { long ybnd; ybnd = arg * 3 + 1017; arg = ybnd - ybnd / 1000003 * 1000003; return fbnc(); }
+long fbne() { long ybne; ybne = arg * 3 + 1018; arg = ybne - ybne / 1000003 * 1000003; return fbnd(); }
+long fbnf() { long ybnf; ybnf = arg * 3 + 1019; arg = ybnf - ybnf / 1000003 * 1000003; return fbne(); }
+long fbng() { long ybng; ybng = arg * 3 + 1020; arg = ybng - ybng / 1000003 * 1000003; return fbnf(); }
+long fbnh() { long ybnh; ybnh = arg * 3 + 1021; arg = ybnh - ybnh / 1000003 * 1000003; return fbng(); }
+long fbni() { long ybni; ybni = arg * 3 + 1022; arg = ybni - ybni / 1000003 * 1000003; return fbnh(); }
+long fbnj() { long ybnj; ybnj = arg * 3 + 1023; arg = ybnj - ybnj / 1000003 * 1000003; return fbni(); }
+long fbnk() { long ybnk; ybnk = arg * 3 + 1024; arg = ybnk - ybnk / 1000003 * 1000003; return fbnj(); }
+long fbnl() { long ybnl; ybnl = arg * 3 + 1025; arg = ybnl - ybnl / 1000003 * 1000003; return fbnk(); }
+long fbnm() { long ybnm; ybnm = arg * 3 + 1026; arg = ybnm - ybnm / 1000003 * 1000003; return fbnl(); }
+long fbnn() { long ybnn; ybnn = arg * 3 + 1027; arg = ybnn - ybnn / 1000003 * 1000003; return fbnm(); }
+long fbno() { long ybno; ybno = arg * 3 + 1028; arg = ybno - ybno / 1000003 * 1000003; return fbnn(); }
+long fbnp() { long ybnp; ybnp = arg * 3 + 1029; arg = ybnp - ybnp / 1000003 * 1000003; return fbno(); }
+long fbnq() { long ybnq; ybnq = arg * 3 + 1030; arg = ybnq - ybnq / 1000003 * 1000003; return fbnp(); }
+long fbnr() { long ybnr; ybnr = arg * 3 + 1031; arg = ybnr - ybnr / 1000003 * 1000003; return fbnq(); }
+long fbns() { long ybns; ybns = arg * 3 + 1032; arg = ybns - ybns / 1000003 * 1000003; return fbnr(); }
+long fbnt() { long ybnt; ybnt = arg * 3 + 1033; arg = ybnt - ybnt / 1000003 * 1000003; return fbns(); }
+long fbnu() { long ybnu; ybnu = arg * 3 + 1034; arg = ybnu - ybnu / 1000003 * 1000003; return fbnt(); }
+long fbnv() { long ybnv; ybnv = arg * 3 + 1035; arg = ybnv - ybnv / 1000003 * 1000003; return fbnu(); }
+long fbnw() { long ybnw; ybnw = arg * 3 + 1036; arg = ybnw - ybnw / 1000003 * 1000003; return fbnv(); }
+long fbnx() { long ybnx; ybnx = arg * 3 + 1037; arg = ybnx - ybnx / 1000003 * 1000003; return fbnw(); }
+long fbny() { long ybny; ybny = arg * 3 + 1038; arg = ybny - ybny / 1000003 * 1000003; return fbnx(); }
+long fbnz() { long ybnz; ybnz = arg * 3 + 1039; arg = ybnz - ybnz / 1000003 * 1000003; return fbny(); }
+long fboa() { long yboa; yboa = arg * 3 + 1040; arg = yboa - yboa / 1000003 * 1000003; return fbnz(); }
+long fbob() { long ybob; ybob = arg * 3 + 1041; arg = ybob - ybob / 1000003 * 1000003; return fboa(); }
+long fboc() { long yboc; yboc = arg * 3 + 1042; arg = yboc - yboc / 1000003 * 1000003; return fbob(); }
+long fbod() { long ybod; ybod = arg * 3 + 1043; arg = ybod - ybod / 1000003 * 1000003; return fboc(); }
+long fboe() { long yboe; yboe = arg * 3 + 1044; arg = yboe - yboe / 1000003 * 1000003; return fbod(); }
+long fbof() { long ybof; ybof = arg * 3 + 1045; arg = ybof - ybof / 1000003 * 1000003; return fboe(); }
+long fbog() { long ybog; ybog = arg * 3 + 1046; arg = ybog - ybog / 1000003 * 1000003; return fbof(); }
+long fboh() { long yboh; yboh = arg * 3 + 1047; arg = yboh - yboh / 1000003 * 1000003; return fbog(); }
+long fboi() { long yboi; yboi = arg * 3 + 1048; arg = yboi - yboi / 1000003 * 1000003; return fboh(); }
+long fboj() { long yboj; yboj = arg * 3 + 1049; arg = yboj - yboj / 1000003 * 1000003; return fboi(); }
+long fbok() { long ybok; ybok = arg * 3 + 1050; arg = ybok - ybok / 1000003 * 1000003; return fboj(); }
+long fbol() { long ybol; ybol = arg * 3 + 1051; arg = ybol - ybol / 1000003 * 1000003; return fbok(); }
+long fbom() { long ybom; ybom = arg * 3 + 1052; arg = ybom - ybom / 1000003 * 1000003; return fbol(); }
+long fbon() { long ybon; ybon = arg * 3 + 1053; arg = ybon - ybon / 1000003 * 1000003; return fbom(); }
+long fboo() { long yboo; yboo = arg * 3 + 1054; arg = yboo - yboo / 1000003 * 1000003; return fbon(); }
+long fbop() { long ybop; ybop = arg * 3 + 1055; arg = ybop - ybop / 1000003 * 1000003; return fboo(); }
+long fboq() { long yboq; yboq = arg * 3 + 1056; arg = yboq - yboq / 1000003 * 1000003; return fbop(); }
+long fbor() { long ybor; ybor = arg * 3 + 1057; arg = ybor - ybor / 1000003 * 1000003; return fboq(); }
+long fbos() { long ybos; ybos = arg * 3 + 1058; arg = ybos - ybos / 1000003 * 1000003; return fbor(); }
+long fbot() { long ybot; ybot = arg * 3 + 1059; arg = ybot - ybot / 1000003 * 1000003; return fbos(); }
+long fbou() { long ybou; ybou = arg * 3 + 1060; arg = ybou - ybou / 1000003 * 1000003; return fbot(); }
+long fbov() { long ybov; ybov = arg * 3 + 1061; arg = ybov - ybov / 1000003 * 1000003; return fbou(); }
+long fbow() { long ybow; ybow = arg * 3 + 1062; arg = ybow - ybow / 1000003 * 1000003; return fbov(); }
+long fbox() { long ybox; ybox = arg * 3 + 1063; arg = ybox - ybox / 1000003 * 1000003; return fbow(); }
+long fboy() { long yboy; yboy = arg * 3 + 1064; arg = yboy - yboy / 1000003 * 1000003; return fbox(); }
+long fboz() { long yboz; yboz = arg * 3 + 1065; arg = yboz - yboz / 1000003 * 1000003; return fboy(); }
+long fbpa() { long ybpa; ybpa = arg * 3 + 1066; arg = ybpa - ybpa / 1000003 * 1000003; return fboz(); }
+long fbpb() { long ybpb; ybpb = arg * 3 + 1067; arg = ybpb - ybpb / 1000003 * 1000003; return fbpa(); }
+long fbpc() { long ybpc; ybpc = arg * 3 + 1068; arg = ybpc - ybpc / 1000003 * 1000003; return fbpb(); }
+long fbpd() { long ybpd; ybpd = arg * 3 + 1069; arg = ybpd - ybpd / 1000003 * 1000003; return fbpc(); }
+long fbpe() { long ybpe; ybpe = arg * 3 + 1070; arg = ybpe - ybpe / 1000003 * 1000003; return fbpd(); }
+long fbpf() { long ybpf; ybpf = arg * 3 + 1071; arg = ybpf - ybpf / 1000003 * 1000003; return fbpe(); }
+long fbpg() { long ybpg; ybpg = arg * 3 + 1072; arg = ybpg - ybpg / 1000003 * 1000003; return fbpf(); }
+long fbph() { long ybph; ybph = arg * 3 + 1073; arg = ybph - ybph / 1000003 * 1000003; return fbpg(); }
+long fbpi() { long ybpi; ybpi = arg * 3 + 1074; arg = ybpi - ybpi / 1000003 * 1000003; return fbph(); }
+long fbpj() { long ybpj; ybpj = arg * 3 + 1075; arg = ybpj - ybpj / 1000003 * 1000003; return fbpi(); }
+long fbpk() { long ybpk; ybpk = arg * 3 + 1076; arg = ybpk - ybpk / 1000003 * 1000003; return fbpj(); }
+long fbpl() { long ybpl; ybpl = arg * 3 + 1077; arg = ybpl - ybpl / 1000003 * 1000003; return fbpk(); }
+long fbpm() { long ybpm; ybpm = arg * 3 + 1078; arg = ybpm - ybpm / 1000003 * 1000003; return fbpl(); }
+long fbpn() { long ybpn; ybpn = arg * 3 + 1079; arg = ybpn - ybpn / 1000003 * 1000003; return fbpm(); }
+long fbpo() { long ybpo; ybpo = arg * 3 + 1080; arg = ybpo - ybpo / 1000003 * 1000003; return fbpn(); }
+long fbpp() { long ybpp; ybpp = arg * 3 + 1081; arg = ybpp - ybpp / 1000003 * 1000003; return fbpo(); }
+long fbpq() { long ybpq; ybpq = arg * 3 + 1082; arg = ybpq - ybpq / 1000003 * 1000003; return fbpp(); }
+long fbpr() { long ybpr; ybpr = arg * 3 + 1083; arg = ybpr - ybpr / 1000003 * 1000003; return fbpq(); }
+long fbps() { long ybps; ybps = arg * 3 + 1084; arg = ybps - ybps / 1000003 * 1000003; return fbpr(); }
+long fbpt() { long ybpt; ybpt = arg * 3 + 1085; arg = ybpt - ybpt / 1000003 * 1000003; return fbps(); }
+long fbpu() { long ybpu; ybpu = arg * 3 + 1086; arg = ybpu - ybpu / 1000003 * 1000003; return fbpt(); }
+long fbpv() { long ybpv; ybpv = arg * 3 + 1087; arg = ybpv - ybpv / 1000003 * 1000003; return fbpu(); }
+long fbpw() { long ybpw; ybpw = arg * 3 + 1088; arg = ybpw - ybpw / 1000003 * 1000003; return fbpv(); }
+long fbpx() { long ybpx; ybpx = arg * 3 + 1089; arg = ybpx - ybpx / 1000003 * 1000003; return fbpw(); }
+long fbpy() { long ybpy; ybpy = arg * 3 + 1090; arg = ybpy - ybpy / 1000003 * 1000003; return fbpx(); }
+long fbpz() { long ybpz; ybpz = arg * 3 + 1091; arg = ybpz - ybpz / 1000003 * 1000003; return fbpy(); }
+long fbqa() { long ybqa; ybqa = arg * 3 + 1092; arg = ybqa - ybqa / 1000003 * 1000003; return fbpz(); }
+long fbqb() { long ybqb; ybqb = arg * 3 + 1093; arg = ybqb - ybqb / 1000003 * 1000003; return fbqa(); }
+long fbqc() { long ybqc; ybqc = arg * 3 + 1094; arg = ybqc - ybqc / 1000003 * 1000003; return fbqb(); }
+long fbqd() { long ybqd; ybqd = arg * 3 + 1095; arg = ybqd - ybqd / 1000003 * 1000003; return fbqc(); }
+long fbqe() { long ybqe; ybqe = arg * 3 + 1096; arg = ybqe - ybqe / 1000003 * 1000003; return fbqd(); }
+long fbqf() { long ybqf; ybqf = arg * 3 + 1097; arg = ybqf - ybqf / 1000003 * 1000003; return fbqe(); }
+long fbqg() { long ybqg; ybqg = arg * 3 + 1098; arg = ybqg - ybqg / 1000003 * 1000003; return fbqf(); }
+long fbqh() { long ybqh; ybqh = arg * 3 + 1099; arg = ybqh - ybqh / 1000003 * 1000003; return fbqg(); }
+long fbqi() { long ybqi; ybqi = arg * 3 + 1100; arg = ybqi - ybqi / 1000003 * 1000003; return fbqh(); }
+long fbqj() { long ybqj; ybqj = arg * 3 + 1101; arg = ybqj - ybqj / 1000003 * 1000003; return fbqi(); }
+long fbqk() { long ybqk; ybqk = arg * 3 + 1102; arg = ybqk - ybqk / 1000003 * 1000003; return fbqj(); }
+long fbql() { long ybql; ybql = arg * 3 + 1103; arg = ybql - ybql / 1000003 * 1000003; return fbqk(); }
+long fbqm() { long ybqm; ybqm = arg * 3 + 1104; arg = ybqm - ybqm / 1000003 * 1000003; return fbql(); }
+long fbqn() { long ybqn; ybqn = arg * 3 + 1105; arg = ybqn - ybqn / 1000003 * 1000003; return fbqm(); }
+long fbqo() { long ybqo; ybqo = arg * 3 + 1106; arg = ybqo - ybqo / 1000003 * 1000003; return fbqn(); }
+long fbqp() { long ybqp; ybqp = arg * 3 + 1107; arg = ybqp - ybqp / 1000003 * 1000003; return fbqo(); }
+long fbqq() { long ybqq; ybqq = arg * 3 + 1108; arg = ybqq - ybqq / 1000003 * 1000003; return fbqp(); }
+long fbqr() { long ybqr; ybqr = arg * 3 + 1109; arg = ybqr - ybqr / 1000003 * 1000003; return fbqq(); }
+long fbqs() { long ybqs; ybqs = arg * 3 + 1110; arg = ybqs - ybqs / 1000003 * 1000003; return fbqr(); }
+long fbqt() { long ybqt; ybqt = arg * 3 + 1111; arg = ybqt - ybqt / 1000003 * 1000003; return fbqs(); }
+long fbqu() { long ybqu; ybqu = arg * 3 + 1112; arg = ybqu - ybqu / 1000003 * 1000003; return fbqt(); }
+long fbqv() { long ybqv; ybqv = arg * 3 + 1113; arg = ybqv - ybqv / 1000003 * 1000003; return fbqu(); }
+long fbqw() { long ybqw; ybqw = arg * 3 + 1114; arg = ybqw - ybqw / 1000003 * 1000003; return fbqv(); }
+long fbqx() { long ybqx; ybqx = arg * 3 + 1115; arg = ybqx - ybqx / 1000003 * 1000003; return fbqw(); }
+long fbqy() { long ybqy; ybqy = arg * 3 + 1116; arg = ybqy - ybqy / 1000003 * 1000003; return fbqx(); }
+long fbqz() { long ybqz; ybqz = arg * 3 + 1117; arg = ybqz - ybqz / 1000003 * 1000003; return fbqy(); }
+long fbra() { long ybra; ybra = arg * 3 + 1118; arg = ybra - ybra / 1000003 * 1000003; return fbqz(); }
+long fbrb() { long ybrb; ybrb = arg * 3 + 1119; arg = ybrb - ybrb / 1000003 * 1000003; return fbra(); }
+long fbrc() { long ybrc; ybrc = arg * 3 + 1120; arg = ybrc - ybrc / 1000003 * 1000003; return fbrb(); }
+long fbrd() { long ybrd; ybrd = arg * 3 + 1121; arg = ybrd - ybrd / 1000003 * 1000003; return fbrc(); }
+long fbre() { long ybre; ybre = arg * 3 + 1122; arg = ybre - ybre / 1000003 * 1000003; return fbrd(); }
+long fbrf() { long ybrf; ybrf = arg * 3 + 1123; arg = ybrf - ybrf / 1000003 * 1000003; return fbre(); }
+long fbrg() { long ybrg; ybrg = arg * 3 + 1124; arg = ybrg - ybrg / 1000003 * 1000003; return fbrf(); }
+long fbrh() { long ybrh; ybrh = arg * 3 + 1125; arg = ybrh - ybrh / 1000003 * 1000003; return fbrg(); }
+long fbri() { long ybri; ybri = arg * 3 + 1126; arg = ybri - ybri / 1000003 * 1000003; return fbrh(); }
+long fbrj() { long ybrj; ybrj = arg * 3 + 1127; arg = ybrj - ybrj / 1000003 * 1000003; return fbri(); }
+long fbrk() { long ybrk; ybrk = arg * 3 + 1128; arg = ybrk - ybrk / 1000003 * 1000003; return fbrj(); }
+long fbrl() { long ybrl; ybrl = arg * 3 + 1129; arg = ybrl - ybrl / 1000003 * 1000003; return fbrk(); }
+long fbrm() { long ybrm; ybrm = arg * 3 + 1130; arg = ybrm - ybrm / 1000003 * 1000003; return fbrl(); }
+long fbrn() { long ybrn; ybrn = arg * 3 + 1131; arg = ybrn - ybrn / 1000003 * 1000003; return fbrm(); }
+long fbro() { long ybro; ybro = arg * 3 + 1132; arg = ybro - ybro / 1000003 * 1000003; return fbrn(); }
+long fbrp() { long ybrp; ybrp = arg * 3 + 1133; arg = ybrp - ybrp / 1000003 * 1000003; return fbro(); }
+long fbrq() { long ybrq; ybrq = arg * 3 + 1134; arg = ybrq - ybrq / 1000003 * 1000003; return fbrp(); }
+long fbrr() { long ybrr; ybrr = arg * 3 + 1135; arg = ybrr - ybrr / 1000003 * 1000003; return fbrq(); }
+long fbrs() { long ybrs; ybrs = arg * 3 + 1136; arg = ybrs - ybrs / 1000003 * 1000003; return fbrr(); }
+long fbrt() { long ybrt; ybrt = arg * 3 + 1137; arg = ybrt - ybrt / 1000003 * 1000003; return fbrs(); }
+long fbru() { long ybru; ybru = arg * 3 + 1138; arg = ybru - ybru / 1000003 * 1000003; return fbrt(); }
+long fbrv() { long ybrv; ybrv = arg * 3 + 1139; arg = ybrv - ybrv / 1000003 * 1000003; return fbru(); }
+long fbrw() { long ybrw; ybrw = arg * 3 + 1140; arg = ybrw - ybrw / 1000003 * 1000003; return fbrv(); }
+long fbrx() { long ybrx; ybrx = arg * 3 + 1141; arg = ybrx - ybrx / 1000003 * 1000003; return fbrw(); }
+long fbry() { long ybry; ybry = arg * 3 + 1142; arg = ybry - ybry / 1000003 * 1000003; return fbrx(); }
+long fbrz() { long ybrz; ybrz = arg * 3 + 1143; arg = ybrz - ybrz / 1000003 * 1000003; return fbry(); }
+long fbsa() { long ybsa; ybsa = arg * 3 + 1144; arg = ybsa - ybsa / 1000003 * 1000003; return fbrz(); }
+long fbsb() { long ybsb; ybsb = arg * 3 + 1145; arg = ybsb - ybsb / 1000003 * 1000003; return fbsa(); }
+long fbsc() { long ybsc; ybsc = arg * 3 + 1146; arg = ybsc - ybsc / 1000003 * 1000003; return fbsb(); }
+long fbsd() { long ybsd; ybsd = arg * 3 + 1147; arg = ybsd - ybsd / 1000003 * 1000003; return fbsc(); }
+long fbse() { long ybse; ybse = arg * 3 + 1148; arg = ybse - ybse / 1000003 * 1000003; return fbsd(); }
+long fbsf() { long ybsf; ybsf = arg * 3 + 1149; arg = ybsf - ybsf / 1000003 * 1000003; return fbse(); }
+long fbsg() { long ybsg; ybsg = arg * 3 + 1150; arg = ybsg - ybsg / 1000003 * 1000003; return fbsf(); }
+long fbsh() { long ybsh; ybsh = arg * 3 + 1151; arg = ybsh - ybsh / 1000003 * 1000003; return fbsg(); }
+long fbsi() { long ybsi; ybsi = arg * 3 + 1152; arg = ybsi - ybsi / 1000003 * 1000003; return fbsh(); }
+long fbsj() { long ybsj; ybsj = arg * 3 + 1153; arg = ybsj - ybsj / 1000003 * 1000003; return fbsi(); }
+long fbsk() { long ybsk; ybsk = arg * 3 + 1154; arg = ybsk - ybsk / 1000003 * 1000003; return fbsj(); }
+long fbsl() { long ybsl; ybsl = arg * 3 + 1155; arg = ybsl - ybsl / 1000003 * 1000003; return fbsk(); }
+long fbsm() { long ybsm; ybsm = arg * 3 + 1156; arg = ybsm - ybsm / 1000003 * 1000003; return fbsl(); }
+long fbsn() { long ybsn; ybsn = arg * 3 + 1157; arg = ybsn - ybsn / 1000003 * 1000003; return fbsm(); }
+long fbso() { long ybso; ybso = arg * 3 + 1158; arg = ybso - ybso / 1000003 * 1000003; return fbsn(); }
+long fbsp() { long ybsp; ybsp = arg * 3 + 1159; arg = ybsp - ybsp / 1000003 * 1000003; return fbso(); }
+long fbsq() { long ybsq; ybsq = arg * 3 + 1160; arg = ybsq - ybsq / 1000003 * 1000003; return fbsp(); }
+long fbsr() { long ybsr; ybsr = arg * 3 + 1161; arg = ybsr - ybsr / 1000003 * 1000003; return fbsq(); }
+long fbss() { long ybss; ybss = arg * 3 + 1162; arg = ybss - ybss / 1000003 * 1000003; return fbsr(); }
+long fbst() { long ybst; ybst = arg * 3 + 1163; arg = ybst - ybst / 1000003 * 1000003; return fbss(); }
+long fbsu() { long ybsu; ybsu = arg * 3 + 1164; arg = ybsu - ybsu / 1000003 * 1000003; return fbst(); }
+long fbsv() { long ybsv; ybsv = arg * 3 + 1165; arg = ybsv - ybsv / 1000003 * 1000003; return fbsu(); }
+long fbsw() { long ybsw; ybsw = arg * 3 + 1166; arg = ybsw - ybsw / 1000003 * 1000003; return fbsv(); }
+long fbsx() { long ybsx; ybsx = arg * 3 + 1167; arg = ybsx - ybsx / 1000003 * 1000003; return fbsw(); }
+long fbsy() { long ybsy; ybsy = arg * 3 + 1168; arg = ybsy - ybsy / 1000003 * 1000003; return fbsx(); }
+long fbsz() { long ybsz; ybsz = arg * 3 + 1169; arg = ybsz - ybsz / 1000003 * 1000003; return fbsy(); }
+long fbta() { long ybta; ybta = arg * 3 + 1170; arg = ybta - ybta / 1000003 * 1000003; return fbsz(); }
+long fbtb() { long ybtb; ybtb = arg * 3 + 1171; arg = ybtb - ybtb / 1000003 * 1000003; return fbta(); }
+long fbtc() { long ybtc; ybtc = arg * 3 + 1172; arg = ybtc - ybtc / 1000003 * 1000003; return fbtb(); }
+long fbtd() { long ybtd; ybtd = arg * 3 + 1173; arg = ybtd - ybtd / 1000003 * 1000003; return fbtc(); }
+long fbte() { long ybte; ybte = arg * 3 + 1174; arg = ybte - ybte / 1000003 * 1000003; return fbtd(); }
+long fbtf() { long ybtf; ybtf = arg * 3 + 1175; arg = ybtf - ybtf / 1000003 * 1000003; return fbte(); }
+long fbtg() { long ybtg; ybtg = arg * 3 + 1176; arg = ybtg - ybtg / 1000003 * 1000003; return fbtf(); }
+long fbth() { long ybth; ybth = arg * 3 + 1177; arg = ybth - ybth / 1000003 * 1000003; return fbtg(); }
+long fbti() { long ybti; ybti = arg * 3 + 1178; arg = ybti - ybti / 1000003 * 1000003; return fbth(); }
+long fbtj() { long ybtj; ybtj = arg * 3 + 1179; arg = ybtj - ybtj / 1000003 * 1000003; return fbti(); }
+long fbtk() { long ybtk; ybtk = arg * 3 + 1180; arg = ybtk - ybtk / 1000003 * 1000003; return fbtj(); }
+long fbtl() { long ybtl; ybtl = arg * 3 + 1181; arg = ybtl - ybtl / 1000003 * 1000003; return fbtk(); }
+long fbtm() { long ybtm; ybtm = arg * 3 + 1182; arg = ybtm - ybtm / 1000003 * 1000003; return fbtl(); }
+long fbtn() { long ybtn; ybtn = arg * 3 + 1183; arg = ybtn - ybtn / 1000003 * 1000003; return fbtm(); }
+long fbto() { long ybto; ybto = arg * 3 + 1184; arg = ybto - ybto / 1000003 * 1000003; return fbtn(); }
+long fbtp() { long ybtp; ybtp = arg * 3 + 1185; arg = ybtp - ybtp / 1000003 * 1000003; return fbto(); }
+long fbtq() { long ybtq; ybtq = arg * 3 + 1186; arg = ybtq - ybtq / 1000003 * 1000003; return fbtp(); }
+long fbtr() { long ybtr; ybtr = arg * 3 + 1187; arg = ybtr - ybtr / 1000003 * 1000003; return fbtq(); }
+long fbts() { long ybts; ybts = arg * 3 + 1188; arg = ybts - ybts / 1000003 * 1000003; return fbtr(); }
+long fbtt() { long ybtt; ybtt = arg * 3 + 1189; arg = ybtt - ybtt / 1000003 * 1000003; return fbts(); }
+long fbtu() { long ybtu; ybtu = arg * 3 + 1190; arg = ybtu - ybtu / 1000003 * 1000003; return fbtt(); }
+long fbtv() { long ybtv; ybtv = arg * 3 + 1191; arg = ybtv - ybtv / 1000003 * 1000003; return fbtu(); }
+long fbtw() { long ybtw; ybtw = arg * 3 + 1192; arg = ybtw - ybtw / 1000003 * 1000003; return fbtv(); }
+long fbtx() { long ybtx; ybtx = arg * 3 + 1193; arg = ybtx - ybtx / 1000003 * 1000003; return fbtw(); }
+long fbty() { long ybty; ybty = arg * 3 + 1194; arg = ybty - ybty / 1000003 * 1000003; return fbtx(); }
+long fbtz() { long ybtz; ybtz = arg * 3 + 1195; arg = ybtz - ybtz / 1000003 * 1000003; return fbty(); }
+long fbua() { long ybua; ybua = arg * 3 + 1196; arg = ybua - ybua / 1000003 * 1000003; return fbtz(); }
+long fbub() { long ybub; ybub = arg * 3 + 1197; arg = ybub - ybub / 1000003 * 1000003; return fbua(); }
+long fbuc() { long ybuc; ybuc = arg * 3 + 1198; arg = ybuc - ybuc / 1000003 * 1000003; return fbub(); }
+long fbud() { long ybud; ybud = arg * 3 + 1199; arg = ybud - ybud / 1000003 * 1000003; return fbuc(); }
+
+long flong()
+{
+    long ylong;
+    ylong = arg * 1 + arg * 2 + arg * 3 + arg * 4 + arg * 5 + arg * 6 + arg * 7 + arg * 8 + arg * 9 + arg * 10 + arg * 11 + arg * 12 + arg * 13 + arg * 14 + arg * 15 + arg * 16 + arg * 17 + arg * 18 + arg * 19 + arg * 20 + arg * 21 + arg * 22 + arg * 23 + arg * 24 + arg * 25 + arg * 26 + arg * 27 + arg * 28 + arg * 29 + arg * 30 + arg * 31 + arg * 32 + arg * 33 + arg * 34 + arg * 35 + arg * 36 + arg * 37 + arg * 38 + arg * 39 + arg * 40 + arg * 41 + arg * 42 + arg * 43 + arg * 44 + arg * 45 + arg * 46 + arg * 47 + arg * 48 + arg * 49 + arg * 50 + arg * 51 + arg * 52 + arg * 53 + arg * 54 + arg * 55 + arg * 56 + arg * 57 + arg * 58 + arg * 59 + arg * 60 + arg * 61 + arg * 62 + arg * 63 + arg * 64 + arg * 65 + arg * 66 + arg * 67 + arg * 68 + arg * 69 + arg * 70 + arg * 71 + arg * 72 + arg * 73 + arg * 74 + arg * 75 + arg * 76 + arg * 77 + arg * 78 + arg * 79 + arg * 80 + arg * 81 + arg * 82 + arg * 83 + arg * 84 + arg * 85 + arg * 86 + arg * 87 + arg * 88 + arg * 89 + arg * 90 + arg * 91 + arg * 92 + arg * 93 + arg * 94 + arg * 95 + arg * 96 + arg * 97 + arg * 98 + arg * 99 + arg * 100 + arg * 101 + arg * 102 + arg * 103 + arg * 104 + arg * 105 + arg * 106 + arg * 107 + arg * 108 + arg * 109 + arg * 110 + arg * 111 + arg * 112 + arg * 113 + arg * 114 + arg * 115 + arg * 116 + arg * 117 + arg * 118 + arg * 119 + arg * 120 + arg * 121 + arg * 122 + arg * 123 + arg * 124 + arg * 125 + arg * 126 + arg * 127 + arg * 128 + arg * 129 + arg * 130 + arg * 131 + arg * 132 + arg * 133 + arg * 134 + arg * 135 + arg * 136 + arg * 137 + arg * 138 + arg * 139 + arg * 140 + arg * 141 + arg * 142 + arg * 143 + arg * 144 + arg * 145 + arg * 146 + arg * 147 + arg * 148 + arg * 149 + arg * 150 + arg * 151 + arg * 152 + arg * 153 + arg * 154 + arg * 155 + arg * 156 + arg * 157 + arg * 158 + arg * 159 + arg * 160 + arg * 161 + arg * 162 + arg * 163 + arg * 164 + arg * 165 + arg * 166 + arg * 167 + arg * 168 + arg * 169 + arg * 170 + arg * 171 + arg * 172 + arg * 173 + arg * 174 + arg * 175 + arg * 176 + arg * 177 + arg * 178 + arg * 179 + arg * 180 + arg * 181 + arg * 182 + arg * 183 + arg * 184 + arg * 185 + arg * 186 + arg * 187 + arg * 188 + arg * 189 + arg * 190 + arg * 191 + arg * 192 + arg * 193 + arg * 194 + arg * 195 + arg * 196 + arg * 197 + arg * 198 + arg * 199 + arg * 200 + arg * 201 + arg * 202 + arg * 203 + arg * 204 + arg * 205 + arg * 206 + arg * 207 + arg * 208 + arg * 209 + arg * 210 + arg * 211 + arg * 212 + arg * 213 + arg * 214 + arg * 215 + arg * 216 + arg * 217 + arg * 218 + arg * 219 + arg * 220 + arg * 221 + arg * 222 + arg * 223 + arg * 224 + arg * 225 + arg * 226 + arg * 227 + arg * 228 + arg * 229 + arg * 230 + arg * 231 + arg * 232 + arg * 233 + arg * 234 + arg * 235 + arg * 236 + arg * 237 + arg * 238 + arg * 239 + arg * 240 + arg * 241 + arg * 242 + arg * 243 + arg * 244 + arg * 245 + arg * 246 + arg * 247 + arg * 248 + arg * 249 + arg * 250 + arg * 251 + arg * 252 + arg * 253 + arg * 254 + arg * 255 + arg * 256 + arg * 257 + arg * 258 + arg * 259 + arg * 260 + arg * 261 + arg * 262 + arg * 263 + arg * 264 + arg * 265 + arg * 266 + arg * 267 + arg * 268 + arg * 269 + arg * 270 + arg * 271 + arg * 272 + arg * 273 + arg * 274 + arg * 275 + arg * 276 + arg * 277 + arg * 278 + arg * 279 + arg * 280 + arg * 281 + arg * 282 + arg * 283 + arg * 284 + arg * 285 + arg * 286 + arg * 287 + arg * 288 + arg * 289 + arg * 290 + arg * 291 + arg * 292 + arg * 293 + arg * 294 + arg * 295 + arg * 296 + arg * 297 + arg * 298 + arg * 299 + arg * 300;
+    return ylong;
+}
+
+int main()
+{
+    arg = 1;
+    print(fbud());
+    arg = 7;
+    print(faxc());
+    arg = 2;
+    print(faaa());
+    arg = 2;
+    print(flong());
+    return 0;
+}
@@ -0,0 +1,32 @@
+const char k = 200;
+char bytes[4];
+
+int main()
+{
+    char v;
+    char w;
+    unsigned char u;
+    int i;
+
+    v = 200;
+    w = 100;
+    u = 250;
+    print(v + v);
+    print(k + k);
+    print(w * 3);
+    print(v - 250);
+    print(v / 3);
+    print(u + u);
+    print(u * 2u);
+
+    w = v + v;
+    print(w);
+    i = v + w;
+    print(i);
+
+    bytes[0] = 255;
+    bytes[1] = 2;
+    print(bytes[0] + bytes[1]);
+    print(bytes[0] * bytes[0]);
+    return 0;
+}
@@ -0,0 +1,43 @@
+extern long apply(long (*op)(long), long x);
+
+long inc(long x)
+{
+    return x + 1;
+}
+
+long dbl(long x)
+{
+    return x * 2;
+}
+
+long (*current)(long) = dbl;
+
+long sum(long n)
+{
+    long total;
+    long i;
+    total = 0;
+    for (i = 0; i < n; i = i + 1)
+        total = total + apply(inc, i);
+    return total + apply(inc, n) + apply(dbl, n);
+}
+
+long apply(long (*op)(long), long x)
+{
+    return op(x);
+}
+
+long use(long x)
+{
+    return current(x);
+}
+
+int main()
+{
+    print(sum(10));
+    print(apply(dbl, 21));
+    print(use(41));
+    current = inc;
+    print(use(41));
+    return 0;
+}
@@ -0,0 +1,682 @@
+/**
+ * @file vm.c
+ * @brief Interpreter of the bytecode, with the builtins implemented natively.
+ *
+ * @project ToyCComp
+ */
+
+#include "vm.h"
+#include "debug.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    Instr_t *ret;
+    long *base;
+    __uint8_t *locals;
+} VMFrame_t;
+
+// Handlers of the sized variants, in the order of BYTECODE_SIZED
+#define VM_SIZED(label) &&label##8, &&label##16, &&label##32, &&label##64
+
+// char and short are zero extended, int is sign extended
+#define VM_CONVERT8(v) ((long)(__uint8_t)(v))
+#define VM_CONVERT16(v) ((long)(__uint16_t)(v))
+#define VM_CONVERT32(v) ((long)(__int32_t)(v))
+#define VM_CONVERT64(v) ((long)(v))
+
+#define VM_DISPATCH() goto *handlers[(ins = pc++)->op]
+#define A base[ins->a]
+#define B base[ins->b]
+#define C base[ins->c]
+
+static double to_double(long bits)
+{
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static long from_double(double value)
+{
+    long bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Bits of a float in the low half of a register, the upper half is zero
+static long from_float(float value)
+{
+    __uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float to_float(long bits)
+{
+    __uint32_t low = (__uint32_t)bits;
+    float value;
+    memcpy(&value, &low, sizeof(value));
+    return value;
+}
+
+static void fail(const char *message)
+{
+    fflush(stdout);
+    debug_print(SEV_ERROR, "[VM] %s", message);
+    exit(1);
+}
+
+// Arenas of the program bump through blocks like the ones of lib/arena.c,
+// taken from the heap of the interpreter
+typedef struct VMArenaBlock_t VMArenaBlock_t;
+struct VMArenaBlock_t
+{
+    VMArenaBlock_t *prev;
+    char data[];
+};
+
+typedef struct
+{
+    char *next;
+    char *end;
+    VMArenaBlock_t *block;
+    VMArenaBlock_t *first;
+    size_t block_size;
+} VMArena_t;
+
+static void arena_push_block(VMArena_t *arena, size_t size)
+{
+    VMArenaBlock_t *block = calloc(1, sizeof(VMArenaBlock_t) + size);
+
+    if (block == NULL)
+        fail("Out of memory");
+    block->prev = arena->block;
+    arena->block = block;
+    arena->next = block->data;
+    arena->end = block->data + size;
+}
+
+static VMArena_t *arena_new(long capacity)
+{
+    VMArena_t *arena = calloc(1, sizeof(VMArena_t));
+
+    arena->block_size = capacity > VM_ARENA_MIN_BLOCK ? (size_t)capacity : VM_ARENA_MIN_BLOCK;
+    arena_push_block(arena, arena->block_size);
+    arena->first = arena->block;
+    return arena;
+}
+
+static long arena_alloc(VMArena_t *arena, long size, long align)
+{
+    uintptr_t start;
+
+    if (align < 1)
+        align = 1;
+    start = ((uintptr_t)arena->next + align - 1) / align * align;
+    if (start + size > (uintptr_t)arena->end)
+    {
+        // Objects bigger than a block get a block of their own
+        arena_push_block(
+            arena, (size_t)(size + align) > arena->block_size ? (size_t)(size + align) : arena->block_size);
+        start = ((uintptr_t)arena->next + align - 1) / align * align;
+    }
+    arena->next = (char *)start + size;
+    return (long)start;
+}
+
+static void arena_reset(VMArena_t *arena)
+{
+    while (arena->block != arena->first)
+    {
+        VMArenaBlock_t *prev = arena->block->prev;
+        free(arena->block);
+        arena->block = prev;
+    }
+    arena->next = arena->first->data;
+    arena->end = arena->first->data + arena->block_size;
+}
+
+static long call_builtin(Builtin_e builtin, long *args)
+{
+    switch (builtin)
+    {
+    case BUILTIN_ARENA_NEW:
+        return (long)arena_new(args[0]);
+    case BUILTIN_ARENA_ALLOC:
+        return arena_alloc((VMArena_t *)args[0], args[1], args[2]);
+    case BUILTIN_ARENA_RESET:
+        arena_reset((VMArena_t *)args[0]);
+        break;
+    case BUILTIN_PRINT:
+        printf("%ld\n", args[0]);
+        break;
+    case BUILTIN_PRINT_CHAR:
+        putchar((char)args[0]);
+        break;
+    case BUILTIN_PRINT_STR:
+        fputs((char *)args[0], stdout);
+        break;
+    case BUILTIN_PRINT_LN:
+        puts((char *)args[0]);
+        break;
+    case BUILTIN_PRINT_DOUBLE:
+        printf("%g\n", to_double(args[0]));
+        break;
+    }
+    return 0;
+}
+
+// Integer arguments are passed in the integer registers and floating point
+// ones in the xmm registers, each in order. Every C function taking up to 8
+// arguments can be called through these types, it only reads the registers
+// of its own arguments
+#define VM_NATIVE_ARGS long, long, long, long, long, long, long, long, \
+                       double, double, double, double, double, double, double, double
+typedef long (*VMNative_t)(VM_NATIVE_ARGS);
+typedef double (*VMNativeFloat_t)(VM_NATIVE_ARGS);
+
+static long call_native(BytecodeFunc_t *callee, long *args, int nargs)
+{
+    long a[BYTECODE_MAX_NATIVE_ARGS] = {0};
+    double f[BYTECODE_MAX_NATIVE_ARGS] = {0};
+    int int_count = 0, float_count = 0;
+    long result;
+
+    // A float is read from the low half of its register
+    for (int i = 0; i < nargs; i++)
+    {
+        if (callee->float32_args & (1 << i))
+            f[float_count++] = to_double(from_float(to_double(args[i])));
+        else if (callee->float_args & (1 << i))
+            f[float_count++] = to_double(args[i]);
+        else
+            a[int_count++] = args[i];
+    }
+#define VM_NATIVE_CALL(type) ((type)callee->native)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], \
+                                                   f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7])
+    if (callee->ret_float)
+    {
+        double value = VM_NATIVE_CALL(VMNativeFloat_t);
+        return callee->ret_size == 32 ? from_double(to_float(from_double(value))) : from_double(value);
+    }
+    result = VM_NATIVE_CALL(VMNative_t);
+#undef VM_NATIVE_CALL
+    switch (callee->ret_size)
+    {
+    case 8:
+        return VM_CONVERT8(result);
+    case 16:
+        return VM_CONVERT16(result);
+    case 32:
+        return callee->ret_unsigned ? (long)(__uint32_t)result : VM_CONVERT32(result);
+    default:
+        return result;
+    }
+}
+
+// Atomics use the memory order of the program, args[0] is the address of
+// the object and the result is converted like the value of the object
+#define VM_ATOMIC(size, type)                                                                  \
+    static long atomic##size(AtomicOp_e op, int order, long *args)                             \
+    {                                                                                          \
+        type *p = (type *)args[0];                                                             \
+        switch (op)                                                                            \
+        {                                                                                      \
+        case ATOMIC_LOAD:                                                                      \
+            return VM_CONVERT##size(__atomic_load_n(p, order));                                \
+        case ATOMIC_STORE:                                                                     \
+            __atomic_store_n(p, (type)args[1], order);                                         \
+            return 0;                                                                          \
+        case ATOMIC_EXCHANGE:                                                                  \
+            return VM_CONVERT##size(__atomic_exchange_n(p, (type)args[1], order));             \
+        case ATOMIC_COMPARE_EXCHANGE:                                                          \
+            return __atomic_compare_exchange_n(                                                \
+                p, (type *)args[1], (type)args[2], false, order, __ATOMIC_RELAXED);            \
+        case ATOMIC_FETCH_ADD:                                                                 \
+            return VM_CONVERT##size(__atomic_fetch_add(p, (type)args[1], order));              \
+        case ATOMIC_FETCH_OR:                                                                  \
+            return VM_CONVERT##size(__atomic_fetch_or(p, (type)args[1], order));               \
+        default:                                                                               \
+            __atomic_thread_fence(order);                                                      \
+            return 0;                                                                          \
+        }                                                                                      \
+    }
+
+VM_ATOMIC(8, __uint8_t)
+VM_ATOMIC(16, __uint16_t)
+VM_ATOMIC(32, __int32_t)
+VM_ATOMIC(64, long)
+
+static long atomic(Instr_t *ins, long *args)
+{
+    static long (*sized[])(AtomicOp_e, int, long *) = {atomic8, atomic16, atomic32, atomic64};
+    return sized[ins->c]((AtomicOp_e)ins->b, ins->imm, args);
+}
+
+int vm_run(Bytecode_t *program)
+{
+    static void *handlers[OP_COUNT] = {
+        &&op_loadi,
+        &&op_loadk,
+        &&op_addr,
+        VM_SIZED(op_cast),
+        VM_SIZED(op_load),
+        VM_SIZED(op_loadg),
+        VM_SIZED(op_store),
+        VM_SIZED(op_storeg),
+        VM_SIZED(op_add),
+        VM_SIZED(op_sub),
+        VM_SIZED(op_mul),
+        VM_SIZED(op_div),
+        VM_SIZED(op_mod),
+        VM_SIZED(op_addi),
+        VM_SIZED(op_subi),
+        VM_SIZED(op_muli),
+        VM_SIZED(op_divi),
+        VM_SIZED(op_modi),
+        &&op_index,
+        &&op_laddr,
+        &&op_lindex,
+        &&op_lzero,
+        &&op_gt,
+        &&op_ge,
+        &&op_lt,
+        &&op_le,
+        &&op_eq,
+        &&op_ne,
+        &&op_loadu32,
+        &&op_loadgu32,
+        &&op_castu32,
+        &&op_divu,
+        &&op_modu,
+        &&op_shri,
+        &&op_andi,
+        &&op_gtu,
+        &&op_geu,
+        &&op_ltu,
+        &&op_leu,
+        &&op_fadd,
+        &&op_fsub,
+        &&op_fmul,
+        &&op_fdiv,
+        &&op_fround,
+        &&op_fgt,
+        &&op_fge,
+        &&op_flt,
+        &&op_fle,
+        &&op_feq,
+        &&op_fne,
+        &&op_i2f,
+        &&op_f2i,
+        &&op_u2f,
+        &&op_f2u,
+        &&op_fwiden,
+        &&op_fnarrow,
+        &&op_jmp,
+        &&op_jz,
+        &&op_jnz,
+        &&op_jgt,
+        &&op_jge,
+        &&op_jlt,
+        &&op_jle,
+        &&op_jeq,
+        &&op_jne,
+        &&op_jgtu,
+        &&op_jgeu,
+        &&op_jltu,
+        &&op_jleu,
+        &&op_call,
+        &&op_calln,
+        &&op_callx,
+        &&op_callr,
+        &&op_atomic,
+        &&op_ret,
+    };
+    BytecodeFunc_t *functions = program->functions;
+    Instr_t *code = program->code;
+    long *constants = program->constants;
+    __uint8_t *data = program->data;
+    long *stack = malloc(VM_STACK_REGS * sizeof(long));
+    long *stack_end = stack + VM_STACK_REGS;
+    VMFrame_t *frames = malloc(VM_MAX_CALL_DEPTH * sizeof(VMFrame_t));
+    VMFrame_t *frame = frames;
+    BytecodeFunc_t *main_func = &functions[program->main_func];
+    BytecodeFunc_t *callee;
+    long *base = stack;
+    __uint8_t *locals_stack = malloc(VM_LOCALS_SIZE);
+    __uint8_t *locals_end = locals_stack + VM_LOCALS_SIZE;
+    __uint8_t *locals = locals_stack;
+    __uint8_t *locals_top = locals_stack + main_func->locals_size;
+    Instr_t *pc, *ins;
+
+    // Addresses in the data are only known once it doesn't move anymore
+    for (size_t i = 0; i < program->reloc_count; i++)
+    {
+        __uint8_t *target = data + program->relocs[i].target;
+        memcpy(data + program->relocs[i].offset, &target, sizeof(target));
+    }
+
+    if (main_func->reg_count > VM_STACK_REGS || main_func->locals_size > VM_LOCALS_SIZE)
+        fail("Stack overflow");
+    pc = code + main_func->entry;
+    VM_DISPATCH();
+
+op_loadi:
+    A = ins->imm;
+    VM_DISPATCH();
+op_loadk:
+    A = constants[ins->imm];
+    VM_DISPATCH();
+op_addr:
+    A = (long)(data + ins->imm);
+    VM_DISPATCH();
+
+#define VM_SIZED_OPS(size, type)                                            \
+    op_cast##size:                                                          \
+    A = VM_CONVERT##size(A);                                                \
+    VM_DISPATCH();                                                          \
+    op_load##size:                                                          \
+    A = VM_CONVERT##size(*(type *)(B + ins->imm));                          \
+    VM_DISPATCH();                                                          \
+    op_loadg##size:                                                         \
+    A = VM_CONVERT##size(*(type *)(data + ins->imm));                       \
+    VM_DISPATCH();                                                          \
+    op_store##size:                                                         \
+    *(type *)(A + ins->imm) = (type)B;                                      \
+    VM_DISPATCH();                                                          \
+    op_storeg##size:                                                        \
+    *(type *)(data + ins->imm) = (type)B;                                   \
+    VM_DISPATCH();                                                          \
+    op_add##size:                                                           \
+    A = VM_CONVERT##size((unsigned long)B + (unsigned long)C);              \
+    VM_DISPATCH();                                                          \
+    op_sub##size:                                                           \
+    A = VM_CONVERT##size((unsigned long)B - (unsigned long)C);              \
+    VM_DISPATCH();                                                          \
+    op_mul##size:                                                           \
+    A = VM_CONVERT##size((unsigned long)B * (unsigned long)C);              \
+    VM_DISPATCH();                                                          \
+    op_div##size:                                                           \
+    if (C == 0)                                                             \
+        fail("Division by zero");                                           \
+    /* The quotient of the smallest value by -1 wraps like idiv would */   \
+    A = VM_CONVERT##size(C == -1 ? -(unsigned long)B : (unsigned long)(B / C)); \
+    VM_DISPATCH();                                                          \
+    op_mod##size:                                                           \
+    if (C == 0)                                                             \
+        fail("Division by zero");                                           \
+    A = VM_CONVERT##size(C == -1 ? 0 : B % C);                              \
+    VM_DISPATCH();                                                          \
+    op_addi##size:                                                          \
+    A = VM_CONVERT##size((unsigned long)B + (unsigned long)ins->imm);       \
+    VM_DISPATCH();                                                          \
+    op_subi##size:                                                          \
+    A = VM_CONVERT##size((unsigned long)B - (unsigned long)ins->imm);       \
+    VM_DISPATCH();                                                          \
+    op_muli##size:                                                          \
+    A = VM_CONVERT##size((unsigned long)B * (unsigned long)ins->imm);       \
+    VM_DISPATCH();                                                          \
+    op_divi##size:                                                          \
+    A = VM_CONVERT##size(B / ins->imm);                                     \
+    VM_DISPATCH();                                                          \
+    op_modi##size:                                                          \
+    A = VM_CONVERT##size(B % ins->imm);                                     \
+    VM_DISPATCH();
+
+    VM_SIZED_OPS(8, __uint8_t)
+    VM_SIZED_OPS(16, __uint16_t)
+    VM_SIZED_OPS(32, __int32_t)
+    VM_SIZED_OPS(64, long)
+
+op_index:
+    A = (long)(data + ins->imm + (B << ins->c));
+    VM_DISPATCH();
+op_laddr:
+    A = (long)(locals + ins->imm);
+    VM_DISPATCH();
+op_lindex:
+    A = (long)(locals + ins->imm + (B << ins->c));
+    VM_DISPATCH();
+op_lzero:
+    memset(locals + ins->imm, 0, A);
+    VM_DISPATCH();
+
+op_gt:
+    A = B > C;
+    VM_DISPATCH();
+op_ge:
+    A = B >= C;
+    VM_DISPATCH();
+op_lt:
+    A = B < C;
+    VM_DISPATCH();
+op_le:
+    A = B <= C;
+    VM_DISPATCH();
+op_eq:
+    A = B == C;
+    VM_DISPATCH();
+op_ne:
+    A = B != C;
+    VM_DISPATCH();
+
+// Unsigned values are zero extended, so they are compared and divided as
+// unsigned longs whatever their size
+op_loadu32:
+    A = *(__uint32_t *)(B + ins->imm);
+    VM_DISPATCH();
+op_loadgu32:
+    A = *(__uint32_t *)(data + ins->imm);
+    VM_DISPATCH();
+op_castu32:
+    A = (__uint32_t)A;
+    VM_DISPATCH();
+op_divu:
+    if (C == 0)
+        fail("Division by zero");
+    A = (unsigned long)B / (unsigned long)C;
+    VM_DISPATCH();
+op_modu:
+    if (C == 0)
+        fail("Division by zero");
+    A = (unsigned long)B % (unsigned long)C;
+    VM_DISPATCH();
+op_shri:
+    A = (unsigned long)B >> ins->imm;
+    VM_DISPATCH();
+op_andi:
+    A = B & ins->imm;
+    VM_DISPATCH();
+op_gtu:
+    A = (unsigned long)B > (unsigned long)C;
+    VM_DISPATCH();
+op_geu:
+    A = (unsigned long)B >= (unsigned long)C;
+    VM_DISPATCH();
+op_ltu:
+    A = (unsigned long)B < (unsigned long)C;
+    VM_DISPATCH();
+op_leu:
+    A = (unsigned long)B <= (unsigned long)C;
+    VM_DISPATCH();
+
+op_fadd:
+    A = from_double(to_double(B) + to_double(C));
+    VM_DISPATCH();
+op_fsub:
+    A = from_double(to_double(B) - to_double(C));
+    VM_DISPATCH();
+op_fmul:
+    A = from_double(to_double(B) * to_double(C));
+    VM_DISPATCH();
+op_fdiv:
+    A = from_double(to_double(B) / to_double(C));
+    VM_DISPATCH();
+op_fround:
+    A = from_double((float)to_double(A));
+    VM_DISPATCH();
+op_fgt:
+    A = to_double(B) > to_double(C);
+    VM_DISPATCH();
+op_fge:
+    A = to_double(B) >= to_double(C);
+    VM_DISPATCH();
+op_flt:
+    A = to_double(B) < to_double(C);
+    VM_DISPATCH();
+op_fle:
+    A = to_double(B) <= to_double(C);
+    VM_DISPATCH();
+op_feq:
+    A = to_double(B) == to_double(C);
+    VM_DISPATCH();
+op_fne:
+    A = to_double(B) != to_double(C);
+    VM_DISPATCH();
+op_i2f:
+    A = from_double((double)A);
+    VM_DISPATCH();
+op_f2i:
+{
+    // Out of range values give the integer indefinite value, like cvttsd2si
+    double value = to_double(A);
+    A = value > -9223372036854775808.0 && value < 9223372036854775808.0 ? (long)value : LONG_MIN;
+    VM_DISPATCH();
+}
+op_u2f:
+    A = from_double((double)(unsigned long)A);
+    VM_DISPATCH();
+op_f2u:
+{
+    // Like the generated code, values of at least 2^63 are converted too
+    double value = to_double(A);
+    if (value >= 9223372036854775808.0 && value < 18446744073709551616.0)
+        A = (long)(unsigned long)value;
+    else
+        A = value > -9223372036854775808.0 && value < 9223372036854775808.0 ? (long)value : LONG_MIN;
+    VM_DISPATCH();
+}
+op_fwiden:
+    A = from_double(to_float(A));
+    VM_DISPATCH();
+op_fnarrow:
+    A = from_float((float)to_double(A));
+    VM_DISPATCH();
+
+op_jmp:
+    pc = code + ins->imm;
+    VM_DISPATCH();
+op_jz:
+    if (A == 0)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jnz:
+    if (A != 0)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jgt:
+    if (A > B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jge:
+    if (A >= B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jlt:
+    if (A < B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jle:
+    if (A <= B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jeq:
+    if (A == B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jne:
+    if (A != B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+
+op_jgtu:
+    if ((unsigned long)A > (unsigned long)B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jgeu:
+    if ((unsigned long)A >= (unsigned long)B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jltu:
+    if ((unsigned long)A < (unsigned long)B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+op_jleu:
+    if ((unsigned long)A <= (unsigned long)B)
+        pc = code + ins->imm;
+    VM_DISPATCH();
+
+op_call:
+    callee = &functions[ins->imm];
+enter:
+{
+    long *callee_base = base + ins->a;
+
+    if (
+        ++frame == frames + VM_MAX_CALL_DEPTH || callee_base + callee->reg_count > stack_end ||
+        callee->locals_size > (size_t)(locals_end - locals_top))
+        fail("Stack overflow");
+    frame->ret = pc;
+    frame->base = base;
+    frame->locals = locals;
+    base = callee_base;
+    locals = locals_top;
+    locals_top += callee->locals_size;
+    pc = code + callee->entry;
+    VM_DISPATCH();
+}
+op_calln:
+    A = call_builtin((Builtin_e)ins->imm, &A);
+    VM_DISPATCH();
+op_callx:
+    A = call_native(&functions[ins->imm], &A, ins->b);
+    VM_DISPATCH();
+op_callr:
+    if (C <= 0 || (unsigned long)C > program->symbol_count)
+        fail("Call through an invalid function pointer");
+    callee = &functions[C - 1];
+    if (callee->defined)
+        goto enter;
+    if (callee->is_builtin)
+        A = call_builtin((Builtin_e)callee->builtin, &A);
+    else
+        A = call_native(callee, &A, ins->b);
+    VM_DISPATCH();
+op_atomic:
+    A = atomic(ins, &A);
+    VM_DISPATCH();
+op_ret:
+    // The result is left in the first register of the callee, where the
+    // caller expects it
+    base[0] = A;
+    if (frame == frames)
+    {
+        int status = (int)base[0];
+        free(stack);
+        free(frames);
+        free(locals_stack);
+        return status;
+    }
+    locals_top = locals;
+    locals = frame->locals;
+    base = frame->base;
+    pc = frame->ret;
+    frame--;
+    VM_DISPATCH();
+}
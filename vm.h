@@ -0,0 +1,27 @@
+#ifndef _VM_H_
+#define _VM_H_
+
+#include "bytecode.h"
+
+#define VM_STACK_REGS (1 << 20) /**< Registers shared by all the active calls. */
+#define VM_MAX_CALL_DEPTH (1 << 16)
+#define VM_LOCALS_SIZE (8 << 20) /**< Bytes of local arrays of all the active calls, like a native stack. */
+#define VM_ARENA_MIN_BLOCK (64 * 1024) /**< Smallest block of an arena, like lib/arena.c. */
+
+/**
+ * @brief Runs a program lowered to bytecode.
+ *
+ * The instructions are dispatched with computed gotos, every handler jumps
+ * straight to the handler of the next instruction. The registers of a call
+ * start where the caller evaluated its arguments, so calls copy nothing.
+ * Local arrays are kept on a stack of their own, every call pushes the
+ * arrays of its function.
+ * The builtins are implemented natively with the C library, nothing has to
+ * be assembled or linked. Extern functions are called directly.
+ *
+ * @param program Pointer to the program, its data is modified while it runs.
+ * @return The value returned by main.
+ */
+int vm_run(Bytecode_t *program);
+
+#endif // _VM_H_
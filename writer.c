@@ -0,0 +1,270 @@
+/**
+ * @file writer.c
+ * @brief Double-buffered output written from a background thread.
+ *
+ * @project ToyCComp
+ */
+
+#define _GNU_SOURCE
+
+#include "writer.h"
+#include "debug.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct
+{
+    char *data;
+    size_t len;
+    bool pending; /**< Handed to the writer thread and not written yet. */
+} WriterBuffer_t;
+
+typedef struct
+{
+    int fd;
+    char *path;     /**< Final path of the file, or name of the stream. */
+    char *tmp_path; /**< Path of the temporary file, NULL when using O_TMPFILE. */
+    mode_t mode;    /**< Permissions given to the file, those of the file it replaces if any. */
+    bool is_stream; /**< Writing to an already open descriptor, not to `path`. */
+    WriterBuffer_t buffers[WRITER_BUFFER_COUNT];
+    size_t filling; /**< Buffer being filled by the caller. */
+    size_t writing; /**< Next buffer the writer thread writes. */
+    bool closing;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t thread;
+} AsyncWriter_t;
+
+static void write_all(AsyncWriter_t *writer, const char *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = write(writer->fd, data, len);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            debug_print(SEV_ERROR, "[WRITER] Couldn't write %s: %s", writer->path, strerror(errno));
+            exit(1);
+        }
+        data += n;
+        len -= n;
+    }
+}
+
+static void *writer_thread(void *arg)
+{
+    AsyncWriter_t *writer = (AsyncWriter_t *)arg;
+
+    while (true)
+    {
+        pthread_mutex_lock(&writer->lock);
+        while (!writer->buffers[writer->writing].pending && !writer->closing)
+            pthread_cond_wait(&writer->cond, &writer->lock);
+        if (!writer->buffers[writer->writing].pending)
+        {
+            pthread_mutex_unlock(&writer->lock);
+            break;
+        }
+        pthread_mutex_unlock(&writer->lock);
+
+        WriterBuffer_t *buffer = &writer->buffers[writer->writing];
+        write_all(writer, buffer->data, buffer->len);
+
+        pthread_mutex_lock(&writer->lock);
+        buffer->len = 0;
+        buffer->pending = false;
+        writer->writing = (writer->writing + 1) % WRITER_BUFFER_COUNT;
+        pthread_cond_broadcast(&writer->cond);
+        pthread_mutex_unlock(&writer->lock);
+    }
+    return NULL;
+}
+
+// Hands the buffer being filled to the writer thread and waits for the next
+// one to be free
+static void submit_buffer(AsyncWriter_t *writer)
+{
+    pthread_mutex_lock(&writer->lock);
+    writer->buffers[writer->filling].pending = true;
+    writer->filling = (writer->filling + 1) % WRITER_BUFFER_COUNT;
+    pthread_cond_broadcast(&writer->cond);
+    while (writer->buffers[writer->filling].pending)
+        pthread_cond_wait(&writer->cond, &writer->lock);
+    pthread_mutex_unlock(&writer->lock);
+}
+
+static ssize_t writer_write(void *cookie, const char *data, size_t size)
+{
+    AsyncWriter_t *writer = (AsyncWriter_t *)cookie;
+    size_t left = size;
+
+    while (left > 0)
+    {
+        WriterBuffer_t *buffer = &writer->buffers[writer->filling];
+        size_t n = WRITER_BUFFER_SIZE - buffer->len;
+        if (n > left)
+            n = left;
+
+        memcpy(buffer->data + buffer->len, data, n);
+        buffer->len += n;
+        data += n;
+        left -= n;
+
+        if (buffer->len == WRITER_BUFFER_SIZE)
+            submit_buffer(writer);
+    }
+    return size;
+}
+
+// Gives the finished temporary file its final name, replacing any old file
+static void publish_file(AsyncWriter_t *writer)
+{
+    if (writer->tmp_path == NULL)
+    {
+        char proc_path[64];
+        size_t len = strlen(writer->path) + 32;
+
+        // An O_TMPFILE file can only be linked to a name that doesn't exist
+        writer->tmp_path = malloc(len);
+        snprintf(writer->tmp_path, len, "%s.%d.tmp", writer->path, getpid());
+        snprintf(proc_path, sizeof(proc_path), "/proc/self/fd/%d", writer->fd);
+        unlink(writer->tmp_path);
+        if (linkat(AT_FDCWD, proc_path, AT_FDCWD, writer->tmp_path, AT_SYMLINK_FOLLOW) != 0)
+        {
+            debug_print(SEV_ERROR, "[WRITER] Couldn't create %s: %s", writer->path, strerror(errno));
+            exit(1);
+        }
+    }
+
+    if (rename(writer->tmp_path, writer->path) != 0)
+    {
+        debug_print(SEV_ERROR, "[WRITER] Couldn't create %s: %s", writer->path, strerror(errno));
+        unlink(writer->tmp_path);
+        exit(1);
+    }
+}
+
+static int writer_close(void *cookie)
+{
+    AsyncWriter_t *writer = (AsyncWriter_t *)cookie;
+
+    if (writer->buffers[writer->filling].len > 0)
+        submit_buffer(writer);
+
+    pthread_mutex_lock(&writer->lock);
+    writer->closing = true;
+    pthread_cond_broadcast(&writer->cond);
+    pthread_mutex_unlock(&writer->lock);
+    pthread_join(writer->thread, NULL);
+
+    if (!writer->is_stream)
+        publish_file(writer);
+    close(writer->fd);
+
+    for (size_t i = 0; i < WRITER_BUFFER_COUNT; i++)
+        free(writer->buffers[i].data);
+    free(writer->tmp_path);
+    free(writer->path);
+    free(writer);
+    return 0;
+}
+
+static int open_tmp_file(AsyncWriter_t *writer)
+{
+    char *path_copy = strdup(writer->path);
+    int fd = open(dirname(path_copy), O_TMPFILE | O_WRONLY, 0600);
+    free(path_copy);
+
+    // Not every file system supports O_TMPFILE
+    if (fd < 0)
+    {
+        size_t len = strlen(writer->path) + 8;
+        writer->tmp_path = malloc(len);
+        snprintf(writer->tmp_path, len, "%s.XXXXXX", writer->path);
+        fd = mkstemp(writer->tmp_path);
+    }
+    if (fd >= 0)
+        fchmod(fd, writer->mode);
+    return fd;
+}
+
+static FILE *start_writer(AsyncWriter_t *writer)
+{
+    cookie_io_functions_t io = {.write = writer_write, .close = writer_close};
+
+    for (size_t i = 0; i < WRITER_BUFFER_COUNT; i++)
+        writer->buffers[i].data = malloc(WRITER_BUFFER_SIZE);
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->cond, NULL);
+    if (pthread_create(&writer->thread, NULL, writer_thread, writer) != 0)
+    {
+        debug_print(SEV_ERROR, "[WRITER] Couldn't start the writer thread");
+        exit(1);
+    }
+
+    return fopencookie(writer, "w", io);
+}
+
+FILE *writer_open(const char *path)
+{
+    AsyncWriter_t *writer;
+    struct stat st;
+    bool exists = stat(path, &st) == 0;
+
+    if (exists && !S_ISREG(st.st_mode))
+    {
+        // A device or a pipe can't be replaced, it is written in place
+        int fd = open(path, O_WRONLY);
+        if (fd < 0)
+        {
+            debug_print(SEV_ERROR, "[WRITER] Couldn't open %s: %s", path, strerror(errno));
+            return NULL;
+        }
+        return writer_open_fd(fd, path);
+    }
+
+    writer = (AsyncWriter_t *)calloc(1, sizeof(AsyncWriter_t));
+    if (exists)
+    {
+        // Replace the target of a symlink rather than the link itself
+        writer->path = realpath(path, NULL);
+        writer->mode = st.st_mode & 07777;
+    }
+    else
+    {
+        mode_t mask = umask(0);
+        umask(mask);
+        writer->mode = 0666 & ~mask;
+    }
+    if (writer->path == NULL)
+        writer->path = strdup(path);
+    writer->fd = open_tmp_file(writer);
+    if (writer->fd < 0)
+    {
+        debug_print(SEV_ERROR, "[WRITER] Couldn't create %s: %s", path, strerror(errno));
+        free(writer->tmp_path);
+        free(writer->path);
+        free(writer);
+        return NULL;
+    }
+    return start_writer(writer);
+}
+
+FILE *writer_open_fd(int fd, const char *name)
+{
+    AsyncWriter_t *writer = (AsyncWriter_t *)calloc(1, sizeof(AsyncWriter_t));
+
+    writer->path = strdup(name);
+    writer->fd = fd;
+    writer->is_stream = true;
+    return start_writer(writer);
+}
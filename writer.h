@@ -0,0 +1,41 @@
+#ifndef _WRITER_H_
+#define _WRITER_H_
+
+#include <stdio.h>
+
+#define WRITER_BUFFER_SIZE (1 << 20)
+#define WRITER_BUFFER_COUNT 2
+
+/**
+ * @brief Opens `path` for writing through a background writer thread.
+ *
+ * The returned stream is used like any other `FILE`. Output is collected in
+ * WRITER_BUFFER_COUNT buffers: once one is full it is handed to the writer
+ * thread and filling continues in the next one, so the caller only waits on
+ * the disk when every buffer is still being written.
+ *
+ * The data goes to an unnamed temporary file in the same directory
+ * (`O_TMPFILE`, or a uniquely named file where that isn't supported) that
+ * only replaces `path` when the stream is closed with fclose(). A compilation
+ * that fails half way never leaves a truncated file behind. A symlink is
+ * resolved so its target is replaced, the file keeps its permissions, and a
+ * path that isn't a regular file (a device or a pipe) is written in place.
+ *
+ * @param path Path of the file to write.
+ * @return The stream, or NULL if the file couldn't be created.
+ */
+FILE *writer_open(const char *path);
+
+/**
+ * @brief Writes to an already open descriptor through a background thread.
+ *
+ * Same buffering as writer_open(), for stdout or a pipe. The descriptor is
+ * closed with the stream.
+ *
+ * @param fd Descriptor to write to.
+ * @param name Name of the stream used in error messages.
+ * @return The stream.
+ */
+FILE *writer_open_fd(int fd, const char *name);
+
+#endif // _WRITER_H_